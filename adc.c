@@ -4,11 +4,16 @@
 
 #include "grbl.h"
 
+static const uint8_t adc_scan_channels[ADC_SCAN_N_CHANNELS] = ADC_SCAN_CHANNELS;
+static uint8_t adc_scan_result; // Scan list index of the conversion that just completed
+static uint8_t adc_scan_mux;    // Scan list index selected in ADMUX
+
 
 //Configure ADC Module
 void adc_setup(){
     // Initialize analog value
     analogVal = 0;
+    analogValFine = 0;
     /* Begin ADC Setup */
     // *------------- Configure Result Presentation --------------------*
     // When ADLAR = 1 (Left Adjusted)
@@ -38,24 +43,29 @@ void adc_setup(){
     // proper source (01)
     ADMUX |= 0b01000000;
     // *--------------- Select ADC Channel ------------------------------*
-    // Clear MUX3..0 in ADMUX (0x7C) in preparation for setting the 
+    // Clear MUX4..0 in ADMUX (0x7C) in preparation for setting the 
     // analog input
-    ADMUX &= 0b11110000;
-    // Set MUX3..0 in ADMUX (0x7C) to read from 
-    // ADC_CHANNEL_SELECT variable (Internal temp)
-    ADMUX |= ADC_THC_CHANNEL_SELECT;
+    ADMUX &= 0b11100000;
+    // Set MUX4..0 in ADMUX (0x7C) to read from 
+    // the first channel of the scan list
+    ADMUX |= adc_scan_channels[0];
+    adc_scan_result = 0;
+    adc_scan_mux = 0;
 
     // Set ADEN in ADCSRA (0x7A) to enable the ADC.
     // Note, this instruction takes 12 ADC clocks to execute
     ADCSRA |= 0b10000000;
     
     // Auto-Triggering Mode Eanble
+    // The Timer0 and Timer1 trigger sources are taken by the stepper driver, so free running
+    // mode paces the scan. The sample rate is then fixed by the ADC clock.
     // Set ADATE in ADCSRA (0x7A) to enable auto-triggering.
-    // ADCSRA |= 0b00100000;
+    ADCSRA |= 0b00100000;
     // Clear ADTS2..0 in ADCSRB (0x7B) to set trigger mode to free running.
     // This means that as soon as an ADC has finished, the next will be
     // immediately started.
-    // ADCSRB &= 0b11111000;
+    // Also clear MUX5, which selects channels 8-15.
+    ADCSRB &= 0b11110000;
 
   
     // *----------------- ADC Prescaler Selections -----------------------*
@@ -85,6 +95,15 @@ void adc_setup(){
     /* End ADC Setup */
 }
 
+//Atomic read of a scan list result slot
+uint16_t adc_get_scan_value(uint8_t idx){
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t value = analogScanVal[idx];
+  SREG = sreg;
+  return value;
+}
+
 //Used to start ADC with a first convertion
 void start_adc_convertion(){
 
@@ -95,18 +114,85 @@ void start_adc_convertion(){
 
 }
 
+// Sample ring and running sum for the average filter. 16 samples of 10 bits fit the uint16 sum.
+// Written by the ADC ISR. The main program reads them with interrupts disabled.
+static uint16_t adc_samples[ADC_FILTER_SAMPLES];
+static uint8_t adc_sample_head;
+static uint16_t adc_sample_sum;
+static volatile uint8_t adc_sample_count; // THC channel samples stored. Wraps.
+static uint8_t adc_filtered_count;        // adc_sample_count at the last published value
+
+// Returns the median of the last ADC_MEDIAN_SAMPLES samples by insertion sort. Only the copy of the
+// samples is done with interrupts disabled, so the ADC ISR is held off for about 60 cycles.
+static uint16_t adc_median()
+{
+  uint16_t samples[ADC_MEDIAN_SAMPLES];
+  uint16_t sorted[ADC_MEDIAN_SAMPLES];
+  uint8_t n, k;
+  uint8_t sreg = SREG;
+  cli();
+  uint8_t idx = adc_sample_head;
+  for (n = 0; n < ADC_MEDIAN_SAMPLES; n++) {
+    idx = (idx - 1) & (ADC_FILTER_SAMPLES - 1);
+    samples[n] = adc_samples[idx];
+  }
+  SREG = sreg;
+  for (n = 0; n < ADC_MEDIAN_SAMPLES; n++) {
+    for (k = n; (k > 0) && (sorted[k-1] > samples[n]); k--) { sorted[k] = sorted[k-1]; }
+    sorted[k] = samples[n];
+  }
+  return sorted[ADC_MEDIAN_SAMPLES/2];
+}
+
+// Publishes the arc voltage in analogVal and analogValFine, filtered by one of ADC_FILTER_*. Called by
+// thc_update() from the main program. The median filter costs about 400 cycles, the others about 30.
+// Returns false and keeps the last value, if the ADC stored no THC channel sample since the last call.
+uint8_t adc_update_filter(uint8_t filter)
+{
+  uint8_t sample_count = adc_sample_count;
+  if (sample_count == adc_filtered_count) { return(false); }
+  adc_filtered_count = sample_count;
+  uint16_t fine;
+  uint8_t sreg = SREG;
+  switch (filter) {
+    case ADC_FILTER_AVERAGE:
+      cli();
+      fine = adc_sample_sum >> (4 - ADC_FINE_SHIFT); // log2(ADC_FILTER_SAMPLES) = 4
+      SREG = sreg;
+      break;
+    case ADC_FILTER_MEDIAN: fine = adc_median() << ADC_FINE_SHIFT; break;
+    default:
+      cli();
+      fine = adc_samples[(adc_sample_head - 1) & (ADC_FILTER_SAMPLES - 1)] << ADC_FINE_SHIFT;
+      SREG = sreg;
+      break;
+  }
+  analogValFine = fine;
+  analogVal = (fine + bit(ADC_FINE_SHIFT-1)) >> ADC_FINE_SHIFT;
+  return(true);
+}
+
 //ADC Interruption
+// Rough cost at 16MHz, about 9.6k conversions per second: 50 cycles per conversion for the ISR and
+// scan (3% CPU), plus 30 cycles per THC channel sample for the ring and running sum. The filters
+// run in adc_update_filter().
 ISR(ADC_vect){
 
   // *----------- Read ADC value and store in analogValue variable ----------*  
   // Must read low first
-  analogVal = ADCL | (ADCH << 8);
-  // char mychar[15];
-  // sprintf(mychar,"%04d",analogVal);
-  // printString(mychar);
-  //  printString("\n");
-  // Needed if free-running mode isn't enabled.
-  // Set ADSC in ADCSRA (0x7A) to start another ADC conversion
-  ADCSRA |= 0b01000000;
-
-}
\ No newline at end of file
+  uint16_t sample = ADCL | (ADCH << 8);
+
+  // In free running mode the next conversion has already started on the channel selected in ADMUX,
+  // so the channel written here is converted after that one.
+  uint8_t idx = adc_scan_result;
+  analogScanVal[idx] = sample;
+  adc_scan_result = adc_scan_mux;
+  if (++adc_scan_mux == ADC_SCAN_N_CHANNELS) { adc_scan_mux = 0; }
+  ADMUX = (ADMUX & 0b11100000) | adc_scan_channels[adc_scan_mux];
+  if (adc_scan_channels[idx] != ADC_THC_CHANNEL_SELECT) { return; }
+
+  adc_sample_sum += sample - adc_samples[adc_sample_head];
+  adc_samples[adc_sample_head] = sample;
+  adc_sample_head = (adc_sample_head + 1) & (ADC_FILTER_SAMPLES - 1);
+  adc_sample_count++;
+}
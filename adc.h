@@ -6,14 +6,36 @@
 #define adc_h
 
         // ADC THC Chanel selector
-        // Do not set above 15! You will overrun other parts of ADMUX.
-        #define ADC_THC_CHANNEL_SELECT 3;
+        // Do not set above 7! You will overrun other parts of ADMUX.
+        #define ADC_THC_CHANNEL_SELECT 3
 
+        // ADC scan list. The ADC runs free at the ADC clock/13 (about 9.6 kHz) and converts these
+        // channels in turn, one conversion each, into the analogScanVal result slot of the same index.
+        // Conversions of ADC_THC_CHANNEL_SELECT also feed the arc voltage filter. List the THC channel
+        // more than once to sample it faster. Channels 0-7 only.
+        // Board pins: ANALOG_1 ADC3, ANALOG_2 ADC2, ANALOG_3 ADC5, ANALOG_4 ADC4.
+        #define ADC_SCAN_CHANNELS {ADC_THC_CHANNEL_SELECT, 2, 5, 4}
+        #define ADC_SCAN_N_CHANNELS 4
 
-        volatile uint16_t analogVal;            // Value to store analog result
+
+        // Arc voltage filter pipeline. The ADC ISR keeps a ring of the last ADC_FILTER_SAMPLES raw
+        // samples. adc_update_filter() publishes the filtered value selected by $45 at the THC update rate,
+        // or the latest sample while the THC is off.
+        #define ADC_FILTER_RAW 0                // Latest sample
+        #define ADC_FILTER_AVERAGE 1            // Oversampled average of the ring. Two extra bits.
+        #define ADC_FILTER_MEDIAN 2             // Median of the last ADC_MEDIAN_SAMPLES samples
+        #define ADC_FILTER_SAMPLES 16           // Power of two. 4^2 samples give two extra bits.
+        #define ADC_MEDIAN_SAMPLES 7            // Odd, not above ADC_FILTER_SAMPLES
+        #define ADC_FINE_SHIFT 2                // Extra bits of analogValFine over analogVal
+
+        volatile uint16_t analogVal;            // Value to store analog result. Filtered, 10-bit.
+        volatile uint16_t analogValFine;        // Filtered value with ADC_FINE_SHIFT extra bits
+        volatile uint16_t analogScanVal[ADC_SCAN_N_CHANNELS]; // Latest raw sample of each scan list entry
 
 
         void adc_setup();                       //Configure ADC Module
         void start_adc_convertion();            //Used to start ADC with a first convertion
+        uint16_t adc_get_scan_value(uint8_t idx); // Atomic read of a scan list result slot
+        uint8_t adc_update_filter(uint8_t filter); // Publish the filtered arc voltage. False, if no new samples.
 
 #endif
\ No newline at end of file
@@ -41,7 +41,16 @@
 #define DEFAULTS_RAMPS_BOARD
 #define CPU_MAP_2560_RAMPS_BOARD
 
-// Serial baud rate
+// Serial baud rate. This is the power-up default. Grbl may be switched to a higher rate, i.e. 250000,
+// 500000, or 1000000, with the `$B=<rate>` handshake, which is persisted in EEPROM when confirmed.
+// The `$B=<rate>` line is answered with `[BAUD:<rate>,<errors>,<stall>]` at the old rate, where errors
+// counts receive framing errors and overruns, and stall is the total msec Grbl has been blocked on
+// a full TX buffer. `$B` alone prints the same line. After acknowledging `$B=<rate>`, Grbl
+// switches and waits for the host to send `$B` at the new rate. This is answered with `ok` at the
+// new rate. If it doesn't arrive cleanly in time, Grbl reverts and answers `error:19` at the old rate.
+// A host can step down from the fastest rate to find the highest one that works with its adapter.
+// NOTE: At 16MHz, only 250000, 500000, and 1000000 are exact with the U2X double speed mode. 115200
+// is 2.1% fast. 230400 is 3.5% slow, too far off for reliable streaming, and `$B=` rejects it.
 // #define BAUD_RATE 230400
 #define BAUD_RATE 115200
 
@@ -85,6 +94,7 @@
 #define CMD_SPINDLE_OVR_STOP 0x9E
 #define CMD_COOLANT_FLOOD_OVR_TOGGLE 0xA0
 #define CMD_COOLANT_MIST_OVR_TOGGLE 0xA1
+#define CMD_BINARY_FRAME 0xA2 // Only when ENABLE_BINARY_FRAMING enabled. Starts a binary g-code frame.
 
 // If homing is enabled, homing init lock sets Grbl into an alarm state upon power up. This forces
 // the user to perform the homing cycle (or override the locks) before doing anything else. This is
@@ -155,6 +165,7 @@
 #define N_DECIMAL_RATEVALUE_MM    0 // Rate or velocity value in mm/min
 #define N_DECIMAL_SETTINGVALUE    3 // Decimals for floating point setting values
 #define N_DECIMAL_RPMVALUE        0 // RPM value in rotations per min.
+#define N_DECIMAL_SECONDS         3 // Time value in seconds. Run time estimates.
 
 // If your machine has two limits switches wired in parallel to one axis, you will need to enable
 // this feature. Since the two switches are sharing a single pin, there is no way for Grbl to tell
@@ -291,6 +302,14 @@
 #define REPORT_WCO_REFRESH_BUSY_COUNT 30  // (2-255)
 #define REPORT_WCO_REFRESH_IDLE_COUNT 10  // (2-255) Must be less than or equal to the busy count
 
+// Grbl can push status reports at a fixed interval without being polled with '?', set in msec by
+// the $14 setting (0 disables). The Timer2 tick requests each report like a '?' would, but skips
+// the cycle, if the serial TX buffer doesn't have at least this many bytes free. So a slow host
+// link never blocks the main loop, and the step segment buffer, on a full TX buffer. The minimum
+// interval is 20 msec (50Hz). The THC field includes the arc voltage and torch state when active.
+#define REPORT_AUTO_MIN_TX_AVAILABLE 160 // (1-TX_BUFFER_SIZE) Bytes. Longest status report size.
+#define REPORT_AUTO_MIN_INTERVAL 20 // msec (1-255)
+
 // The temporal resolution of the acceleration management subsystem. A higher number gives smoother
 // acceleration, particularly noticeable on machines that run at very high feedrates, but may negatively
 // impact performance. The correct value for this parameter is machine dependent, so it's advised to
@@ -300,6 +319,16 @@
 // certain the step segment buffer is increased/decreased to account for these changes.
 #define ACCELERATION_TICKS_PER_SECOND 100
 
+// Enables jerk-limited (S-curve) acceleration ramps. Each acceleration and deceleration ramp is
+// executed with a linearly rising and falling acceleration, limited by the axis jerk settings
+// ($140-$142 in mm/sec^3), and peaking at most at the acceleration settings ($120-$122). These ramps
+// are longer than constant acceleration ramps, most of all for small speed changes, and the planner
+// plans the block speeds with them, so every ramp fits its block. Cycle times are therefore longer
+// for the same acceleration settings, e.g. 12% on the host bench job. See `make scurve` in host/.
+// The smoother ramps reduce gantry ringing and usually allow higher acceleration settings on plasma
+// tables. NOTE: The planner passes and the block profiles take a few square roots more per block.
+// #define ENABLE_S_CURVE_ACCELERATION // Default disabled. Uncomment to enable.
+
 // Adaptive Multi-Axis Step Smoothing (AMASS) is an advanced feature that does what its name implies,
 // smoothing the stepping of multi-axis motions. This feature smooths motion particularly at low step
 // frequencies below 10kHz, where the aliasing between axes of multi-axis motions can cause audible
@@ -418,6 +447,68 @@
 // up with planning new incoming motions as they are executed. 
 // #define BLOCK_BUFFER_SIZE 36  // Uncomment to override default in planner.h.
 
+// The most blocks the reverse planner pass recomputes per new block, counted back from the newest.
+// Both passes stop where entry speeds stop changing, but a long run of blocks shorter than the
+// stopping distance keeps raising them all the way back, so the work per insert would grow with the
+// buffer size. Past the cap, blocks keep their entry speeds from earlier passes, which is always
+// safe, but only the last PLANNER_REPLAN_MAX_BLOCKS blocks are then looked ahead over. Larger
+// buffers queue more motions without looking further ahead. The forward pass visits the same blocks,
+// so at most about twice this many are touched per insert. Not applied to the full replans after a
+// feed hold.
+#define PLANNER_REPLAN_MAX_BLOCKS 64 // Integer (1-255)
+
+// Merges consecutive nearly collinear line motions into the last queued planner block, as long as
+// every merged line end stays within SEGMENT_MERGE_TOLERANCE of the merged block path. CAM programs
+// that export curves as thousands of very short G1 segments fill the planner buffer with only a few
+// millimeters of lookahead, so the machine never reaches the cutting speed. Merging lengthens the
+// blocks and the lookahead distance without more RAM. Only motions with the same feed rate, spindle
+// speed and run conditions are merged, never inverse time motions. The DEBUG report shows the number
+// of merged lines and the current lookahead distance.
+// #define ENABLE_SEGMENT_MERGING // Default disabled. Uncomment to enable.
+#define SEGMENT_MERGE_TOLERANCE 0.01 // Float (mm). Only used with ENABLE_SEGMENT_MERGING.
+
+// Junctions between motions with the torch off use the rapid junction deviation ($15) instead of $11,
+// so moves between pierces may round corners more and keep their speed. A junction with the torch on
+// at either side uses $11. Corners where the junction speed limit falls below CORNER_SLOWDOWN_RATIO of
+// the lower nominal speed of the two blocks flag both blocks as corner slowdowns. The THC holds the
+// torch height while executing them, since the arc voltage rises as the cut slows down.
+#define CORNER_SLOWDOWN_RATIO 0.5 // Float (0.0-1.0)
+
+// Stores the planner block entry and junction speeds as 32-bit integers in whole (mm/min)^2, with the
+// squared speed change of each block precomputed when it is queued. The reverse and forward planner
+// passes then run on integer adds and compares only, instead of software float multiplies and adds
+// for every block they visit, which matters with large planner buffers and short segments. The junction
+// geometry is still computed in float once per block. All values are truncated, so the plan is never
+// faster than the float planner. The speed error is below 1/(2*speed) mm/min per rounding, e.g. less
+// than 0.005 mm/min at 100 mm/min. Planned speeds are capped at 46340 mm/min.
+// #define ENABLE_FIXED_POINT_PLANNER // Default disabled. Uncomment to enable.
+
+// Queues G2/G3 arcs in the planner as single arc blocks, instead of a line block per arc segment.
+// The step segment generator traces the arc with a chord per step segment, keeping the chords
+// within the arc tolerance ($12). Small holes and tight contours in thick plate then use one planner
+// block each, so the planner doesn't run out of lookahead or stall on plan_buffer_line() calls.
+// The arc speed is limited, so the centripetal acceleration stays within the plane axes acceleration
+// at every point of the arc, v^2 <= accel*radius. Arcs within a single segment of the arc tolerance
+// are still queued as lines. Up to PLAN_ARC_BUFFER_SIZE-1 arcs are queued at a time. See planner.h.
+// #define ENABLE_PLANNER_ARCS // Default disabled. Uncomment to enable.
+
+// Runs planner arcs as fast as the line segments they replace. Line segments of an arc at the arc
+// tolerance ($12) corner at the junction deviation ($11) speed, which allows a centripetal
+// acceleration of about $11/$12 times the axis acceleration, e.g. ten times with the defaults.
+// Arc blocks are then limited to the same speed, when above the centripetal limit, so that enabling
+// ENABLE_PLANNER_ARCS never slows a job down. Comment to hold arcs to the centripetal limit, which
+// slowed the arcs of the host bench job from 95.6 to 99.5 sec. Has no effect without ENABLE_PLANNER_ARCS.
+#define ARC_SPEED_AS_LINE_SEGMENTS // Default enabled. Comment to disable.
+
+// Estimates the job run time in check mode ($C). Motions are queued in the planner as when running
+// the job, with the same lookahead, junction speeds, accelerations and overrides, and timed out of the
+// planner with the acceleration ramps of the step segment generator, without stepping. Buffer syncs,
+// like M3/M5 and G4 dwells, stop all motions as on the machine. After each line motion is timed, it's
+// reported as [ESTL:line number,seconds]. Motions of lines without N words are timed as line 0. The
+// totals are reported as [EST:total,cut,rapid,dwell] in seconds upon program end (M2/M30) and when
+// check mode is disabled. With ENABLE_S_CURVE_ACCELERATION, motions are timed with its ramps.
+// #define ENABLE_RUN_TIME_ESTIMATOR // Default disabled. Uncomment to enable.
+
 // Governs the size of the intermediary step segment buffer between the step execution algorithm
 // and the planner blocks. Each segment is set of steps executed at a constant velocity over a
 // fixed time defined by ACCELERATION_TICKS_PER_SECOND. They are computed such that the planner
@@ -460,8 +551,78 @@
 // As well as, older FTDI FT232RL-based Arduinos(Duemilanove) are known to work with standard
 // terminal programs since their firmware correctly manage these XON/XOFF characters. In any
 // case, please report any successes to grbl administrators!
+// The RX interrupt sends XOFF, ahead of any pending TX data, once the RX buffer fills to the
+// SERIAL_RX_FLOW_HIGH watermark in serial.h, and XON once the main program has read it down to
+// SERIAL_RX_FLOW_LOW. The sender may then simply stream, without character counting.
+// NOTE: The binary status report ($10 bit 2) is not escaped, so its data may hold the XON/XOFF
+// characters, which the host serial driver would take as flow control. With XON/XOFF enabled,
+// $10 rejects the binary bit with 'error:5' and the ASCII status report is always sent.
 // #define ENABLE_XONXOFF // Default disabled. Uncomment to enable.
 
+// Enables RTS hardware flow control on an output pin, driven from the same RX buffer watermarks as
+// XON/XOFF. The pin is set high to stop the host and low to let it send. Connect it to the CTS input
+// of a USB-serial adapter wired to the RX0/TX0 pins. The Atmega16U2 USB-serial chip on the Mega
+// doesn't support it. The pin is defined in cpu_map.h. Don't use with ENABLE_XONXOFF.
+// #define ENABLE_RTS_FLOW_CONTROL // Default disabled. Uncomment to enable.
+
+// Enables an optional binary framed command channel alongside the normal ASCII stream. A frame
+// begins with the CMD_BINARY_FRAME character, followed by a payload length byte, the payload, and
+// a CRC16 (low byte first). The CRC is CRC-16/CCITT as computed by avr-libc _crc_ccitt_update(),
+// seeded with 0xFFFF, over the length byte and the payload. The payload is a list of pre-tokenized
+// g-code words, each being the uppercase word letter followed by its value as a 4-byte little-endian
+// IEEE-754 float, i.e. 5 bytes per word. This skips the character filtering and float parsing of
+// the ASCII line path, which helps with dense streams of short motion blocks at fixed baud rates.
+// Each frame is one g-code block and is answered with 'ok' or 'error:' like a normal line. A frame
+// that fails its length or CRC check is discarded and answered with 'error:18'. ASCII lines and
+// binary frames may be freely mixed. System '$' commands and the pin M-commands are ASCII only.
+// NOTE: Realtime command characters are NOT picked off inside of a frame, since they may appear
+// in the binary float data. Send frames whole and keep them short, or a reset will be delayed.
+// NOTE: Senders must use character counting for frames, counting all frame bytes against the RX
+// buffer, since frame bytes that don't fit are dropped. The stored part of a short frame is
+// answered with 'error:18', and the data after it is dropped until the next frame or the end of the
+// next line. Dropped bytes are counted with the receive errors in the `$B` report.
+// #define ENABLE_BINARY_FRAMING // Default disabled. Uncomment to enable.
+
+// Tokenizes the g-code words of a streamed line as its characters arrive, instead of after the
+// end of line. Each word value is parsed as soon as the next word letter is received, so only the
+// last word is left to parse once the line ends, and the g-code parser is handed pre-tokenized
+// words without a second number parsing pass. This shortens the time from the last character
+// received to the block being queued in the planner. The tokens are stored in the upper half of
+// the line buffer, so no extra RAM is used. Lines longer than half of LINE_BUFFER_SIZE, '$' system
+// commands, and lines with the pin M-commands are executed from the text line as before.
+// NOTE: The text line is still kept, since '$' commands, startup lines, and the pin M-commands
+// require it. With DEBUG enabled, the debug report shows the line latency in Timer2 ticks.
+// #define ENABLE_INCREMENTAL_TOKENIZER // Default disabled. Uncomment to enable.
+
+// Enables a transmit-only telemetry port on a second hardware USART, separate from the command
+// stream on USART0. While the THC is working, a THC frame with the arc voltage sample, voltage
+// setpoint, torch correction velocity, and Z position is sent every TELEMETRY_THC_INTERVAL msec.
+// The binary status frame (see report.h) is sent every TELEMETRY_STATUS_INTERVAL msec. Both frame
+// layouts are described in report.h. The port has its own TX buffer and never waits. A frame that doesn't fit
+// in the buffer is dropped and counted, so heavy logging never competes with g-code streaming or
+// delays the 'ok' responses. USART2 (TX2, Mega Pin D16) is free on the Ramps 1.4 and is the
+// default. USART1 and USART3 share their pins with the Z and Y limit switches.
+// #define ENABLE_TELEMETRY_PORT // Default disabled. Uncomment to enable.
+#define TELEMETRY_USART 2 // (1-3) Hardware USART number. Only used with ENABLE_TELEMETRY_PORT.
+#define TELEMETRY_BAUD_RATE 250000
+#define TELEMETRY_THC_INTERVAL 10 // msec (1-255)
+#define TELEMETRY_STATUS_INTERVAL 50 // msec (1-255)
+
+// Enables g-code job playback from an SD card on the SPI port (Mega pins 50-53, reserved in
+// ports.h). The card must hold a FAT16 or FAT32 volume. Files are read from the root directory by
+// their 8.3 names. Job lines are fed into the protocol main loop like streamed lines, without the
+// 'ok' responses. Any line error stops the job and is reported with the failed line number. While a
+// job runs, serial lines are taken between job lines, so '$' commands and realtime commands work.
+// Serial g-code lines are rejected with 'error:63' during a job. The commands are:
+//   $F lists the card files. $F=NAME.NC starts a job, in the IDLE or check mode states.
+//   $FP pauses at the next line, and $FR resumes. Use feed hold for an immediate stop.
+//   $FS prints the job state, bytes read, file size, and lines executed. A reset ends the job.
+// Two 512 byte block buffers are used. The next block of the job file is read ahead into the second
+// one while the current block is parsed, and taken as soon as the card has it. A wait on the card,
+// up to SD_CARD_READ_TIMEOUT, keeps the step segment buffer filled and executes realtime commands,
+// so a slow card can't starve the steppers or delay a feed hold.
+// #define ENABLE_SD_CARD // Default disabled. Uncomment to enable.
+
 // A simple software debouncing feature for hard limit switches. When enabled, the interrupt 
 // monitoring the hard limit switch pins will enable the Arduino's watchdog timer to re-check 
 // the limit pin state after a delay of about 32msec. This can help with CNC machines with 
@@ -112,7 +112,12 @@ void coolant_set_state(uint8_t mode)
 // if an abort or check-mode is active.
 void coolant_sync(uint8_t mode)
 {
-  if (sys.state == STATE_CHECK_MODE) { return; }
+  if (sys.state == STATE_CHECK_MODE) {
+    #ifdef ENABLE_RUN_TIME_ESTIMATOR
+      estimator_sync();
+    #endif
+    return;
+  }
   protocol_buffer_synchronize(); // Ensure coolant turns on when specified in program.
   coolant_set_state(mode);
 }
@@ -138,6 +138,32 @@
   // Serial port interrupt vectors
   #define SERIAL_RX USART0_RX_vect
   #define SERIAL_UDRE USART0_UDRE_vect
+
+  // Define serial RTS flow control output pin. Only used with ENABLE_RTS_FLOW_CONTROL.
+  #define SERIAL_RTS_DDR    DDRD
+  #define SERIAL_RTS_PORT   PORTD
+  #define SERIAL_RTS_BIT    1 // MEGA2560 Digital Pin 20
+
+  // Define SD card SPI port pins. Pins 50-53 are reserved in ports.h.
+  #define SD_SPI_DDR    DDRB
+  #define SD_SPI_PORT   PORTB
+  #define SD_CS_BIT     0 // MEGA2560 Digital Pin 53
+  #define SD_SCK_BIT    1 // MEGA2560 Digital Pin 52
+  #define SD_MOSI_BIT   2 // MEGA2560 Digital Pin 51
+  #define SD_MISO_BIT   3 // MEGA2560 Digital Pin 50
+
+  // Telemetry port USART registers. Selected by TELEMETRY_USART in config.h.
+  #define _TELEMETRY_REG(prefix,n,suffix) prefix##n##suffix
+  #define TELEMETRY_REG(prefix,n,suffix) _TELEMETRY_REG(prefix,n,suffix)
+  #define TELEMETRY_UDRE  TELEMETRY_REG(USART,TELEMETRY_USART,_UDRE_vect)
+  #define TELEMETRY_UDR   TELEMETRY_REG(UDR,TELEMETRY_USART,)
+  #define TELEMETRY_UCSRA TELEMETRY_REG(UCSR,TELEMETRY_USART,A)
+  #define TELEMETRY_UCSRB TELEMETRY_REG(UCSR,TELEMETRY_USART,B)
+  #define TELEMETRY_UBRRH TELEMETRY_REG(UBRR,TELEMETRY_USART,H)
+  #define TELEMETRY_UBRRL TELEMETRY_REG(UBRR,TELEMETRY_USART,L)
+  #define TELEMETRY_U2X   TELEMETRY_REG(U2X,TELEMETRY_USART,)
+  #define TELEMETRY_TXEN  TELEMETRY_REG(TXEN,TELEMETRY_USART,)
+  #define TELEMETRY_UDRIE TELEMETRY_REG(UDRIE,TELEMETRY_USART,)
   
   // Define ports and pins
   #define DDR(port) DDR##port
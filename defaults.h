@@ -467,10 +467,13 @@
   #define DEFAULT_Z_MAX_RATE 500.0 // mm/min
   #define DEFAULT_X_ACCELERATION (100.0*60.0*60.0) // 10*60*60 mm/min^2 = 10 mm/sec^2
   #define DEFAULT_Y_ACCELERATION (100.0*60.0*60.0) // 10*60*60 mm/min^2 = 10 mm/sec^2
-  #define DEFAULT_Z_ACCELERATION (100.0*60.0*60.0) // 10*60*60 mm/min^2 = 10 mm/sec^2
+  #define DEFAULT_Z_ACCELERATION (750.0*60.0*60.0) // 750*60*60 mm/min^2 = 750 mm/sec^2. Torch lifter, also limits the THC ($44).
   #define DEFAULT_X_MAX_TRAVEL 200.0 // mm
   #define DEFAULT_Y_MAX_TRAVEL 200.0 // mm
   #define DEFAULT_Z_MAX_TRAVEL 200.0 // mm
+  #define DEFAULT_X_JERK (5000.0*60.0*60.0*60.0) // 5000*60*60*60 mm/min^3 = 5000 mm/sec^3
+  #define DEFAULT_Y_JERK (5000.0*60.0*60.0*60.0) // 5000*60*60*60 mm/min^3 = 5000 mm/sec^3
+  #define DEFAULT_Z_JERK (5000.0*60.0*60.0*60.0) // 5000*60*60*60 mm/min^3 = 5000 mm/sec^3
   #define DEFAULT_SPINDLE_RPM_MAX 1000.0 // rpm
   #define DEFAULT_SPINDLE_RPM_MIN 0.0 // rpm
   #define DEFAULT_STEP_PULSE_MICROSECONDS 10
@@ -479,6 +482,7 @@
   #define DEFAULT_STEPPER_IDLE_LOCK_TIME 255 // msec (0-254, 255 keeps steppers enabled)
   #define DEFAULT_STATUS_REPORT_MASK 1 // MPos enabled
   #define DEFAULT_JUNCTION_DEVIATION 0.02 // mm
+  #define DEFAULT_RAPID_JUNCTION_DEVIATION 0.1 // mm
   #define DEFAULT_ARC_TOLERANCE 0.002 // mm
   #define DEFAULT_REPORT_INCHES 0 // false
   #define DEFAULT_INVERT_ST_ENABLE 0 // false
@@ -493,6 +497,32 @@
   #define DEFAULT_HOMING_SEEK_RATE 2000.0 // mm/min
   #define DEFAULT_HOMING_DEBOUNCE_DELAY 250 // msec (0-65k)
   #define DEFAULT_HOMING_PULLOFF 1.0 // mm
+  #define DEFAULT_STATUS_REPORT_INTERVAL 0 // msec (0 disables, 20-255)
+#endif
+
+// Defaults for settings not given by the machine profile above.
+#ifndef DEFAULT_STATUS_REPORT_INTERVAL
+  #define DEFAULT_STATUS_REPORT_INTERVAL 0 // msec (0 disables, 20-255)
+#endif
+#ifndef DEFAULT_RAPID_JUNCTION_DEVIATION
+  #define DEFAULT_RAPID_JUNCTION_DEVIATION DEFAULT_JUNCTION_DEVIATION // mm
+#endif
+#ifndef DEFAULT_THC_KP
+  // PID controller, tuned with host/thc_sim.c. Settles and follows the plate faster than the
+  // hysteresis band controller at the same velocity. See README.md.
+  #define DEFAULT_THC_KP 150.0 // mm/min per count (0 selects the hysteresis band controller)
+  #define DEFAULT_THC_KI 10.0 // mm/min per count*sec
+  #define DEFAULT_THC_KD 0.0 // mm/min per count/sec
+  #define DEFAULT_THC_MAX_VELOCITY 500.0 // mm/min
+  #define DEFAULT_THC_ACCELERATION 750.0 // mm/sec^2
+#endif
+#ifndef DEFAULT_ADC_FILTER
+  #define DEFAULT_ADC_FILTER 1 // Oversampled average (0 raw, 1 average, 2 median)
+#endif
+#ifndef DEFAULT_X_JERK
+  #define DEFAULT_X_JERK (5000.0*60.0*60.0*60.0) // 5000*60*60*60 mm/min^3 = 5000 mm/sec^3
+  #define DEFAULT_Y_JERK (5000.0*60.0*60.0*60.0) // 5000*60*60*60 mm/min^3 = 5000 mm/sec^3
+  #define DEFAULT_Z_JERK (5000.0*60.0*60.0*60.0) // 5000*60*60*60 mm/min^3 = 5000 mm/sec^3
 #endif
 
 #endif
\ No newline at end of file
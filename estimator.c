@@ -0,0 +1,146 @@
+/**
+ *  estimator.c - Job run time estimate in check mode
+ *
+ *  Check mode line motions are queued in the planner as in a real job, with the same lookahead,
+ *  junction speeds, accelerations and overrides. Blocks are timed out of the planner tail instead
+ *  of being executed, using the trapezoid the step segment generator would run. Planner syncs
+ *  (M0-M2, M3-M9, G4 and the other buffer sync commands) stop all motions, as on the machine.
+ * */
+#include "grbl.h"
+
+#ifdef ENABLE_RUN_TIME_ESTIMATOR
+
+estimator_t estimator;
+
+
+static void estimator_add(estimator_time_t *time, float seconds)
+{
+  time->fraction += seconds;
+  if (time->fraction >= 1.0) {
+    uint32_t whole = trunc(time->fraction);
+    time->seconds += whole;
+    time->fraction -= whole;
+  }
+}
+
+
+// Reports and clears the time of the line motions timed so far.
+static void estimator_end_line()
+{
+  if (estimator.line_time > 0.0) {
+    report_line_time_estimate(estimator.line_number, estimator.line_time);
+    estimator.line_time = 0.0;
+  }
+}
+
+
+// Returns the time (sec) of the block velocity profile, from its planned entry speed to the exit
+// speed. Same ramps as the step segment generator.
+#ifdef ENABLE_S_CURVE_ACCELERATION
+static float estimator_block_time(plan_block_t *block, float exit_speed_sqr)
+{
+  float entry_speed = sqrt(plan_speed_sqr_to_float(block->entry_speed_sqr));
+  float exit_speed = sqrt(exit_speed_sqr);
+  float peak_speed = plan_compute_profile_nominal_speed(block);
+
+  // Jerk-limited ramp distances. Entry above the nominal speed is an override deceleration.
+  float cruise_mm = block->millimeters - plan_scurve_ramp_distance(block, entry_speed, peak_speed)
+                                       - plan_scurve_ramp_distance(block, exit_speed, peak_speed);
+  if (cruise_mm < 0.0) {
+    // Triangle profile. Nominal speed not reached.
+    cruise_mm = 0.0;
+    peak_speed = plan_scurve_peak_speed(block, entry_speed, exit_speed, peak_speed);
+  }
+
+  float time = plan_scurve_ramp_time(block, entry_speed, peak_speed) + plan_scurve_ramp_time(block, exit_speed, peak_speed);
+  if (cruise_mm > 0.0) { time += cruise_mm/peak_speed; }
+  return(60.0*time); // (min) to (sec)
+}
+#else
+static float estimator_block_time(plan_block_t *block, float exit_speed_sqr)
+{
+  float entry_speed_sqr = plan_speed_sqr_to_float(block->entry_speed_sqr);
+  float nominal_speed = plan_compute_profile_nominal_speed(block);
+  float nominal_speed_sqr = nominal_speed*nominal_speed;
+  float inv_2_accel = 0.5/block->acceleration;
+
+  // Ramp distances. Entry above the nominal speed is an override deceleration.
+  float cruise_mm = block->millimeters - fabs(nominal_speed_sqr-entry_speed_sqr)*inv_2_accel
+                                       - (nominal_speed_sqr-exit_speed_sqr)*inv_2_accel;
+  if (cruise_mm < 0.0) {
+    // Triangle profile. Nominal speed not reached.
+    cruise_mm = 0.0;
+    nominal_speed_sqr = block->acceleration*block->millimeters + 0.5*(entry_speed_sqr+exit_speed_sqr);
+    if (nominal_speed_sqr < entry_speed_sqr) { nominal_speed_sqr = entry_speed_sqr; }
+    nominal_speed = sqrt(nominal_speed_sqr);
+  }
+
+  float time = (fabs(nominal_speed-sqrt(entry_speed_sqr)) + nominal_speed-sqrt(exit_speed_sqr))/block->acceleration;
+  if (cruise_mm > 0.0) { time += cruise_mm/nominal_speed; }
+  return(60.0*time); // (min) to (sec)
+}
+#endif
+
+
+// Times the planner tail block as executed with the current plan and discards it.
+static void estimator_time_block()
+{
+  plan_block_t *block = plan_get_current_block();
+  float time = estimator_block_time(block, plan_get_exec_block_exit_speed_sqr());
+
+  if (block->line_number != estimator.line_number) {
+    estimator_end_line();
+    estimator.line_number = block->line_number;
+  }
+  estimator.line_time += time;
+  estimator_add(&estimator.total, time);
+  if (block->condition & PL_COND_FLAG_RAPID_MOTION) { estimator_add(&estimator.rapid, time); }
+  else { estimator_add(&estimator.cut, time); }
+  plan_discard_current_block();
+}
+
+
+void estimator_reset()
+{
+  memset(&estimator, 0, sizeof(estimator_t));
+}
+
+
+void estimator_buffer_line(float *target, plan_line_data_t *pl_data)
+{
+  if (plan_check_full_buffer()) { estimator_time_block(); }
+  plan_buffer_line(target, pl_data);
+}
+
+
+#ifdef ENABLE_PLANNER_ARCS
+void estimator_buffer_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+  float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear)
+{
+  while (plan_check_full_buffer() || plan_check_full_arc_buffer()) { estimator_time_block(); }
+  plan_buffer_arc(target, pl_data, position, offset, radius, angular_travel, axis_0, axis_1, axis_linear);
+}
+#endif
+
+
+void estimator_dwell(float seconds)
+{
+  estimator_sync();
+  estimator_add(&estimator.total, seconds);
+  estimator_add(&estimator.dwell, seconds);
+}
+
+
+void estimator_sync()
+{
+  while (plan_get_current_block() != NULL) { estimator_time_block(); }
+  estimator_end_line();
+}
+
+
+float estimator_get_seconds(estimator_time_t *time)
+{
+  return(time->seconds + time->fraction);
+}
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ *  estimator.h - Job run time estimate in check mode
+ * */
+
+#ifndef estimator_h
+#define estimator_h
+
+#ifdef ENABLE_RUN_TIME_ESTIMATOR
+
+        // Split time sum. Whole seconds and the fraction are kept apart, so that long jobs of
+        // short motions don't lose the fraction to float precision.
+        typedef struct {
+          uint32_t seconds;
+          float fraction;
+        } estimator_time_t;
+
+        typedef struct {
+          estimator_time_t total;
+          estimator_time_t cut;     // Feed motions
+          estimator_time_t rapid;   // Rapid motions
+          estimator_time_t dwell;   // G4 dwells
+          int32_t line_number;      // Line of the motions timed into line_time
+          float line_time;          // Time of the current line motions (sec)
+        } estimator_t;
+        extern estimator_t estimator;
+
+        void estimator_reset();                                              // Clear totals. Called when check mode is enabled.
+        void estimator_buffer_line(float *target, plan_line_data_t *pl_data); // Plan a check mode line motion. Called by mc_line().
+        #ifdef ENABLE_PLANNER_ARCS
+          void estimator_buffer_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+            float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear);
+        #endif
+        void estimator_dwell(float seconds);                                 // Time a check mode dwell.
+        void estimator_sync();                                               // Time all queued motions to a full stop.
+        float estimator_get_seconds(estimator_time_t *time);
+
+#endif
+
+#endif
@@ -0,0 +1,245 @@
+/**
+ *  fat.c - Read-only FAT16/FAT32 file reader
+ *  Lists and reads files in the root directory of the first volume, by their 8.3 names. Long file
+ *  names and subdirectories are not supported. All data goes through a single block buffer, which
+ *  also caches the last block read. File reads ask the driver to read ahead the next block of the
+ *  file with fat_block_read_ahead().
+ *  NOTE: Only depends on fat_block_read(). Keep it free of AVR code, so it can be built on a host
+ *  with FAT_HOST_BUILD defined.
+ * */
+
+#ifdef FAT_HOST_BUILD
+  #include <stdint.h>
+  #include <stdbool.h>
+  #include <string.h>
+  #include "fat.h"
+  #define ENABLE_SD_CARD
+#else
+  #include "grbl.h"
+#endif
+
+#ifdef ENABLE_SD_CARD
+
+#define FAT_BOOT_SIGNATURE 0xAA55
+#define FAT_NO_BLOCK 0xFFFFFFFF
+#define FAT_DIR_ENTRY_SIZE 32
+#define FAT_ATTR_VOLUME_ID 0x08 // Also set for long file name entries.
+#define FAT_ATTR_DIRECTORY 0x10
+#define FAT_ENTRY_DELETED 0xE5
+
+static uint8_t fat_buffer[FAT_BLOCK_SIZE];
+static uint32_t fat_buffer_block = FAT_NO_BLOCK;
+
+static uint8_t fat_type;           // 16 or 32. Zero when not mounted.
+static uint8_t fat_cluster_shift;  // log2 of blocks per cluster
+static uint32_t fat_start;         // First block of the first FAT
+static uint32_t fat_root_start;    // First block of the FAT16 root directory
+static uint16_t fat_root_entries;  // FAT16 root directory entries
+static uint32_t fat_root_cluster;  // First cluster of the FAT32 root directory
+static uint32_t fat_data_start;    // First block of cluster 2
+
+
+static uint16_t fat_get16(uint8_t *ptr) { return(ptr[0] | ((uint16_t)ptr[1] << 8)); }
+
+
+static uint32_t fat_get32(uint8_t *ptr) { return(fat_get16(ptr) | ((uint32_t)fat_get16(ptr+2) << 16)); }
+
+
+static uint8_t fat_load(uint32_t block)
+{
+  if (block == fat_buffer_block) { return(true); }
+  if (!fat_block_read(block, fat_buffer)) {
+    fat_buffer_block = FAT_NO_BLOCK;
+    return(false);
+  }
+  fat_buffer_block = block;
+  return(true);
+}
+
+
+static uint32_t fat_cluster_block(uint32_t cluster) { return(fat_data_start + ((cluster-2) << fat_cluster_shift)); }
+
+
+// Returns the next cluster in the chain. Zero at the end of the chain or on a read error.
+static uint32_t fat_next_cluster(uint32_t cluster)
+{
+  uint32_t next;
+  if (fat_type == 16) {
+    if (!fat_load(fat_start + (cluster >> 8))) { return(0); }
+    next = fat_get16(&fat_buffer[(cluster & 0xFF) << 1]);
+    if (next >= 0xFFF8) { return(0); }
+  } else {
+    if (!fat_load(fat_start + (cluster >> 7))) { return(0); }
+    next = fat_get32(&fat_buffer[(cluster & 0x7F) << 2]) & 0x0FFFFFFF;
+    if (next >= 0x0FFFFFF8) { return(0); }
+  }
+  if (next < 2) { return(0); } // Free or reserved cluster. Broken chain.
+  return(next);
+}
+
+
+uint8_t fat_mount()
+{
+  fat_type = 0;
+  fat_buffer_block = FAT_NO_BLOCK;
+
+  // Block 0 is either the boot sector of an unpartitioned card or a partition table.
+  uint32_t volume_start = 0;
+  if (!fat_load(0) || (fat_get16(&fat_buffer[510]) != FAT_BOOT_SIGNATURE)) { return(false); }
+  if (!(((fat_buffer[0] == 0xEB) || (fat_buffer[0] == 0xE9)) && (fat_get16(&fat_buffer[11]) == FAT_BLOCK_SIZE))) {
+    volume_start = fat_get32(&fat_buffer[0x1C6]); // First partition entry
+    if (!fat_load(volume_start) || (fat_get16(&fat_buffer[510]) != FAT_BOOT_SIGNATURE)) { return(false); }
+  }
+
+  // BIOS parameter block
+  if (fat_get16(&fat_buffer[11]) != FAT_BLOCK_SIZE) { return(false); }
+  uint8_t blocks_per_cluster = fat_buffer[13];
+  fat_cluster_shift = 0;
+  while ((1 << fat_cluster_shift) < blocks_per_cluster) { fat_cluster_shift++; }
+  if (!blocks_per_cluster || ((1 << fat_cluster_shift) != blocks_per_cluster)) { return(false); }
+  uint16_t reserved_blocks = fat_get16(&fat_buffer[14]);
+  uint8_t n_fats = fat_buffer[16];
+  fat_root_entries = fat_get16(&fat_buffer[17]);
+  uint32_t total_blocks = fat_get16(&fat_buffer[19]);
+  if (!total_blocks) { total_blocks = fat_get32(&fat_buffer[32]); }
+  uint32_t fat_blocks = fat_get16(&fat_buffer[22]);
+  if (!fat_blocks) { fat_blocks = fat_get32(&fat_buffer[36]); }
+
+  fat_start = volume_start + reserved_blocks;
+  fat_root_start = fat_start + n_fats*fat_blocks;
+  fat_data_start = fat_root_start + (((uint32_t)fat_root_entries*FAT_DIR_ENTRY_SIZE + (FAT_BLOCK_SIZE-1)) / FAT_BLOCK_SIZE);
+  if (total_blocks <= (fat_data_start-volume_start)) { return(false); }
+
+  // The FAT type is defined by the cluster count only.
+  uint32_t clusters = (total_blocks - (fat_data_start-volume_start)) >> fat_cluster_shift;
+  if (clusters < 4085) { return(false); } // FAT12 not supported.
+  if (clusters < 65525) {
+    fat_type = 16;
+  } else {
+    fat_root_cluster = fat_get32(&fat_buffer[44]);
+    fat_type = 32;
+  }
+  return(true);
+}
+
+
+// Loads the block holding root directory entry index and returns the entry. NULL past the end of
+// the directory or on a read error.
+static uint8_t *fat_dir_entry(uint16_t index)
+{
+  uint32_t block;
+  uint16_t dir_block = index / (FAT_BLOCK_SIZE/FAT_DIR_ENTRY_SIZE);
+  if (fat_type == 16) {
+    if (index >= fat_root_entries) { return(NULL); }
+    block = fat_root_start + dir_block;
+  } else {
+    uint32_t cluster = fat_root_cluster;
+    uint16_t n = dir_block >> fat_cluster_shift;
+    while (n--) {
+      cluster = fat_next_cluster(cluster);
+      if (!cluster) { return(NULL); }
+    }
+    block = fat_cluster_block(cluster) + (dir_block & ((1 << fat_cluster_shift)-1));
+  }
+  if (!fat_load(block)) { return(NULL); }
+  return(&fat_buffer[(index % (FAT_BLOCK_SIZE/FAT_DIR_ENTRY_SIZE)) * FAT_DIR_ENTRY_SIZE]);
+}
+
+
+// Returns the next file entry, starting at entry *index. NULL at the end of the directory.
+static uint8_t *fat_dir_next_entry(uint16_t *index)
+{
+  if (!fat_type) { return(NULL); }
+  uint8_t *entry;
+  while ((entry = fat_dir_entry(*index)) != NULL) {
+    (*index)++;
+    if (entry[0] == 0) { return(NULL); } // End of directory
+    if (entry[0] == FAT_ENTRY_DELETED) { continue; }
+    if (entry[11] & (FAT_ATTR_VOLUME_ID|FAT_ATTR_DIRECTORY)) { continue; }
+    return(entry);
+  }
+  return(NULL);
+}
+
+
+// Converts the space padded 8.3 name of a directory entry to NAME.EXT.
+static void fat_entry_name(uint8_t *entry, char *name)
+{
+  uint8_t idx;
+  uint8_t n = 0;
+  for (idx=0; idx<8; idx++) {
+    if (entry[idx] != ' ') { name[n++] = entry[idx]; }
+  }
+  if (entry[8] != ' ') {
+    name[n++] = '.';
+    for (idx=8; idx<11; idx++) {
+      if (entry[idx] != ' ') { name[n++] = entry[idx]; }
+    }
+  }
+  name[n] = 0;
+}
+
+
+uint8_t fat_dir_next(uint16_t *index, char *name, uint32_t *size)
+{
+  uint8_t *entry = fat_dir_next_entry(index);
+  if (entry == NULL) { return(false); }
+  fat_entry_name(entry, name);
+  *size = fat_get32(&entry[28]);
+  return(true);
+}
+
+
+uint8_t fat_open(fat_file_t *file, const char *name)
+{
+  char entry_name[FAT_NAME_SIZE];
+  uint16_t index = 0;
+  uint8_t *entry;
+  while ((entry = fat_dir_next_entry(&index)) != NULL) {
+    fat_entry_name(entry, entry_name);
+    if (strcmp(entry_name, name) == 0) {
+      file->cluster = ((uint32_t)fat_get16(&entry[20]) << 16) | fat_get16(&entry[26]);
+      file->size = fat_get32(&entry[28]);
+      file->position = 0;
+      file->next_cluster = 0;
+      return(true);
+    }
+  }
+  return(false);
+}
+
+
+int16_t fat_read(fat_file_t *file)
+{
+  if (file->position >= file->size) { return(FAT_EOF); }
+  uint16_t offset = file->position % FAT_BLOCK_SIZE;
+  uint8_t cluster_block = (file->position / FAT_BLOCK_SIZE) & ((1 << fat_cluster_shift)-1);
+  if (!offset && !cluster_block && file->position) {
+    // First byte of the next cluster. Looked up at the last block of this one.
+    if (!file->next_cluster) { return(FAT_ERROR); }
+    file->cluster = file->next_cluster;
+  }
+  uint32_t block = fat_cluster_block(file->cluster) + cluster_block;
+  if (!offset) {
+    // First byte of a block. Read ahead the next block of the file, if there is one. At the last
+    // block of a cluster, that is the first block of the next cluster. It is looked up before
+    // the block is loaded, since the lookup loads the FAT into the same buffer.
+    uint32_t next_block = FAT_NO_BLOCK;
+    if ((file->size - file->position) > FAT_BLOCK_SIZE) {
+      if (cluster_block == ((1 << fat_cluster_shift)-1)) {
+        file->next_cluster = fat_next_cluster(file->cluster);
+        if (file->next_cluster) { next_block = fat_cluster_block(file->next_cluster); }
+      } else {
+        next_block = block+1;
+      }
+    }
+    if (!fat_load(block)) { return(FAT_ERROR); }
+    if (next_block != FAT_NO_BLOCK) { fat_block_read_ahead(next_block); }
+  } else if (!fat_load(block)) {
+    return(FAT_ERROR);
+  }
+  file->position++;
+  return(fat_buffer[offset]);
+}
+
+#endif
@@ -0,0 +1,36 @@
+/**
+ *  fat.h - Read-only FAT16/FAT32 file reader
+ * */
+
+#ifndef fat_h
+#define fat_h
+
+        #define FAT_BLOCK_SIZE 512
+        #define FAT_NAME_SIZE 13    // 8.3 name, dot, and terminator
+
+        // fat_read() results past the last byte
+        #define FAT_EOF -1
+        #define FAT_ERROR -2
+
+        typedef struct {
+          uint32_t size;            // File size in bytes
+          uint32_t position;        // Next byte to read
+          uint32_t cluster;         // Cluster holding the next byte
+          uint32_t next_cluster;    // Following cluster, once the last block of the cluster is read. Zero at the end.
+        } fat_file_t;
+
+        // Block device read used by the reader. Reads one FAT_BLOCK_SIZE block and returns true on
+        // success. Implemented by the SD card driver. The reader has no other hardware dependency,
+        // so it builds on a host against a file-backed disk image with another implementation.
+        uint8_t fat_block_read(uint32_t block, uint8_t *buf);
+
+        // Hint that the block is read next. The driver may start reading it into a buffer of its
+        // own, for the fat_block_read() that follows.
+        void fat_block_read_ahead(uint32_t block);
+
+        uint8_t fat_mount();                                            // Mount first volume. Returns true on success.
+        uint8_t fat_dir_next(uint16_t *index, char *name, uint32_t *size); // Next root directory file from entry *index. False at end.
+        uint8_t fat_open(fat_file_t *file, const char *name);           // Open root directory file by 8.3 name. Returns true on success.
+        int16_t fat_read(fat_file_t *file);                             // Next file byte, FAT_EOF, or FAT_ERROR
+
+#endif
@@ -114,6 +114,11 @@ uint8_t gc_execute_line(char *line)
 
   if (gc_parser_flags & GC_PARSER_JOG_MOTION) { char_counter = 3; } // Start parsing after `$J=`
   else { char_counter = 0; }
+  #ifdef GC_TOKENIZED_BLOCKS
+    // Pre-tokenized blocks hold the word values in float form. No number parsing needed.
+    uint8_t is_tokenized_block = ((uint8_t)line[0] == GC_TOKENIZED_BLOCK_MARKER);
+    if (is_tokenized_block) { char_counter = 1; }
+  #endif
 // Added ignore process blocks M command implemented
   while (line[char_counter] != 0 && !(letter=='M' && (int_value==17 || int_value==18 || int_value==42 || int_value==219 || (int_value>=227 && int_value<=233)))) { // Loop until no more g-code words in line.
 
@@ -121,6 +126,12 @@ uint8_t gc_execute_line(char *line)
     letter = line[char_counter];
     if((letter < 'A') || (letter > 'Z')) { FAIL(STATUS_EXPECTED_COMMAND_LETTER); } // [Expected word letter]
     char_counter++;
+    #ifdef GC_TOKENIZED_BLOCKS
+      if (is_tokenized_block) {
+        memcpy(&value, &line[char_counter], sizeof(float)); // Value already in float form.
+        char_counter += sizeof(float);
+      } else
+    #endif
     if (!read_float(line, &char_counter, &value)) { FAIL(STATUS_BAD_NUMBER_FORMAT); } // [Expected word value]
 
     // Convert values to smaller uint8 significand and mantissa values for parsing this word.
@@ -134,6 +145,14 @@ uint8_t gc_execute_line(char *line)
     mantissa =  round(100*(value - int_value)); // Compute mantissa for Gxx.x commands.
     // NOTE: Rounding must be used to catch small floating point errors.
 
+    #ifdef GC_TOKENIZED_BLOCKS
+      // The stepper and pin M-commands re-parse the text line themselves. ASCII lines only.
+      if (is_tokenized_block && (letter == 'M') && ((int_value == 17) || (int_value == 18) || (int_value == 42) ||
+                                                 (int_value == 219) || (int_value == 226) || (int_value == 227))) {
+        FAIL(STATUS_GCODE_UNSUPPORTED_COMMAND);
+      }
+    #endif
+
     // Check if the g-code word is supported or errors due to modal group violations or has
     // been repeated in the g-code block. If ok, update the command or record its value.
     switch(letter) {
@@ -349,6 +368,14 @@ uint8_t gc_execute_line(char *line)
           case 233:
             movementRestore();
           break;
+          //-----------------------------------
+          // Implementing M234, M235
+          //-----------------------------------
+          case 234: case 235:
+            word_bit = MODAL_GROUP_M10;
+            if (int_value == 234) { gc_block.modal.thc = THC_ENABLE; }
+            else { gc_block.modal.thc = THC_DISABLE; }
+          break;
           default: FAIL(STATUS_GCODE_UNSUPPORTED_COMMAND); // [Unsupported M command]
         }
 
@@ -1020,6 +1047,11 @@ uint8_t gc_execute_line(char *line)
   }
   pl_data->condition |= gc_state.modal.coolant; // Set condition flag for planner use.
 
+  // [8.5. Torch height control ]: Carried by the planner blocks. The stepper engages the THC as
+  // the motions run, so no buffer sync is needed.
+  gc_state.modal.thc = gc_block.modal.thc;
+  if (gc_state.modal.thc == THC_ENABLE) { pl_data->thc_flags |= PL_THC_FLAG_ENABLE; }
+
   // [9. Override control ]: NOT SUPPORTED. Always enabled. Except for a Grbl-only parking control.
   #ifdef ENABLE_PARKING_OVERRIDE_CONTROL
     if (gc_state.modal.override != gc_block.modal.override) {
@@ -1164,6 +1196,7 @@ uint8_t gc_execute_line(char *line)
       gc_state.modal.coord_select = 0; // G54
       gc_state.modal.spindle = SPINDLE_DISABLE;
       gc_state.modal.coolant = COOLANT_DISABLE;
+      gc_state.modal.thc = THC_DISABLE;
       #ifdef ENABLE_PARKING_OVERRIDE_CONTROL
         #ifdef DEACTIVATE_PARKING_UPON_INIT
           gc_state.modal.override = OVERRIDE_DISABLED;
@@ -1185,6 +1218,9 @@ uint8_t gc_execute_line(char *line)
         spindle_set_state(SPINDLE_DISABLE,0.0);
         coolant_set_state(COOLANT_DISABLE);
       }
+      #ifdef ENABLE_RUN_TIME_ESTIMATOR
+        else { report_run_time_estimate(); }
+      #endif
       report_feedback_message(MESSAGE_PROGRAM_END);
     }
     gc_state.modal.program_flow = PROGRAM_FLOW_RUNNING; // Reset program flow.
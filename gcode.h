@@ -45,6 +45,7 @@
 #define MODAL_GROUP_M7 12 // [M3,M4,M5] Spindle turning
 #define MODAL_GROUP_M8 13 // [M7,M8,M9] Coolant control
 #define MODAL_GROUP_M9 14 // [M56] Override control
+#define MODAL_GROUP_M10 15 // [M234,M235] Torch height control
 
 // Define command actions for within execution-type modal groups (motion, stopping, non-modal). Used
 // internally by the parser to know which command to execute.
@@ -119,6 +120,10 @@
 #define COOLANT_FLOOD_ENABLE  PL_COND_FLAG_COOLANT_FLOOD // M8 (NOTE: Uses planner condition bit flag)
 #define COOLANT_MIST_ENABLE   PL_COND_FLAG_COOLANT_MIST  // M7 (NOTE: Uses planner condition bit flag)
 
+// Modal Group M10: Torch height control
+#define THC_DISABLE 0 // M235 (Default: Must be zero)
+#define THC_ENABLE 1 // M234
+
 // Modal Group G8: Tool length offset
 #define TOOL_LENGTH_OFFSET_CANCEL 0 // G49 (Default: Must be zero)
 #define TOOL_LENGTH_OFFSET_ENABLE_DYNAMIC 1 // G43.1
@@ -178,6 +183,16 @@
 #define GC_PARSER_LASER_ISMOTION        bit(7)
 
 
+// Pre-tokenized g-code blocks start with this marker, followed by 5-byte words (the word letter and
+// its float value) and a zero terminator. Produced by the binary frame channel and the incremental
+// line tokenizer. See ENABLE_BINARY_FRAMING and ENABLE_INCREMENTAL_TOKENIZER in config.h.
+#if defined(ENABLE_BINARY_FRAMING) || defined(ENABLE_INCREMENTAL_TOKENIZER)
+  #define GC_TOKENIZED_BLOCKS
+  #define GC_TOKENIZED_BLOCK_MARKER CMD_BINARY_FRAME
+  #define GC_TOKENIZED_WORD_SIZE    (1+sizeof(float))
+#endif
+
+
 // NOTE: When this struct is zeroed, the above defines set the defaults for the system.
 typedef struct {
   uint8_t motion;          // {G0,G1,G2,G3,G38.2,G80}
@@ -194,6 +209,7 @@ typedef struct {
   uint8_t coolant;         // {M7,M8,M9}
   uint8_t spindle;         // {M3,M4,M5}
   uint8_t override;        // {M56}
+  uint8_t thc;             // {M234,M235}
 } gc_modal_t;
 
 typedef struct {
@@ -31,6 +31,7 @@
 #include <avr/interrupt.h>
 #include <avr/wdt.h>
 #include <util/delay.h>
+#include <util/crc16.h>
 #include <math.h>
 #include <inttypes.h>
 #include <string.h>
@@ -61,6 +62,7 @@
 #include "stepper.h"
 #include "jog.h"
 #include "sleep.h"
+#include "estimator.h"
 
 // THC Integration features
 #include "adc.h"
@@ -68,6 +70,9 @@
 #include "thc.h"
 #include "thc_reports.h"
 #include "ports.h"
+#include "fat.h"
+#include "sd_card.h"
+#include "sd_job.h"
 
 // ---------------------------------------------------------------------------------------
 // COMPILE-TIME ERROR CHECKING OF DEFINE VALUES:
@@ -107,6 +112,14 @@
   #error "Override refresh must be greater than zero."
 #endif
 
+#if (REPORT_TX_LINE_SIZE > TX_BUFFER_SIZE)
+  #error "REPORT_TX_LINE_SIZE must fit in the TX buffer."
+#endif
+
+#if defined(ENABLE_XONXOFF) && defined(ENABLE_RTS_FLOW_CONTROL)
+  #error "ENABLE_XONXOFF and ENABLE_RTS_FLOW_CONTROL can't be used together."
+#endif
+
 // ---------------------------------------------------------------------------------------
 
 #endif
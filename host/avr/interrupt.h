@@ -0,0 +1,16 @@
+/**
+ *  avr/interrupt.h - Interrupts for the host build
+ *  Interrupt handlers become plain functions named after their vector, so the host programs can call
+ *  them. Nothing interrupts the host programs, so sei() and cli() only track the SREG I bit.
+ * */
+
+#ifndef host_avr_interrupt_h
+#define host_avr_interrupt_h
+
+#include <avr/io.h>
+
+#define ISR(vector, ...) void vector(void)
+#define sei() (SREG |= (1<<SREG_I))
+#define cli() (SREG &= ~(1<<SREG_I))
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ *  avr/io.h - ATmega2560 registers for the host build
+ *  Registers are plain memory, defined in hal.c. Bit numbers are those of the ATmega2560, so the
+ *  Grbl sources build unchanged. Nothing happens on a register write. hal.c and the host programs
+ *  call the interrupt handlers themselves.
+ * */
+
+#ifndef host_avr_io_h
+#define host_avr_io_h
+
+#include <stdint.h>
+
+#define HOST_REGISTERS_8 \
+  R(PINA) R(DDRA) R(PORTA) R(PINB) R(DDRB) R(PORTB) R(PINC) R(DDRC) R(PORTC) \
+  R(PIND) R(DDRD) R(PORTD) R(PINE) R(DDRE) R(PORTE) R(PINF) R(DDRF) R(PORTF) \
+  R(PING) R(DDRG) R(PORTG) R(PINH) R(DDRH) R(PORTH) R(PINJ) R(DDRJ) R(PORTJ) \
+  R(PINK) R(DDRK) R(PORTK) R(PINL) R(DDRL) R(PORTL) \
+  R(SREG) R(MCUSR) R(SMCR) R(WDTCSR) R(PRR0) R(PRR1) \
+  R(EECR) R(EEDR) R(EICRA) R(EICRB) R(EIMSK) R(PCICR) R(PCMSK0) R(PCMSK1) R(PCMSK2) \
+  R(TCCR0A) R(TCCR0B) R(TCNT0) R(OCR0A) R(OCR0B) R(TIMSK0) R(TIFR0) \
+  R(TCCR1A) R(TCCR1B) R(TCCR1C) R(TIMSK1) R(TIFR1) \
+  R(TCCR2A) R(TCCR2B) R(TCNT2) R(OCR2A) R(OCR2B) R(TIMSK2) R(TIFR2) R(ASSR) \
+  R(TCCR3A) R(TCCR3B) R(TCCR3C) R(TIMSK3) R(TIFR3) \
+  R(TCCR4A) R(TCCR4B) R(TCCR4C) R(TIMSK4) R(TIFR4) \
+  R(TCCR5A) R(TCCR5B) R(TCCR5C) R(TIMSK5) R(TIFR5) \
+  R(ADCSRA) R(ADCSRB) R(ADMUX) R(ADCL) R(ADCH) R(DIDR0) R(DIDR2) \
+  R(SPCR) R(SPSR) R(SPDR) \
+  R(UCSR0A) R(UCSR0B) R(UCSR0C) R(UBRR0L) R(UBRR0H) R(UDR0) \
+  R(UCSR1A) R(UCSR1B) R(UCSR1C) R(UBRR1L) R(UBRR1H) R(UDR1) \
+  R(UCSR2A) R(UCSR2B) R(UCSR2C) R(UBRR2L) R(UBRR2H) R(UDR2) \
+  R(UCSR3A) R(UCSR3B) R(UCSR3C) R(UBRR3L) R(UBRR3H) R(UDR3)
+
+#define HOST_REGISTERS_16 \
+  R(TCNT1) R(OCR1A) R(OCR1B) R(OCR1C) R(ICR1) \
+  R(TCNT3) R(OCR3A) R(OCR3B) R(OCR3C) R(ICR3) \
+  R(TCNT4) R(OCR4A) R(OCR4B) R(OCR4C) R(ICR4) \
+  R(TCNT5) R(OCR5A) R(OCR5B) R(OCR5C) R(ICR5) \
+  R(ADC) R(EEAR) R(UBRR0) R(UBRR1) R(UBRR2) R(UBRR3)
+
+#define R(name) extern volatile uint8_t name;
+HOST_REGISTERS_8
+#undef R
+#define R(name) extern volatile uint16_t name;
+HOST_REGISTERS_16
+#undef R
+#define ADCW ADC
+
+// Port bits
+#define PA0 0
+#define PA1 1
+#define PA2 2
+#define PA3 3
+#define PA4 4
+#define PA5 5
+#define PA6 6
+#define PA7 7
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+#define PC7 7
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+#define PE0 0
+#define PE1 1
+#define PE2 2
+#define PE3 3
+#define PE4 4
+#define PE5 5
+#define PE6 6
+#define PE7 7
+#define PF0 0
+#define PF1 1
+#define PF2 2
+#define PF3 3
+#define PF4 4
+#define PF5 5
+#define PF6 6
+#define PF7 7
+#define PG0 0
+#define PG1 1
+#define PG2 2
+#define PG3 3
+#define PG4 4
+#define PG5 5
+#define PH0 0
+#define PH1 1
+#define PH2 2
+#define PH3 3
+#define PH4 4
+#define PH5 5
+#define PH6 6
+#define PH7 7
+#define PJ0 0
+#define PJ1 1
+#define PJ2 2
+#define PJ3 3
+#define PJ4 4
+#define PJ5 5
+#define PJ6 6
+#define PJ7 7
+#define PK0 0
+#define PK1 1
+#define PK2 2
+#define PK3 3
+#define PK4 4
+#define PK5 5
+#define PK6 6
+#define PK7 7
+#define PL0 0
+#define PL1 1
+#define PL2 2
+#define PL3 3
+#define PL4 4
+#define PL5 5
+#define PL6 6
+#define PL7 7
+
+// Status, sleep and watchdog
+#define SREG_I 7
+#define SE 0
+#define SM0 1
+#define SM1 2
+#define SM2 3
+#define WDP0 0
+#define WDP1 1
+#define WDP2 2
+#define WDE 3
+#define WDCE 4
+#define WDP3 5
+#define WDIE 6
+#define WDIF 7
+
+// EEPROM
+#define EERE 0
+#define EEPE 1
+#define EEMPE 2
+#define EERIE 3
+#define EEWE EEPE
+#define EEMWE EEMPE
+
+// External and pin change interrupts
+#define INT0 0
+#define INT1 1
+#define INT2 2
+#define INT3 3
+#define INT4 4
+#define INT5 5
+#define INT6 6
+#define INT7 7
+#define PCIE0 0
+#define PCIE1 1
+#define PCIE2 2
+
+// Timers. Timers 1, 3, 4 and 5 share the bit layout.
+#define WGM00 0
+#define WGM01 1
+#define COM0B0 4
+#define COM0B1 5
+#define COM0A0 6
+#define COM0A1 7
+#define CS00 0
+#define CS01 1
+#define CS02 2
+#define WGM02 3
+#define TOIE0 0
+#define OCIE0A 1
+#define OCIE0B 2
+#define TOV0 0
+#define OCF0A 1
+#define OCF0B 2
+#define WGM20 0
+#define WGM21 1
+#define COM2B0 4
+#define COM2B1 5
+#define COM2A0 6
+#define COM2A1 7
+#define CS20 0
+#define CS21 1
+#define CS22 2
+#define WGM22 3
+#define TOIE2 0
+#define OCIE2A 1
+#define OCIE2B 2
+#define TOV2 0
+
+#define HOST_TIMER16_BITS(n) \
+  enum { WGM##n##0 = 0, WGM##n##1 = 1, COM##n##C0 = 2, COM##n##C1 = 3, COM##n##B0 = 4, COM##n##B1 = 5, \
+         COM##n##A0 = 6, COM##n##A1 = 7, CS##n##0 = 0, CS##n##1 = 1, CS##n##2 = 2, WGM##n##2 = 3, \
+         WGM##n##3 = 4, ICES##n = 6, ICNC##n = 7, TOIE##n = 0, OCIE##n##A = 1, OCIE##n##B = 2, \
+         OCIE##n##C = 3, ICIE##n = 5, TOV##n = 0, OCF##n##A = 1, OCF##n##B = 2, OCF##n##C = 3, ICF##n = 5 };
+HOST_TIMER16_BITS(1)
+HOST_TIMER16_BITS(3)
+HOST_TIMER16_BITS(4)
+HOST_TIMER16_BITS(5)
+
+// ADC
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE 3
+#define ADIF 4
+#define ADATE 5
+#define ADSC 6
+#define ADEN 7
+#define MUX0 0
+#define MUX1 1
+#define MUX2 2
+#define MUX3 3
+#define MUX4 4
+#define ADLAR 5
+#define REFS0 6
+#define REFS1 7
+#define ADTS0 0
+#define ADTS1 1
+#define ADTS2 2
+#define MUX5 3
+#define ACME 6
+
+// SPI
+#define SPR0 0
+#define SPR1 1
+#define CPHA 2
+#define CPOL 3
+#define MSTR 4
+#define DORD 5
+#define SPE 6
+#define SPIE 7
+#define SPI2X 0
+#define WCOL 6
+#define SPIF 7
+
+// USARTs share the bit layout.
+#define HOST_USART_BITS(n) \
+  enum { MPCM##n = 0, U2X##n = 1, UPE##n = 2, DOR##n = 3, FE##n = 4, UDRE##n = 5, TXC##n = 6, RXC##n = 7, \
+         TXB8##n = 0, RXB8##n = 1, UCSZ##n##2 = 2, TXEN##n = 3, RXEN##n = 4, UDRIE##n = 5, TXCIE##n = 6, \
+         RXCIE##n = 7, UCPOL##n = 0, UCSZ##n##0 = 1, UCSZ##n##1 = 2, USBS##n = 3, UPM##n##0 = 4, \
+         UPM##n##1 = 5, UMSEL##n##0 = 6, UMSEL##n##1 = 7 };
+HOST_USART_BITS(0)
+HOST_USART_BITS(1)
+HOST_USART_BITS(2)
+HOST_USART_BITS(3)
+
+#endif
@@ -0,0 +1,18 @@
+/**
+ *  avr/pgmspace.h - Program memory for the host build. Flash data is ordinary memory.
+ * */
+
+#ifndef host_avr_pgmspace_h
+#define host_avr_pgmspace_h
+
+#include <stdint.h>
+
+#define PROGMEM
+#define __flash
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_byte_near(p) pgm_read_byte(p)
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+
+#endif
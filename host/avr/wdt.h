@@ -0,0 +1,12 @@
+/**
+ *  avr/wdt.h - Watchdog for the host build. There is no watchdog.
+ * */
+
+#ifndef host_avr_wdt_h
+#define host_avr_wdt_h
+
+#define wdt_reset()
+#define wdt_disable()
+#define wdt_enable(timeout)
+
+#endif
@@ -0,0 +1,608 @@
+/**
+ *  bench.c - Planner and step segment throughput benchmark
+ *  Replays a g-code file through the unmodified protocol, parser, planner and step segment generator,
+ *  built against the mocked HAL. The file is streamed like a character counting sender over a serial
+ *  link of the given baud rate. The stepper and Timer2 interrupts are run in simulated machine time,
+ *  and the main program is assumed to call st_prep_buffer() before every step. So the only limits on
+ *  the motion are the planner lookahead and the serial link, as on a machine with an idle main loop.
+ *
+ *  Reports the host time spent per planner block and per step segment, the lookahead depth over the
+ *  machine time, and the planner starvation events: the planner running down to the executing block,
+ *  and the motion stopping for lack of blocks, while there is g-code left outside a buffer sync.
+ *
+ *  The planned entry speed of each executed block can be written to a file, and compared with such a
+ *  file from another build. `make compare` uses this to check the fixed-point planner against the float
+ *  planner. See ENABLE_FIXED_POINT_PLANNER in config.h.
+ *
+ *  Built with ENABLE_BINARY_FRAMING, the g-code lines can be sent as binary frames instead, except for
+ *  those the frame channel doesn't take. `make framing` compares the link and host line rates of
+ *  both. The host line time is all the host time not spent in the planner or the machine simulation,
+ *  i.e. the protocol, the g-code parser and the sender. It is only meaningful in the check mode with
+ *  an instant link, as the timing of the many short machine calls costs more host time than a line.
+ *
+ *  The line latency is the host time from reading the end of a text line to its first motion being
+ *  passed to mc_line(), without the machine simulation and step segment prep in between. The wait
+ *  for a free planner block in mc_line() is left out, as it depends on the motion and not the line.
+ *  `make latency` compares it with and without ENABLE_INCREMENTAL_TOKENIZER.
+ * */
+
+#include <stdio.h>
+#include <time.h>
+#include <ctype.h>
+#include "grbl.h"
+#include "hal.h"
+
+#define BENCH_LINE_MAX 256
+
+// Wrapped functions. Linked with -Wl,--wrap=<function>. See the Makefile.
+void __real_protocol_execute_realtime();
+void __real_protocol_buffer_synchronize();
+uint8_t __real_plan_buffer_line(float *target, plan_line_data_t *pl_data);
+void __real_mc_line(float *target, plan_line_data_t *pl_data);
+uint8_t __real_plan_buffer_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+  float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear);
+void __real_st_prep_buffer();
+void __real_plan_discard_current_block();
+
+int grbl_main(); // main() of main.c
+
+// G-code file and the character counting sender
+static char *gcode;
+static uint32_t gcode_size;
+static uint16_t *message_length;      // Length of each line or frame, when sending frames
+static uint32_t frames;               // Lines sent as binary frames
+static uint32_t send_position;        // Next file byte to send
+static uint32_t lines_sent;
+static uint32_t lines_acked;
+static uint32_t errors;
+static uint16_t inflight_bytes;       // Sent bytes of lines not acknowledged yet
+static uint16_t inflight_length[RX_BUFFER_SIZE]; // Lengths of those lines, oldest first
+static uint16_t inflight_head, inflight_tail;
+static uint32_t baud_rate = 115200;   // Zero for an instant link
+static double tx_time;                // Machine time the last sent byte finishes arriving
+
+// Bytes on the way to Grbl, with their arrival times
+static uint8_t rx_data[RX_BUFFER_SIZE+1];
+static double rx_time[RX_BUFFER_SIZE+1];
+static uint16_t rx_head, rx_tail;
+static uint8_t rx_idle_polled;        // Last read returned no data, so the main loop has idled once.
+
+// Grbl output line being received
+static char response[BENCH_LINE_MAX];
+static uint8_t response_length;
+static uint8_t verbose;
+static uint8_t check_mode;            // Lines are sent after a $C, so nothing is planned or run.
+static uint32_t repeat = 1;           // File copies sent
+
+// Simulated machine time
+static double sim_time;               // Seconds
+static double timer2_time;            // Next Timer2 overflow
+static uint8_t stepper_running;
+static uint8_t in_sync;               // Inside protocol_buffer_synchronize()
+static uint64_t step_ticks;           // Stepper interrupts. AMASS adds interrupts without steps.
+static uint8_t planner_full;          // More than the executing block is planned.
+static uint32_t planner_dry;          // Planner ran down to the executing block
+static uint32_t planner_stops;        // Motion stopped for lack of blocks
+
+// Lookahead depth samples
+static FILE *depth_file;
+static double sample_interval = 0.01;
+static double sample_time;
+static uint32_t depth_samples;
+static uint64_t depth_sum;
+static uint8_t depth_min = 0xFF, depth_max;
+
+// Block entry speeds written, or compared with a reference run
+static FILE *dump_file;
+static FILE *reference_file;
+static uint32_t blocks_executed;
+static uint32_t reference_mismatch;   // Blocks beyond the end of the reference, or missing from this run
+static double speed_error_max;        // mm/min
+static double speed_error_max_reference;
+static uint32_t speed_error_max_block;
+static double speed_error_sum_sqr;
+
+// Host time
+static uint32_t plan_calls;
+static double plan_seconds, plan_max_seconds;
+static double prep_seconds;
+static double machine_seconds;        // Stepper and Timer2 interrupts
+static uint8_t eol_pending;           // End of line read, and its block not planned yet
+static double eol_start;              // Host time of the end of line, less the machine and prep time
+static uint32_t eol_count;
+static double eol_sum, eol_max;
+static struct timespec start_clock;
+
+
+static double host_seconds()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return((now.tv_sec - start_clock.tv_sec) + (now.tv_nsec - start_clock.tv_nsec)*1e-9);
+}
+
+
+static void sample_depth()
+{
+  if (!stepper_running) { return; }
+  uint8_t depth = plan_get_block_buffer_count();
+  depth_samples++;
+  depth_sum += depth;
+  if (depth < depth_min) { depth_min = depth; }
+  if (depth > depth_max) { depth_max = depth; }
+  if (depth_file) { fprintf(depth_file, "%.4f,%u,%.3f\n", sim_time, depth, plan_get_buffer_millimeters()); }
+}
+
+
+// Runs the Timer2 interrupt up to the current machine time.
+static void timer2_run()
+{
+  while (timer2_time <= sim_time) {
+    TIMER2_OVF_vect();
+    timer2_time += TIMER_TICK_US*1e-6;
+  }
+  while (sample_time <= sim_time) {
+    sample_depth();
+    sample_time += sample_interval;
+  }
+}
+
+
+// Preps segments and runs one stepper interrupt. Advances the machine time by the step period.
+static void sim_step()
+{
+  st_prep_buffer();
+  double start = host_seconds();
+  TIMER1_COMPA_vect();
+  step_ticks++;
+  uint8_t prescaler = TCCR1B & 0x07;
+  sim_time += (double)OCR1A*(prescaler == 3 ? 64 : (prescaler == 2 ? 8 : 1))/F_CPU;
+  timer2_run();
+  machine_seconds += host_seconds() - start;
+
+  // Outside a buffer sync, with g-code still to run, the planner must not run out of blocks.
+  uint8_t starving = !in_sync && ((lines_acked < lines_sent) || (send_position < gcode_size));
+  uint8_t depth = plan_get_block_buffer_count();
+  if (starving && planner_full && (depth <= 1)) { planner_dry++; }
+  planner_full = (depth > 1);
+  if (!(TIMSK1 & (1<<OCIE1A))) {
+    stepper_running = false;
+    if (starving) { planner_stops++; }
+  }
+}
+
+
+// Runs the machine up to the given time.
+static void sim_run(double until)
+{
+  while (sim_time < until) {
+    stepper_running = (TIMSK1 & (1<<OCIE1A)) != 0;
+    if (!stepper_running) {
+      double start = host_seconds();
+      sim_time = until;
+      timer2_run();
+      machine_seconds += host_seconds() - start;
+      return;
+    }
+    sim_step();
+  }
+}
+
+
+static void report()
+{
+  double machine_time = sim_time;
+  double line_seconds = host_seconds() - machine_seconds - prep_seconds - plan_seconds;
+  uint32_t link_baud = baud_rate ? baud_rate : 115200;
+  printf("lines      %u sent, %u as binary frames, %u errors\n", lines_sent, frames, errors);
+  printf("link       %u bytes, %.1f bytes/line, %.0f lines/s at %u baud\n", gcode_size,
+    lines_sent ? (double)gcode_size/lines_sent : 0.0, gcode_size ? lines_sent*link_baud/(10.0*gcode_size) : 0.0,
+    link_baud);
+  printf("host line  %.2f us avg, %.0f lines/s host\n", lines_sent ? 1e6*line_seconds/lines_sent : 0.0,
+    line_seconds > 0.0 ? lines_sent/line_seconds : 0.0);
+  printf("latency    %u lines, %.2f us avg, %.2f us max from end of line to mc_line()\n", eol_count,
+    eol_count ? 1e6*eol_sum/eol_count : 0.0, 1e6*eol_max);
+  printf("machine    %.3f s, %llu stepper interrupts\n", machine_time, (unsigned long long)step_ticks);
+  printf("blocks     %u, %.2f us avg, %.2f us max, %.0f blocks/s host, %.1f blocks/s machine\n",
+    plan_calls, plan_calls ? 1e6*plan_seconds/plan_calls : 0.0, 1e6*plan_max_seconds,
+    plan_seconds > 0.0 ? plan_calls/plan_seconds : 0.0, machine_time > 0.0 ? plan_calls/machine_time : 0.0);
+  printf("segments   %u, %.2f us avg, %.0f segments/s host, %.1f segments/s machine\n",
+    sys_debug_segment_count, sys_debug_segment_count ? 1e6*prep_seconds/sys_debug_segment_count : 0.0,
+    prep_seconds > 0.0 ? sys_debug_segment_count/prep_seconds : 0.0,
+    machine_time > 0.0 ? sys_debug_segment_count/machine_time : 0.0);
+  printf("lookahead  %u min, %.1f avg, %u max blocks of %u\n", depth_samples ? depth_min : 0,
+    depth_samples ? (double)depth_sum/depth_samples : 0.0, depth_max, BLOCK_BUFFER_SIZE-1);
+  printf("replan     %u blocks, %.2f per insert, %u max\n", sys_debug_replan_blocks,
+    plan_calls ? (double)sys_debug_replan_blocks/plan_calls : 0.0, sys_debug_replan_max);
+  printf("starved    %u planner runouts, %u motion stops, %u segment buffer underruns\n", planner_dry,
+    planner_stops, sys_debug_starve_count);
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    printf("s-curve    %.3f peak acceleration, %.3f jerk, of the block limits at most\n",
+      sys_debug_scurve_accel_max, sys_debug_scurve_jerk_max);
+  #endif
+  if (reference_file) {
+    float reference;
+    while (fscanf(reference_file, "%f", &reference) == 1) { reference_mismatch++; }
+    printf("entry      %.3f mm/min max error (%.3f mm/min planned) at block %u, %.3f mm/min rms, %u blocks differ\n",
+      speed_error_max, speed_error_max_reference, speed_error_max_block,
+      blocks_executed ? sqrt(speed_error_sum_sqr/blocks_executed) : 0.0, reference_mismatch);
+  }
+}
+
+
+// Sends the next lines, as long as the RX buffer has room for them.
+static void sender_fill()
+{
+  while (send_position < gcode_size) {
+    uint32_t end = send_position;
+    if (message_length) { end += message_length[lines_sent]; }
+    else { while ((end < gcode_size) && (gcode[end++] != '\n')) { } }
+    uint16_t length = end - send_position;
+    if (length >= RX_BUFFER_SIZE) {
+      fprintf(stderr, "bench: line %u longer than the RX buffer\n", lines_sent+1);
+      exit(1);
+    }
+    if (inflight_bytes + length > RX_BUFFER_SIZE) { return; }
+    inflight_bytes += length;
+    inflight_length[inflight_head] = length;
+    if (++inflight_head == RX_BUFFER_SIZE) { inflight_head = 0; }
+    lines_sent++;
+    if (tx_time < sim_time) { tx_time = sim_time; }
+    for (; send_position < end; send_position++) {
+      if (baud_rate) { tx_time += 10.0/baud_rate; } // 8N1
+      rx_data[rx_head] = gcode[send_position];
+      rx_time[rx_head] = tx_time;
+      if (++rx_head > RX_BUFFER_SIZE) { rx_head = 0; }
+    }
+  }
+}
+
+
+// Serial input of Grbl. Waits in machine time for the next byte, after letting the main loop idle once.
+static uint8_t bench_serial_read()
+{
+  sender_fill();
+  if (rx_tail == rx_head) {
+    if ((send_position == gcode_size) && (lines_acked == lines_sent) && !plan_get_current_block() &&
+        ((sys.state == STATE_IDLE) || (sys.state == STATE_CHECK_MODE))) {
+      report();
+      if (depth_file) { fclose(depth_file); }
+      if (dump_file) { fclose(dump_file); }
+      exit(errors ? 2 : 0);
+    }
+    if (rx_idle_polled) { sim_run(sim_time + 0.001); }
+    rx_idle_polled = !rx_idle_polled;
+    return(SERIAL_NO_DATA);
+  }
+  if (rx_time[rx_tail] > sim_time) {
+    if (!rx_idle_polled) {
+      rx_idle_polled = true;
+      return(SERIAL_NO_DATA);
+    }
+    sim_run(rx_time[rx_tail]);
+  }
+  rx_idle_polled = false;
+  uint8_t data = rx_data[rx_tail];
+  if (++rx_tail > RX_BUFFER_SIZE) { rx_tail = 0; }
+  if ((data == '\n') && !message_length) {
+    eol_pending = true;
+    eol_start = host_seconds() - machine_seconds - prep_seconds;
+  }
+  return(data);
+}
+
+
+// Bytes arrived for the binary frame reader. Waits in machine time for the next byte of the frame.
+static uint8_t bench_serial_available()
+{
+  if (rx_tail == rx_head) { return(0); }
+  if (rx_time[rx_tail] > sim_time) { sim_run(rx_time[rx_tail]); }
+  return((rx_head + (RX_BUFFER_SIZE+1) - rx_tail) % (RX_BUFFER_SIZE+1));
+}
+
+
+// Serial output of Grbl. Each ok or error acknowledges the oldest line sent.
+static void bench_serial_write(uint8_t data)
+{
+  if (verbose) { putchar(data); }
+  if (data != '\n') {
+    if (response_length < BENCH_LINE_MAX-1) { response[response_length++] = data; }
+    return;
+  }
+  response[response_length] = 0;
+  response_length = 0;
+  uint8_t is_error = (strncmp(response, "error:", 6) == 0);
+  if (!is_error && (strncmp(response, "ok", 2) != 0)) { return; }
+  if (inflight_head == inflight_tail) { return; } // Not for a line, such as a startup line error.
+  if (is_error) {
+    errors++;
+    if (!verbose) { fprintf(stderr, "bench: line %u %s", lines_acked+1, response); }
+  }
+  inflight_bytes -= inflight_length[inflight_tail];
+  if (++inflight_tail == RX_BUFFER_SIZE) { inflight_tail = 0; }
+  lines_acked++;
+}
+
+
+static void bench_delay(double us) { sim_run(sim_time + us*1e-6); }
+
+
+static uint8_t planner_buffers_full()
+{
+  #ifdef ENABLE_PLANNER_ARCS
+    if (plan_check_full_arc_buffer()) { return(true); }
+  #endif
+  return(plan_check_full_buffer());
+}
+
+
+// Also called by mc_line() and mc_buffer_arc() while the planner buffer is full. Runs the machine
+// until a block is freed.
+void __wrap_protocol_execute_realtime()
+{
+  __real_protocol_execute_realtime();
+  while (planner_buffers_full() && (TIMSK1 & (1<<OCIE1A))) {
+    stepper_running = true;
+    sim_step();
+  }
+}
+
+
+// Same as protocol_buffer_synchronize(), but runs the machine while waiting.
+void __wrap_protocol_buffer_synchronize()
+{
+  if (sys.state == STATE_CHECK_MODE) {
+    __real_protocol_buffer_synchronize();
+    return;
+  }
+  in_sync = true;
+  protocol_auto_cycle_start();
+  do {
+    __real_protocol_execute_realtime();
+    if (sys.abort) { break; }
+    if (TIMSK1 & (1<<OCIE1A)) {
+      stepper_running = true;
+      sim_step();
+    }
+  } while (plan_get_current_block() || (sys.state == STATE_CYCLE));
+  in_sync = false;
+}
+
+
+void __wrap_mc_line(float *target, plan_line_data_t *pl_data)
+{
+  if (eol_pending) {
+    double latency = host_seconds() - machine_seconds - prep_seconds - eol_start;
+    eol_pending = false;
+    eol_count++;
+    eol_sum += latency;
+    if (latency > eol_max) { eol_max = latency; }
+  }
+  __real_mc_line(target, pl_data);
+}
+
+
+uint8_t __wrap_plan_buffer_line(float *target, plan_line_data_t *pl_data)
+{
+  double start = host_seconds();
+  uint8_t status = __real_plan_buffer_line(target, pl_data);
+  double seconds = host_seconds() - start;
+  plan_calls++;
+  plan_seconds += seconds;
+  if (seconds > plan_max_seconds) { plan_max_seconds = seconds; }
+  return(status);
+}
+
+
+#ifdef ENABLE_PLANNER_ARCS
+uint8_t __wrap_plan_buffer_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+  float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear)
+{
+  double start = host_seconds();
+  uint8_t status = __real_plan_buffer_arc(target, pl_data, position, offset, radius, angular_travel,
+                                          axis_0, axis_1, axis_linear);
+  double seconds = host_seconds() - start;
+  plan_calls++;
+  plan_seconds += seconds;
+  if (seconds > plan_max_seconds) { plan_max_seconds = seconds; }
+  return(status);
+}
+#endif
+
+
+// Records the planned entry speed of each block, as the block is done.
+void __wrap_plan_discard_current_block()
+{
+  plan_block_t *block = plan_get_current_block();
+  if (block) {
+    double speed = sqrt((double)block->entry_speed_sqr);
+    blocks_executed++;
+    if (dump_file) { fprintf(dump_file, "%.4f\n", speed); }
+    if (reference_file) {
+      float reference;
+      if (fscanf(reference_file, "%f", &reference) != 1) { reference_mismatch++; }
+      else {
+        double error = fabs(speed - reference);
+        speed_error_sum_sqr += error*error;
+        if (error > speed_error_max) {
+          speed_error_max = error;
+          speed_error_max_reference = reference;
+          speed_error_max_block = blocks_executed;
+        }
+      }
+    }
+  }
+  __real_plan_discard_current_block();
+}
+
+
+void __wrap_st_prep_buffer()
+{
+  double start = host_seconds();
+  __real_st_prep_buffer();
+  prep_seconds += host_seconds() - start;
+}
+
+
+#ifdef ENABLE_BINARY_FRAMING
+// Encodes a g-code line into a binary frame at frame. Returns the frame length, or zero if the line
+// isn't sent as a frame: system commands, lines without words, and the M-commands which re-parse the
+// text line. Comments, spaces and the block delete are dropped as the protocol does.
+static uint16_t encode_frame(const char *text, uint16_t length, uint8_t *frame)
+{
+  char words[BENCH_LINE_MAX];
+  uint16_t idx, count = 0;
+  uint8_t comment = false;
+  for (idx = 0; idx < length; idx++) {
+    char c = text[idx];
+    if (comment) { comment = (c != ')'); }
+    else if (c == '(') { comment = true; }
+    else if (c == ';') { break; }
+    else if ((c == '$') || (c == '%')) { return(0); }
+    else if ((c > ' ') && (c != '/')) { words[count++] = toupper(c); }
+  }
+  words[count] = 0;
+  if (!count) { return(0); }
+
+  uint8_t len = 0;
+  char *word = words;
+  while (*word) {
+    if ((*word < 'A') || (*word > 'Z') || (len + 2*GC_TOKENIZED_WORD_SIZE > LINE_BUFFER_SIZE-2)) { return(0); }
+    // Values are a sign, digits and a point, as read_float() takes them. strtof() would take more.
+    char *end = word+1;
+    if ((*end == '-') || (*end == '+')) { end++; }
+    while (isdigit(*end) || (*end == '.')) { end++; }
+    char number[BENCH_LINE_MAX];
+    memcpy(number, word+1, end-(word+1));
+    number[end-(word+1)] = 0;
+    char *number_end;
+    float value = strtof(number, &number_end);
+    if ((number_end == number) || *number_end) { return(0); }
+    if (*word == 'M') {
+      uint8_t int_value = truncf(value);
+      if ((int_value == 17) || (int_value == 18) || (int_value == 42) || (int_value == 219) ||
+          ((int_value >= 226) && (int_value <= 233))) { return(0); }
+    }
+    frame[2+len] = *word;
+    memcpy(&frame[3+len], &value, sizeof(float));
+    len += GC_TOKENIZED_WORD_SIZE;
+    word = end;
+  }
+
+  uint16_t crc = _crc_ccitt_update(0xFFFF, len);
+  for (idx = 0; idx < len; idx++) { crc = _crc_ccitt_update(crc, frame[2+idx]); }
+  frame[0] = CMD_BINARY_FRAME;
+  frame[1] = len;
+  frame[2+len] = crc & 0xFF;
+  frame[3+len] = crc >> 8;
+  return(len+4);
+}
+
+
+// Replaces the g-code lines by binary frames, where the frame channel takes them.
+static void encode_frames()
+{
+  uint32_t lines = 0, idx;
+  for (idx = 0; idx < gcode_size; idx++) { if (gcode[idx] == '\n') { lines++; } }
+  char *frames_data = malloc(gcode_size + lines*LINE_BUFFER_SIZE);
+  message_length = malloc(lines*sizeof(uint16_t));
+  if (!frames_data || !message_length) { perror("bench"); exit(1); }
+  uint32_t position = 0, size = 0;
+  for (idx = 0; idx < lines; idx++) {
+    uint32_t end = position;
+    while (gcode[end++] != '\n') { }
+    uint16_t length = 0;
+    if (end - position < BENCH_LINE_MAX) { length = encode_frame(&gcode[position], end - position, (uint8_t*)&frames_data[size]); }
+    if (length) { frames++; }
+    else {
+      length = end - position;
+      memcpy(&frames_data[size], &gcode[position], length);
+    }
+    message_length[idx] = length;
+    size += length;
+    position = end;
+  }
+  free(gcode);
+  gcode = frames_data;
+  gcode_size = size;
+}
+#endif
+
+
+static void usage()
+{
+  fprintf(stderr, "usage: bench [-b baud] [-o depth.csv] [-i interval_ms] [-d speeds] [-c speeds] [-f] [-v] file.nc\n"
+                  "  -b  Serial baud rate. 0 streams the file instantly. Default 115200.\n"
+                  "  -o  Write the lookahead depth over machine time: seconds,blocks,buffer mm.\n"
+                  "  -i  Depth sample interval in ms of machine time. Default 10.\n"
+                  "  -d  Write the planned entry speed of each executed block.\n"
+                  "  -c  Compare the entry speeds with those written by -d, and report the errors.\n"
+                  "  -f  Send the lines as binary frames. Needs ENABLE_BINARY_FRAMING.\n"
+                  "  -k  Send the file in the check mode, to time the protocol and the parser alone.\n"
+                  "  -r  Send the file this many times. Default 1.\n"
+                  "  -v  Print the Grbl output.\n");
+  exit(1);
+}
+
+
+int main(int argc, char **argv)
+{
+  int idx;
+  const char *path = NULL;
+  for (idx = 1; idx < argc; idx++) {
+    if ((strcmp(argv[idx], "-b") == 0) && (idx+1 < argc)) { baud_rate = atol(argv[++idx]); }
+    else if ((strcmp(argv[idx], "-o") == 0) && (idx+1 < argc)) {
+      depth_file = fopen(argv[++idx], "w");
+      if (!depth_file) { perror(argv[idx]); exit(1); }
+    }
+    else if ((strcmp(argv[idx], "-i") == 0) && (idx+1 < argc)) { sample_interval = atof(argv[++idx])*1e-3; }
+    else if ((strcmp(argv[idx], "-d") == 0) && (idx+1 < argc)) {
+      dump_file = fopen(argv[++idx], "w");
+      if (!dump_file) { perror(argv[idx]); exit(1); }
+    }
+    else if ((strcmp(argv[idx], "-c") == 0) && (idx+1 < argc)) {
+      reference_file = fopen(argv[++idx], "r");
+      if (!reference_file) { perror(argv[idx]); exit(1); }
+    }
+    #ifdef ENABLE_BINARY_FRAMING
+      else if (strcmp(argv[idx], "-f") == 0) { frames = true; }
+    #endif
+    else if (strcmp(argv[idx], "-k") == 0) { check_mode = true; }
+    else if ((strcmp(argv[idx], "-r") == 0) && (idx+1 < argc)) { repeat = atol(argv[++idx]); }
+    else if (strcmp(argv[idx], "-v") == 0) { verbose = true; }
+    else if ((argv[idx][0] != '-') && !path) { path = argv[idx]; }
+    else { usage(); }
+  }
+  if (!path || (sample_interval <= 0.0) || !repeat) { usage(); }
+
+  FILE *file = fopen(path, "rb");
+  if (!file) { perror(path); exit(1); }
+  fseek(file, 0, SEEK_END);
+  gcode_size = ftell(file);
+  rewind(file);
+  uint32_t file_size = gcode_size+1;
+  gcode = malloc(4 + file_size*repeat);
+  if (!gcode || (fread(gcode, 1, gcode_size, file) != gcode_size)) { perror(path); exit(1); }
+  fclose(file);
+  if (gcode_size && (gcode[gcode_size-1] != '\n')) { gcode[gcode_size++] = '\n'; }
+  for (file_size = gcode_size; --repeat; gcode_size += file_size) { memcpy(&gcode[gcode_size], gcode, file_size); }
+  if (check_mode) {
+    memmove(&gcode[3], gcode, gcode_size);
+    memcpy(gcode, "$C\n", 3);
+    gcode_size += 3;
+  }
+  #ifdef ENABLE_BINARY_FRAMING
+    if (frames) {
+      frames = 0;
+      encode_frames();
+    }
+  #endif
+
+  clock_gettime(CLOCK_MONOTONIC, &start_clock);
+  hal_init();
+  hal_serial_read = bench_serial_read;
+  hal_serial_available = bench_serial_available;
+  hal_serial_write = bench_serial_write;
+  hal_delay = bench_delay;
+  return(grbl_main());
+}
@@ -0,0 +1,422 @@
+/**
+ *  fat_test.c - FAT reader test against disk image files
+ *  Builds FAT16 and FAT32 images with known files, writes them to image files, and checks the
+ *  directory listing and the file data read back by fat.c, built with FAT_HOST_BUILD. The images
+ *  have fragmented cluster chains, a partition table, a root directory spanning several clusters,
+ *  and entries the reader must skip: deleted files, the volume label, long file name entries and
+ *  subdirectories. Broken chains and block read errors must end the file with FAT_ERROR.
+ *
+ *  fat_test [-l image] lists the files of an existing image, e.g. a copy of an SD card.
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "fat.h"
+
+#define IMG_DIR_ENTRY_SIZE 32
+
+// Image being built
+typedef struct {
+  uint8_t *data;
+  uint32_t blocks;
+  uint8_t fat_type;
+  uint32_t volume_start;
+  uint8_t blocks_per_cluster;
+  uint32_t fat_start;
+  uint32_t fat_blocks;
+  uint32_t root_start;        // FAT16 root directory block
+  uint16_t root_entries;      // FAT16 root directory entries
+  uint32_t data_start;
+  uint32_t next_cluster;      // Next free cluster. Clusters are allocated with gaps.
+  uint32_t root_last_cluster; // FAT32 root directory chain end
+  uint16_t root_used;         // Root directory entries used
+} img_t;
+
+// Image file read by fat_block_read()
+static FILE *disk;
+static uint32_t disk_fail_block = 0xFFFFFFFF;
+static uint32_t disk_ahead_block = 0xFFFFFFFF; // Last fat_block_read_ahead() block
+static uint32_t disk_ahead_hits;               // fat_block_read() calls of the read-ahead block
+
+static uint32_t failures;
+
+
+uint8_t fat_block_read(uint32_t block, uint8_t *buf)
+{
+  if (block == disk_fail_block) { return(false); }
+  if (block == disk_ahead_block) {
+    disk_ahead_hits++;
+    disk_ahead_block = 0xFFFFFFFF;
+  }
+  if (fseek(disk, (long)block*FAT_BLOCK_SIZE, SEEK_SET)) { return(false); }
+  return(fread(buf, FAT_BLOCK_SIZE, 1, disk) == 1);
+}
+
+
+void fat_block_read_ahead(uint32_t block) { disk_ahead_block = block; }
+
+
+static void check(int condition, const char *test, const char *what)
+{
+  if (!condition) {
+    printf("FAIL %s: %s\n", test, what);
+    failures++;
+  }
+}
+
+
+static void put16(uint8_t *ptr, uint16_t value) { ptr[0] = value; ptr[1] = value >> 8; }
+
+
+static void put32(uint8_t *ptr, uint32_t value) { put16(ptr, value); put16(ptr+2, value >> 16); }
+
+
+static uint8_t *img_block(img_t *img, uint32_t block) { return(&img->data[(size_t)block*FAT_BLOCK_SIZE]); }
+
+
+static uint8_t *img_cluster(img_t *img, uint32_t cluster)
+{
+  return(img_block(img, img->data_start + (cluster-2)*img->blocks_per_cluster));
+}
+
+
+// Sets a FAT entry in both FATs.
+static void img_set_fat(img_t *img, uint32_t cluster, uint32_t value)
+{
+  uint8_t n;
+  for (n=0; n<2; n++) {
+    uint8_t *fat = img_block(img, img->fat_start + n*img->fat_blocks);
+    if (img->fat_type == 16) { put16(&fat[cluster*2], value); }
+    else { put32(&fat[cluster*4], value); }
+  }
+}
+
+
+static uint32_t img_end_of_chain(img_t *img) { return((img->fat_type == 16) ? 0xFFFF : 0x0FFFFFFF); }
+
+
+// Allocates a cluster, leaving a free cluster before it, so chains are never contiguous.
+static uint32_t img_alloc(img_t *img)
+{
+  uint32_t cluster = img->next_cluster;
+  img->next_cluster += 2;
+  img_set_fat(img, cluster, img_end_of_chain(img));
+  return(cluster);
+}
+
+
+// Creates an image with the volume at volume_start. A non-zero volume_start adds a partition table.
+static void img_create(img_t *img, uint8_t fat_type, uint32_t blocks, uint8_t blocks_per_cluster, uint32_t volume_start)
+{
+  memset(img, 0, sizeof(img_t));
+  img->data = calloc(blocks, FAT_BLOCK_SIZE);
+  img->blocks = blocks;
+  img->fat_type = fat_type;
+  img->volume_start = volume_start;
+  img->blocks_per_cluster = blocks_per_cluster;
+  uint32_t volume_blocks = blocks - volume_start;
+  uint16_t reserved_blocks = (fat_type == 16) ? 1 : 32;
+  uint32_t clusters = volume_blocks/blocks_per_cluster;
+  img->fat_blocks = ((clusters+2)*(fat_type/8) + FAT_BLOCK_SIZE-1)/FAT_BLOCK_SIZE;
+  img->fat_start = volume_start + reserved_blocks;
+  img->root_start = img->fat_start + 2*img->fat_blocks;
+  img->root_entries = (fat_type == 16) ? 512 : 0;
+  img->data_start = img->root_start + (uint32_t)img->root_entries*IMG_DIR_ENTRY_SIZE/FAT_BLOCK_SIZE;
+  img->next_cluster = 2;
+
+  if (volume_start) {
+    uint8_t *mbr = img_block(img, 0);
+    mbr[0x1C2] = (fat_type == 16) ? 0x06 : 0x0C; // Partition type
+    put32(&mbr[0x1C6], volume_start);
+    put32(&mbr[0x1CA], volume_blocks);
+    put16(&mbr[510], 0xAA55);
+  }
+
+  uint8_t *boot = img_block(img, volume_start);
+  boot[0] = 0xEB; boot[1] = 0x3C; boot[2] = 0x90;
+  memcpy(&boot[3], "HOSTTEST", 8);
+  put16(&boot[11], FAT_BLOCK_SIZE);
+  boot[13] = blocks_per_cluster;
+  put16(&boot[14], reserved_blocks);
+  boot[16] = 2;
+  put16(&boot[17], img->root_entries);
+  boot[21] = 0xF8;
+  if (volume_blocks < 0x10000) { put16(&boot[19], volume_blocks); }
+  else { put32(&boot[32], volume_blocks); }
+  if (fat_type == 16) { put16(&boot[22], img->fat_blocks); }
+  else { put32(&boot[36], img->fat_blocks); }
+  put16(&boot[510], 0xAA55);
+
+  img_set_fat(img, 0, 0x0FFFFFF8);
+  img_set_fat(img, 1, img_end_of_chain(img));
+  if (fat_type == 32) {
+    img->root_last_cluster = img_alloc(img);
+    put32(&boot[44], img->root_last_cluster);
+  }
+}
+
+
+// Returns the next free root directory entry. The FAT32 root directory grows by a cluster when full.
+static uint8_t *img_dir_entry(img_t *img)
+{
+  uint16_t index = img->root_used++;
+  if (img->fat_type == 16) { return(img_block(img, img->root_start) + index*IMG_DIR_ENTRY_SIZE); }
+  uint16_t cluster_entries = img->blocks_per_cluster*FAT_BLOCK_SIZE/IMG_DIR_ENTRY_SIZE;
+  if (index && !(index % cluster_entries)) {
+    uint32_t cluster = img_alloc(img);
+    img_set_fat(img, img->root_last_cluster, cluster);
+    img->root_last_cluster = cluster;
+  }
+  return(img_cluster(img, img->root_last_cluster) + (index % cluster_entries)*IMG_DIR_ENTRY_SIZE);
+}
+
+
+// Adds a raw directory entry. name is the space padded 11 character 8.3 name.
+static uint8_t *img_add_entry(img_t *img, const char *name, uint8_t attributes, uint32_t cluster, uint32_t size)
+{
+  uint8_t *entry = img_dir_entry(img);
+  memcpy(entry, name, 11);
+  entry[11] = attributes;
+  put16(&entry[20], cluster >> 16);
+  put16(&entry[26], cluster);
+  put32(&entry[28], size);
+  return(entry);
+}
+
+
+// Adds a root directory file holding data. Returns its first cluster.
+static uint32_t img_add_file(img_t *img, const char *name, const char *data, uint32_t size)
+{
+  uint32_t cluster_size = img->blocks_per_cluster*FAT_BLOCK_SIZE;
+  uint32_t first = 0;
+  uint32_t last = 0;
+  uint32_t offset;
+  for (offset=0; offset<size; offset+=cluster_size) {
+    uint32_t cluster = img_alloc(img);
+    if (last) { img_set_fat(img, last, cluster); }
+    else { first = cluster; }
+    last = cluster;
+    memcpy(img_cluster(img, cluster), &data[offset], (size-offset < cluster_size) ? size-offset : cluster_size);
+  }
+  img_add_entry(img, name, 0x20, first, size);
+  return(first);
+}
+
+
+// Writes the image to path, skipping zero blocks so the file stays sparse, and opens it for reading.
+static void img_save(img_t *img, const char *path)
+{
+  static const uint8_t zero[FAT_BLOCK_SIZE];
+  if (disk) { fclose(disk); }
+  FILE *f = fopen(path, "wb");
+  if (!f) { perror(path); exit(1); }
+  uint32_t block;
+  for (block=0; block<img->blocks; block++) {
+    uint8_t *data = img_block(img, block);
+    if (memcmp(data, zero, FAT_BLOCK_SIZE)) {
+      fseek(f, (long)block*FAT_BLOCK_SIZE, SEEK_SET);
+      fwrite(data, FAT_BLOCK_SIZE, 1, f);
+    }
+  }
+  fflush(f);
+  if (ftruncate(fileno(f), (off_t)img->blocks*FAT_BLOCK_SIZE)) { perror(path); exit(1); }
+  fclose(f);
+  disk = fopen(path, "rb");
+  if (!disk) { perror(path); exit(1); }
+}
+
+
+// Generates a g-code file of about size bytes with CRLF line ends.
+static char *make_gcode(uint32_t size, uint32_t *length)
+{
+  char *text = malloc(size+64);
+  uint32_t n = 0;
+  uint32_t line = 0;
+  while (n < size) { n += sprintf(&text[n], "G1 X%u.%03u Y%u F1500\r\n", line % 500, (line*37) % 1000, line/3); line++; }
+  *length = n;
+  return(text);
+}
+
+
+// Reads the named file whole and compares it with data. Every block after the first must have
+// been read ahead.
+static void check_file(const char *test, const char *name, const char *data, uint32_t size)
+{
+  fat_file_t file;
+  check(fat_open(&file, name), test, "open");
+  disk_ahead_block = 0xFFFFFFFF;
+  disk_ahead_hits = 0;
+  check(file.size == size, test, "file size");
+  uint32_t n;
+  for (n=0; n<size; n++) {
+    int16_t c = fat_read(&file);
+    if (c != (uint8_t)data[n]) {
+      char what[64];
+      sprintf(what, "data mismatch at byte %u", n);
+      check(false, test, what);
+      return;
+    }
+  }
+  check(fat_read(&file) == FAT_EOF, test, "end of file");
+  check(fat_read(&file) == FAT_EOF, test, "end of file, read again");
+  uint32_t blocks = (size + FAT_BLOCK_SIZE-1) / FAT_BLOCK_SIZE;
+  check(disk_ahead_hits == (blocks ? blocks-1 : 0), test, "read ahead");
+  check(disk_ahead_block == 0xFFFFFFFF, test, "no read ahead past the end of file");
+}
+
+
+static void test_fat16(const char *path, uint32_t volume_start)
+{
+  const char *test = volume_start ? "fat16 partitioned" : "fat16";
+  img_t img;
+  img_create(&img, 16, 40000+volume_start, 4, volume_start);
+  uint32_t size;
+  char *job = make_gcode(9000, &size);
+  img_add_entry(&img, "HOSTTEST   ", 0x08, 0, 0);  // Volume label
+  img_add_entry(&img, "\x41J\0O\0B\0.\0N\0", 0x0F, 0, 0); // Long file name entry
+  img_add_file(&img, "JOB     NC ", job, size);
+  uint8_t *deleted = img_add_entry(&img, "OLD     NC ", 0x20, 0, 100);
+  deleted[0] = 0xE5;
+  img_add_entry(&img, "SUBDIR     ", 0x10, img_alloc(&img), 0);
+  img_add_entry(&img, "EMPTY   TXT", 0x20, 0, 0);
+  img_add_file(&img, "A          ", "G0 X1\n", 6);
+  img_save(&img, path);
+
+  check(fat_mount(), test, "mount");
+  const char *names[] = { "JOB.NC", "EMPTY.TXT", "A" };
+  const uint32_t sizes[] = { size, 0, 6 };
+  char name[FAT_NAME_SIZE];
+  uint32_t file_size;
+  uint16_t index = 0;
+  uint8_t n = 0;
+  while (fat_dir_next(&index, name, &file_size)) {
+    if (n < 3) {
+      check(strcmp(name, names[n]) == 0, test, "listed name");
+      check(file_size == sizes[n], test, "listed size");
+    }
+    n++;
+  }
+  check(n == 3, test, "listed file count");
+
+  check_file(test, "JOB.NC", job, size);
+  check_file(test, "A", "G0 X1\n", 6);
+  fat_file_t file;
+  check(fat_open(&file, "EMPTY.TXT") && (fat_read(&file) == FAT_EOF), test, "empty file");
+  check(!fat_open(&file, "OLD.NC"), test, "deleted file not opened");
+  check(!fat_open(&file, "SUBDIR"), test, "subdirectory not opened");
+  check(!fat_open(&file, "MISSING.NC"), test, "missing file not opened");
+  free(job);
+  free(img.data);
+}
+
+
+static void test_fat32(const char *path)
+{
+  const char *test = "fat32";
+  img_t img;
+  img_create(&img, 32, 70000, 1, 0);
+  uint32_t size;
+  char *job = make_gcode(3000, &size);
+  char name[12];
+  uint8_t n;
+  // 40 files. With one block per cluster, the root directory spans three clusters.
+  for (n=0; n<40; n++) {
+    sprintf(name, "F%-7uNC ", (unsigned)n);
+    img_add_file(&img, name, job, size - n);
+  }
+  img_save(&img, path);
+
+  check(fat_mount(), test, "mount");
+  uint16_t index = 0;
+  uint32_t file_size;
+  char listed[FAT_NAME_SIZE];
+  n = 0;
+  while (fat_dir_next(&index, listed, &file_size)) { n++; }
+  check(n == 40, test, "listed file count");
+  check_file(test, "F0.NC", job, size);
+  check_file(test, "F39.NC", job, size-39);
+  free(job);
+  free(img.data);
+}
+
+
+static void test_errors(const char *path)
+{
+  const char *test = "errors";
+  img_t img;
+  img_create(&img, 16, 40000, 4, 0);
+  uint32_t size;
+  char *job = make_gcode(9000, &size);
+  uint32_t first = img_add_file(&img, "BROKEN  NC ", job, size);
+  img_add_file(&img, "BADBLOCKNC ", job, size);
+  img_set_fat(&img, first, 0); // Chain ends at a free cluster.
+  img_save(&img, path);
+
+  check(fat_mount(), test, "mount");
+  fat_file_t file;
+  uint32_t n = 0;
+  int16_t c;
+  check(fat_open(&file, "BROKEN.NC"), test, "open broken chain");
+  while ((c = fat_read(&file)) >= 0) { n++; }
+  check((c == FAT_ERROR) && (n == 4*FAT_BLOCK_SIZE), test, "broken chain ends with FAT_ERROR after the first cluster");
+
+  check(fat_open(&file, "BADBLOCK.NC"), test, "open");
+  disk_fail_block = img.data_start + (file.cluster-2)*img.blocks_per_cluster + 1;
+  n = 0;
+  while ((c = fat_read(&file)) >= 0) { n++; }
+  check((c == FAT_ERROR) && (n == FAT_BLOCK_SIZE), test, "read error ends with FAT_ERROR");
+  disk_fail_block = 0xFFFFFFFF;
+
+  memset(img.data, 0, FAT_BLOCK_SIZE);
+  img_save(&img, path);
+  check(!fat_mount(), test, "no boot signature, not mounted");
+  uint16_t index = 0;
+  char name[FAT_NAME_SIZE];
+  check(!fat_dir_next(&index, name, &size), test, "no files listed when not mounted");
+  free(job);
+  free(img.data);
+}
+
+
+static int list_image(const char *path)
+{
+  disk = fopen(path, "rb");
+  if (!disk) { perror(path); return(1); }
+  if (!fat_mount()) {
+    printf("%s: no FAT16 or FAT32 volume\n", path);
+    return(1);
+  }
+  char name[FAT_NAME_SIZE];
+  uint32_t size;
+  uint16_t index = 0;
+  while (fat_dir_next(&index, name, &size)) { printf("%-12s %u\n", name, size); }
+  return(0);
+}
+
+
+int main(int argc, char *argv[])
+{
+  if ((argc == 3) && !strcmp(argv[1], "-l")) { return(list_image(argv[2])); }
+  if (argc != 2) {
+    fprintf(stderr, "usage: fat_test image_dir\n       fat_test -l image\n");
+    return(1);
+  }
+  char path[256];
+  snprintf(path, sizeof(path), "%s/fat_test.img", argv[1]);
+  test_fat16(path, 0);
+  test_fat16(path, 63);
+  test_fat32(path);
+  test_errors(path);
+  fclose(disk);
+  unlink(path);
+  if (failures) {
+    printf("fat_test: %u failures\n", failures);
+    return(1);
+  }
+  printf("fat_test: all passed\n");
+  return(0);
+}
@@ -0,0 +1,3010 @@
+$120=10
+$121=10
+G21 G90 G17
+G0 Z5
+G0 X0 Y0
+M3 S1000
+G1 Z1.5 F600
+G1 X0.209 Y0.000 F2500
+G1 X0.419 Y0.001 F2500
+G1 X0.628 Y0.002 F2500
+G1 X0.838 Y0.004 F2500
+G1 X1.047 Y0.005 F2500
+G1 X1.257 Y0.008 F2500
+G1 X1.466 Y0.011 F2500
+G1 X1.675 Y0.014 F2500
+G1 X1.885 Y0.018 F2500
+G1 X2.094 Y0.022 F2500
+G1 X2.304 Y0.027 F2500
+G1 X2.513 Y0.032 F2500
+G1 X2.722 Y0.037 F2500
+G1 X2.932 Y0.043 F2500
+G1 X3.141 Y0.049 F2500
+G1 X3.350 Y0.056 F2500
+G1 X3.560 Y0.063 F2500
+G1 X3.769 Y0.071 F2500
+G1 X3.978 Y0.079 F2500
+G1 X4.188 Y0.088 F2500
+G1 X4.397 Y0.097 F2500
+G1 X4.606 Y0.106 F2500
+G1 X4.815 Y0.116 F2500
+G1 X5.024 Y0.126 F2500
+G1 X5.234 Y0.137 F2500
+G1 X5.443 Y0.148 F2500
+G1 X5.652 Y0.160 F2500
+G1 X5.861 Y0.172 F2500
+G1 X6.070 Y0.184 F2500
+G1 X6.279 Y0.197 F2500
+G1 X6.488 Y0.211 F2500
+G1 X6.697 Y0.225 F2500
+G1 X6.906 Y0.239 F2500
+G1 X7.115 Y0.253 F2500
+G1 X7.324 Y0.269 F2500
+G1 X7.533 Y0.284 F2500
+G1 X7.742 Y0.300 F2500
+G1 X7.950 Y0.317 F2500
+G1 X8.159 Y0.333 F2500
+G1 X8.368 Y0.351 F2500
+G1 X8.576 Y0.368 F2500
+G1 X8.785 Y0.387 F2500
+G1 X8.994 Y0.405 F2500
+G1 X9.202 Y0.424 F2500
+G1 X9.411 Y0.444 F2500
+G1 X9.619 Y0.464 F2500
+G1 X9.828 Y0.484 F2500
+G1 X10.036 Y0.505 F2500
+G1 X10.245 Y0.526 F2500
+G1 X10.453 Y0.548 F2500
+G1 X10.661 Y0.570 F2500
+G1 X10.869 Y0.592 F2500
+G1 X11.078 Y0.615 F2500
+G1 X11.286 Y0.639 F2500
+G1 X11.494 Y0.663 F2500
+G1 X11.702 Y0.687 F2500
+G1 X11.910 Y0.712 F2500
+G1 X12.118 Y0.737 F2500
+G1 X12.326 Y0.762 F2500
+G1 X12.533 Y0.789 F2500
+G1 X12.741 Y0.815 F2500
+G1 X12.949 Y0.842 F2500
+G1 X13.156 Y0.869 F2500
+G1 X13.364 Y0.897 F2500
+G1 X13.572 Y0.925 F2500
+G1 X13.779 Y0.954 F2500
+G1 X13.986 Y0.983 F2500
+G1 X14.194 Y1.012 F2500
+G1 X14.401 Y1.042 F2500
+G1 X14.608 Y1.073 F2500
+G1 X14.815 Y1.104 F2500
+G1 X15.023 Y1.135 F2500
+G1 X15.230 Y1.167 F2500
+G1 X15.437 Y1.199 F2500
+G1 X15.643 Y1.231 F2500
+G1 X15.850 Y1.264 F2500
+G1 X16.057 Y1.298 F2500
+G1 X16.264 Y1.331 F2500
+G1 X16.470 Y1.366 F2500
+G1 X16.677 Y1.400 F2500
+G1 X16.883 Y1.436 F2500
+G1 X17.090 Y1.471 F2500
+G1 X17.296 Y1.507 F2500
+G1 X17.502 Y1.544 F2500
+G1 X17.708 Y1.580 F2500
+G1 X17.915 Y1.618 F2500
+G1 X18.121 Y1.655 F2500
+G1 X18.327 Y1.694 F2500
+G1 X18.532 Y1.732 F2500
+G1 X18.738 Y1.771 F2500
+G1 X18.944 Y1.811 F2500
+G1 X19.149 Y1.851 F2500
+G1 X19.355 Y1.891 F2500
+G1 X19.560 Y1.932 F2500
+G1 X19.766 Y1.973 F2500
+G1 X19.971 Y2.014 F2500
+G1 X20.176 Y2.057 F2500
+G1 X20.381 Y2.099 F2500
+G1 X20.586 Y2.142 F2500
+G1 X20.791 Y2.185 F2500
+G1 X20.996 Y2.229 F2500
+G1 X21.201 Y2.273 F2500
+G1 X21.405 Y2.318 F2500
+G1 X21.610 Y2.363 F2500
+G1 X21.814 Y2.408 F2500
+G1 X22.019 Y2.454 F2500
+G1 X22.223 Y2.501 F2500
+G1 X22.427 Y2.547 F2500
+G1 X22.631 Y2.594 F2500
+G1 X22.835 Y2.642 F2500
+G1 X23.039 Y2.690 F2500
+G1 X23.243 Y2.739 F2500
+G1 X23.446 Y2.788 F2500
+G1 X23.650 Y2.837 F2500
+G1 X23.853 Y2.887 F2500
+G1 X24.057 Y2.937 F2500
+G1 X24.260 Y2.987 F2500
+G1 X24.463 Y3.038 F2500
+G1 X24.666 Y3.090 F2500
+G1 X24.869 Y3.142 F2500
+G1 X25.072 Y3.194 F2500
+G1 X25.274 Y3.247 F2500
+G1 X25.477 Y3.300 F2500
+G1 X25.680 Y3.353 F2500
+G1 X25.882 Y3.407 F2500
+G1 X26.084 Y3.462 F2500
+G1 X26.286 Y3.517 F2500
+G1 X26.488 Y3.572 F2500
+G1 X26.690 Y3.628 F2500
+G1 X26.892 Y3.684 F2500
+G1 X27.094 Y3.740 F2500
+G1 X27.295 Y3.797 F2500
+G1 X27.497 Y3.855 F2500
+G1 X27.698 Y3.912 F2500
+G1 X27.899 Y3.971 F2500
+G1 X28.100 Y4.029 F2500
+G1 X28.301 Y4.088 F2500
+G1 X28.502 Y4.148 F2500
+G1 X28.703 Y4.208 F2500
+G1 X28.903 Y4.268 F2500
+G1 X29.104 Y4.329 F2500
+G1 X29.304 Y4.390 F2500
+G1 X29.504 Y4.452 F2500
+G1 X29.704 Y4.514 F2500
+G1 X29.904 Y4.576 F2500
+G1 X30.104 Y4.639 F2500
+G1 X30.304 Y4.702 F2500
+G1 X30.503 Y4.766 F2500
+G1 X30.702 Y4.830 F2500
+G1 X30.902 Y4.894 F2500
+G1 X31.101 Y4.959 F2500
+G1 X31.300 Y5.025 F2500
+G1 X31.499 Y5.090 F2500
+G1 X31.697 Y5.157 F2500
+G1 X31.896 Y5.223 F2500
+G1 X32.094 Y5.290 F2500
+G1 X32.293 Y5.358 F2500
+G1 X32.491 Y5.425 F2500
+G1 X32.689 Y5.494 F2500
+G1 X32.887 Y5.562 F2500
+G1 X33.084 Y5.631 F2500
+G1 X33.282 Y5.701 F2500
+G1 X33.479 Y5.771 F2500
+G1 X33.677 Y5.841 F2500
+G1 X33.874 Y5.912 F2500
+G1 X34.071 Y5.983 F2500
+G1 X34.268 Y6.055 F2500
+G1 X34.464 Y6.127 F2500
+G1 X34.661 Y6.199 F2500
+G1 X34.857 Y6.272 F2500
+G1 X35.053 Y6.345 F2500
+G1 X35.250 Y6.419 F2500
+G1 X35.445 Y6.493 F2500
+G1 X35.641 Y6.567 F2500
+G1 X35.837 Y6.642 F2500
+G1 X36.032 Y6.717 F2500
+G1 X36.228 Y6.793 F2500
+G1 X36.423 Y6.869 F2500
+G1 X36.618 Y6.945 F2500
+G1 X36.812 Y7.022 F2500
+G1 X37.007 Y7.100 F2500
+G1 X37.202 Y7.177 F2500
+G1 X37.396 Y7.255 F2500
+G1 X37.590 Y7.334 F2500
+G1 X37.784 Y7.413 F2500
+G1 X37.978 Y7.492 F2500
+G1 X38.172 Y7.572 F2500
+G1 X38.365 Y7.652 F2500
+G1 X38.558 Y7.733 F2500
+G1 X38.752 Y7.814 F2500
+G1 X38.945 Y7.895 F2500
+G1 X39.137 Y7.977 F2500
+G1 X39.330 Y8.059 F2500
+G1 X39.522 Y8.142 F2500
+G1 X39.715 Y8.225 F2500
+G1 X39.907 Y8.308 F2500
+G1 X40.099 Y8.392 F2500
+G1 X40.291 Y8.476 F2500
+G1 X40.482 Y8.560 F2500
+G1 X40.674 Y8.645 F2500
+G1 X40.865 Y8.731 F2500
+G1 X41.056 Y8.817 F2500
+G1 X41.247 Y8.903 F2500
+G1 X41.438 Y8.989 F2500
+G1 X41.628 Y9.076 F2500
+G1 X41.818 Y9.164 F2500
+G1 X42.009 Y9.252 F2500
+G1 X42.199 Y9.340 F2500
+G1 X42.388 Y9.428 F2500
+G1 X42.578 Y9.517 F2500
+G1 X42.767 Y9.607 F2500
+G1 X42.957 Y9.696 F2500
+G1 X43.146 Y9.787 F2500
+G1 X43.334 Y9.877 F2500
+G1 X43.523 Y9.968 F2500
+G1 X43.712 Y10.059 F2500
+G1 X43.900 Y10.151 F2500
+G1 X44.088 Y10.243 F2500
+G1 X44.276 Y10.336 F2500
+G1 X44.464 Y10.429 F2500
+G1 X44.651 Y10.522 F2500
+G1 X44.838 Y10.616 F2500
+G1 X45.025 Y10.710 F2500
+G1 X45.212 Y10.804 F2500
+G1 X45.399 Y10.899 F2500
+G1 X45.586 Y10.995 F2500
+G1 X45.772 Y11.090 F2500
+G1 X45.958 Y11.186 F2500
+G1 X46.144 Y11.283 F2500
+G1 X46.330 Y11.380 F2500
+G1 X46.515 Y11.477 F2500
+G1 X46.700 Y11.574 F2500
+G1 X46.886 Y11.672 F2500
+G1 X47.070 Y11.771 F2500
+G1 X47.255 Y11.870 F2500
+G1 X47.440 Y11.969 F2500
+G1 X47.624 Y12.068 F2500
+G1 X47.808 Y12.168 F2500
+G1 X47.992 Y12.269 F2500
+G1 X48.175 Y12.369 F2500
+G1 X48.359 Y12.470 F2500
+G1 X48.542 Y12.572 F2500
+G1 X48.725 Y12.674 F2500
+G1 X48.908 Y12.776 F2500
+G1 X49.090 Y12.879 F2500
+G1 X49.273 Y12.982 F2500
+G1 X49.455 Y13.085 F2500
+G1 X49.637 Y13.189 F2500
+G1 X49.819 Y13.293 F2500
+G1 X50.000 Y13.397 F2500
+G1 X50.181 Y13.502 F2500
+G1 X50.362 Y13.608 F2500
+G1 X50.543 Y13.713 F2500
+G1 X50.724 Y13.819 F2500
+G1 X50.904 Y13.926 F2500
+G1 X51.084 Y14.033 F2500
+G1 X51.264 Y14.140 F2500
+G1 X51.444 Y14.247 F2500
+G1 X51.623 Y14.355 F2500
+G1 X51.803 Y14.464 F2500
+G1 X51.982 Y14.572 F2500
+G1 X52.161 Y14.681 F2500
+G1 X52.339 Y14.791 F2500
+G1 X52.517 Y14.901 F2500
+G1 X52.696 Y15.011 F2500
+G1 X52.873 Y15.121 F2500
+G1 X53.051 Y15.232 F2500
+G1 X53.229 Y15.344 F2500
+G1 X53.406 Y15.455 F2500
+G1 X53.583 Y15.567 F2500
+G1 X53.759 Y15.680 F2500
+G1 X53.936 Y15.792 F2500
+G1 X54.112 Y15.906 F2500
+G1 X54.288 Y16.019 F2500
+G1 X54.464 Y16.133 F2500
+G1 X54.639 Y16.247 F2500
+G1 X54.815 Y16.362 F2500
+G1 X54.990 Y16.477 F2500
+G1 X55.165 Y16.592 F2500
+G1 X55.339 Y16.708 F2500
+G1 X55.513 Y16.824 F2500
+G1 X55.688 Y16.940 F2500
+G1 X55.861 Y17.057 F2500
+G1 X56.035 Y17.174 F2500
+G1 X56.208 Y17.292 F2500
+G1 X56.381 Y17.410 F2500
+G1 X56.554 Y17.528 F2500
+G1 X56.727 Y17.647 F2500
+G1 X56.899 Y17.766 F2500
+G1 X57.071 Y17.885 F2500
+G1 X57.243 Y18.005 F2500
+G1 X57.415 Y18.125 F2500
+G1 X57.586 Y18.245 F2500
+G1 X57.757 Y18.366 F2500
+G1 X57.928 Y18.487 F2500
+G1 X58.099 Y18.609 F2500
+G1 X58.269 Y18.731 F2500
+G1 X58.439 Y18.853 F2500
+G1 X58.609 Y18.975 F2500
+G1 X58.779 Y19.098 F2500
+G1 X58.948 Y19.222 F2500
+G1 X59.117 Y19.345 F2500
+G1 X59.286 Y19.469 F2500
+G1 X59.454 Y19.594 F2500
+G1 X59.622 Y19.718 F2500
+G1 X59.790 Y19.843 F2500
+G1 X59.958 Y19.969 F2500
+G1 X60.126 Y20.094 F2500
+G1 X60.293 Y20.221 F2500
+G1 X60.460 Y20.347 F2500
+G1 X60.627 Y20.474 F2500
+G1 X60.793 Y20.601 F2500
+G1 X60.959 Y20.728 F2500
+G1 X61.125 Y20.856 F2500
+G1 X61.291 Y20.984 F2500
+G1 X61.456 Y21.113 F2500
+G1 X61.621 Y21.242 F2500
+G1 X61.786 Y21.371 F2500
+G1 X61.951 Y21.501 F2500
+G1 X62.115 Y21.631 F2500
+G1 X62.279 Y21.761 F2500
+G1 X62.443 Y21.892 F2500
+G1 X62.606 Y22.022 F2500
+G1 X62.769 Y22.154 F2500
+G1 X62.932 Y22.285 F2500
+G1 X63.095 Y22.417 F2500
+G1 X63.257 Y22.550 F2500
+G1 X63.419 Y22.682 F2500
+G1 X63.581 Y22.815 F2500
+G1 X63.742 Y22.949 F2500
+G1 X63.904 Y23.082 F2500
+G1 X64.065 Y23.216 F2500
+G1 X64.225 Y23.351 F2500
+G1 X64.386 Y23.485 F2500
+G1 X64.546 Y23.620 F2500
+G1 X64.706 Y23.756 F2500
+G1 X64.865 Y23.891 F2500
+G1 X65.024 Y24.027 F2500
+G1 X65.183 Y24.164 F2500
+G1 X65.342 Y24.300 F2500
+G1 X65.500 Y24.438 F2500
+G1 X65.659 Y24.575 F2500
+G1 X65.816 Y24.713 F2500
+G1 X65.974 Y24.851 F2500
+G1 X66.131 Y24.989 F2500
+G1 X66.288 Y25.128 F2500
+G1 X66.445 Y25.267 F2500
+G1 X66.601 Y25.406 F2500
+G1 X66.757 Y25.546 F2500
+G1 X66.913 Y25.686 F2500
+G1 X67.069 Y25.826 F2500
+G1 X67.224 Y25.966 F2500
+G1 X67.379 Y26.107 F2500
+G1 X67.533 Y26.249 F2500
+G1 X67.688 Y26.390 F2500
+G1 X67.842 Y26.532 F2500
+G1 X67.995 Y26.674 F2500
+G1 X68.149 Y26.817 F2500
+G1 X68.302 Y26.960 F2500
+G1 X68.455 Y27.103 F2500
+G1 X68.607 Y27.247 F2500
+G1 X68.759 Y27.391 F2500
+G1 X68.911 Y27.535 F2500
+G1 X69.063 Y27.679 F2500
+G1 X69.214 Y27.824 F2500
+G1 X69.365 Y27.969 F2500
+G1 X69.516 Y28.115 F2500
+G1 X69.666 Y28.260 F2500
+G1 X69.817 Y28.406 F2500
+G1 X69.966 Y28.553 F2500
+G1 X70.116 Y28.699 F2500
+G1 X70.265 Y28.846 F2500
+G1 X70.414 Y28.994 F2500
+G1 X70.562 Y29.141 F2500
+G1 X70.711 Y29.289 F2500
+G1 X70.859 Y29.438 F2500
+G1 X71.006 Y29.586 F2500
+G1 X71.154 Y29.735 F2500
+G1 X71.301 Y29.884 F2500
+G1 X71.447 Y30.034 F2500
+G1 X71.594 Y30.183 F2500
+G1 X71.740 Y30.334 F2500
+G1 X71.885 Y30.484 F2500
+G1 X72.031 Y30.635 F2500
+G1 X72.176 Y30.786 F2500
+G1 X72.321 Y30.937 F2500
+G1 X72.465 Y31.089 F2500
+G1 X72.609 Y31.241 F2500
+G1 X72.753 Y31.393 F2500
+G1 X72.897 Y31.545 F2500
+G1 X73.040 Y31.698 F2500
+G1 X73.183 Y31.851 F2500
+G1 X73.326 Y32.005 F2500
+G1 X73.468 Y32.158 F2500
+G1 X73.610 Y32.312 F2500
+G1 X73.751 Y32.467 F2500
+G1 X73.893 Y32.621 F2500
+G1 X74.034 Y32.776 F2500
+G1 X74.174 Y32.931 F2500
+G1 X74.314 Y33.087 F2500
+G1 X74.454 Y33.243 F2500
+G1 X74.594 Y33.399 F2500
+G1 X74.733 Y33.555 F2500
+G1 X74.872 Y33.712 F2500
+G1 X75.011 Y33.869 F2500
+G1 X75.149 Y34.026 F2500
+G1 X75.287 Y34.184 F2500
+G1 X75.425 Y34.341 F2500
+G1 X75.562 Y34.500 F2500
+G1 X75.700 Y34.658 F2500
+G1 X75.836 Y34.817 F2500
+G1 X75.973 Y34.976 F2500
+G1 X76.109 Y35.135 F2500
+G1 X76.244 Y35.294 F2500
+G1 X76.380 Y35.454 F2500
+G1 X76.515 Y35.614 F2500
+G1 X76.649 Y35.775 F2500
+G1 X76.784 Y35.935 F2500
+G1 X76.918 Y36.096 F2500
+G1 X77.051 Y36.258 F2500
+G1 X77.185 Y36.419 F2500
+G1 X77.318 Y36.581 F2500
+G1 X77.450 Y36.743 F2500
+G1 X77.583 Y36.905 F2500
+G1 X77.715 Y37.068 F2500
+G1 X77.846 Y37.231 F2500
+G1 X77.978 Y37.394 F2500
+G1 X78.108 Y37.557 F2500
+G1 X78.239 Y37.721 F2500
+G1 X78.369 Y37.885 F2500
+G1 X78.499 Y38.049 F2500
+G1 X78.629 Y38.214 F2500
+G1 X78.758 Y38.379 F2500
+G1 X78.887 Y38.544 F2500
+G1 X79.016 Y38.709 F2500
+G1 X79.144 Y38.875 F2500
+G1 X79.272 Y39.041 F2500
+G1 X79.399 Y39.207 F2500
+G1 X79.526 Y39.373 F2500
+G1 X79.653 Y39.540 F2500
+G1 X79.779 Y39.707 F2500
+G1 X79.906 Y39.874 F2500
+G1 X80.031 Y40.042 F2500
+G1 X80.157 Y40.210 F2500
+G1 X80.282 Y40.378 F2500
+G1 X80.406 Y40.546 F2500
+G1 X80.531 Y40.714 F2500
+G1 X80.655 Y40.883 F2500
+G1 X80.778 Y41.052 F2500
+G1 X80.902 Y41.221 F2500
+G1 X81.025 Y41.391 F2500
+G1 X81.147 Y41.561 F2500
+G1 X81.269 Y41.731 F2500
+G1 X81.391 Y41.901 F2500
+G1 X81.513 Y42.072 F2500
+G1 X81.634 Y42.243 F2500
+G1 X81.755 Y42.414 F2500
+G1 X81.875 Y42.585 F2500
+G1 X81.995 Y42.757 F2500
+G1 X82.115 Y42.929 F2500
+G1 X82.234 Y43.101 F2500
+G1 X82.353 Y43.273 F2500
+G1 X82.472 Y43.446 F2500
+G1 X82.590 Y43.619 F2500
+G1 X82.708 Y43.792 F2500
+G1 X82.826 Y43.965 F2500
+G1 X82.943 Y44.139 F2500
+G1 X83.060 Y44.312 F2500
+G1 X83.176 Y44.487 F2500
+G1 X83.292 Y44.661 F2500
+G1 X83.408 Y44.835 F2500
+G1 X83.523 Y45.010 F2500
+G1 X83.638 Y45.185 F2500
+G1 X83.753 Y45.361 F2500
+G1 X83.867 Y45.536 F2500
+G1 X83.981 Y45.712 F2500
+G1 X84.094 Y45.888 F2500
+G1 X84.208 Y46.064 F2500
+G1 X84.320 Y46.241 F2500
+G1 X84.433 Y46.417 F2500
+G1 X84.545 Y46.594 F2500
+G1 X84.656 Y46.771 F2500
+G1 X84.768 Y46.949 F2500
+G1 X84.879 Y47.127 F2500
+G1 X84.989 Y47.304 F2500
+G1 X85.099 Y47.483 F2500
+G1 X85.209 Y47.661 F2500
+G1 X85.319 Y47.839 F2500
+G1 X85.428 Y48.018 F2500
+G1 X85.536 Y48.197 F2500
+G1 X85.645 Y48.377 F2500
+G1 X85.753 Y48.556 F2500
+G1 X85.860 Y48.736 F2500
+G1 X85.967 Y48.916 F2500
+G1 X86.074 Y49.096 F2500
+G1 X86.181 Y49.276 F2500
+G1 X86.287 Y49.457 F2500
+G1 X86.392 Y49.638 F2500
+G1 X86.498 Y49.819 F2500
+G1 X86.603 Y50.000 F2500
+G1 X86.707 Y50.181 F2500
+G1 X86.811 Y50.363 F2500
+G1 X86.915 Y50.545 F2500
+G1 X87.018 Y50.727 F2500
+G1 X87.121 Y50.910 F2500
+G1 X87.224 Y51.092 F2500
+G1 X87.326 Y51.275 F2500
+G1 X87.428 Y51.458 F2500
+G1 X87.530 Y51.641 F2500
+G1 X87.631 Y51.825 F2500
+G1 X87.731 Y52.008 F2500
+G1 X87.832 Y52.192 F2500
+G1 X87.932 Y52.376 F2500
+G1 X88.031 Y52.560 F2500
+G1 X88.130 Y52.745 F2500
+G1 X88.229 Y52.930 F2500
+G1 X88.328 Y53.114 F2500
+G1 X88.426 Y53.300 F2500
+G1 X88.523 Y53.485 F2500
+G1 X88.620 Y53.670 F2500
+G1 X88.717 Y53.856 F2500
+G1 X88.814 Y54.042 F2500
+G1 X88.910 Y54.228 F2500
+G1 X89.005 Y54.414 F2500
+G1 X89.101 Y54.601 F2500
+G1 X89.196 Y54.788 F2500
+G1 X89.290 Y54.975 F2500
+G1 X89.384 Y55.162 F2500
+G1 X89.478 Y55.349 F2500
+G1 X89.571 Y55.536 F2500
+G1 X89.664 Y55.724 F2500
+G1 X89.757 Y55.912 F2500
+G1 X89.849 Y56.100 F2500
+G1 X89.941 Y56.288 F2500
+G1 X90.032 Y56.477 F2500
+G1 X90.123 Y56.666 F2500
+G1 X90.213 Y56.854 F2500
+G1 X90.304 Y57.043 F2500
+G1 X90.393 Y57.233 F2500
+G1 X90.483 Y57.422 F2500
+G1 X90.572 Y57.612 F2500
+G1 X90.660 Y57.801 F2500
+G1 X90.748 Y57.991 F2500
+G1 X90.836 Y58.182 F2500
+G1 X90.924 Y58.372 F2500
+G1 X91.011 Y58.562 F2500
+G1 X91.097 Y58.753 F2500
+G1 X91.183 Y58.944 F2500
+G1 X91.269 Y59.135 F2500
+G1 X91.355 Y59.326 F2500
+G1 X91.440 Y59.518 F2500
+G1 X91.524 Y59.709 F2500
+G1 X91.608 Y59.901 F2500
+G1 X91.692 Y60.093 F2500
+G1 X91.775 Y60.285 F2500
+G1 X91.858 Y60.478 F2500
+G1 X91.941 Y60.670 F2500
+G1 X92.023 Y60.863 F2500
+G1 X92.105 Y61.055 F2500
+G1 X92.186 Y61.248 F2500
+G1 X92.267 Y61.442 F2500
+G1 X92.348 Y61.635 F2500
+G1 X92.428 Y61.828 F2500
+G1 X92.508 Y62.022 F2500
+G1 X92.587 Y62.216 F2500
+G1 X92.666 Y62.410 F2500
+G1 X92.745 Y62.604 F2500
+G1 X92.823 Y62.798 F2500
+G1 X92.900 Y62.993 F2500
+G1 X92.978 Y63.188 F2500
+G1 X93.055 Y63.382 F2500
+G1 X93.131 Y63.577 F2500
+G1 X93.207 Y63.772 F2500
+G1 X93.283 Y63.968 F2500
+G1 X93.358 Y64.163 F2500
+G1 X93.433 Y64.359 F2500
+G1 X93.507 Y64.555 F2500
+G1 X93.581 Y64.750 F2500
+G1 X93.655 Y64.947 F2500
+G1 X93.728 Y65.143 F2500
+G1 X93.801 Y65.339 F2500
+G1 X93.873 Y65.536 F2500
+G1 X93.945 Y65.732 F2500
+G1 X94.017 Y65.929 F2500
+G1 X94.088 Y66.126 F2500
+G1 X94.159 Y66.323 F2500
+G1 X94.229 Y66.521 F2500
+G1 X94.299 Y66.718 F2500
+G1 X94.369 Y66.916 F2500
+G1 X94.438 Y67.113 F2500
+G1 X94.506 Y67.311 F2500
+G1 X94.575 Y67.509 F2500
+G1 X94.642 Y67.707 F2500
+G1 X94.710 Y67.906 F2500
+G1 X94.777 Y68.104 F2500
+G1 X94.843 Y68.303 F2500
+G1 X94.910 Y68.501 F2500
+G1 X94.975 Y68.700 F2500
+G1 X95.041 Y68.899 F2500
+G1 X95.106 Y69.098 F2500
+G1 X95.170 Y69.298 F2500
+G1 X95.234 Y69.497 F2500
+G1 X95.298 Y69.696 F2500
+G1 X95.361 Y69.896 F2500
+G1 X95.424 Y70.096 F2500
+G1 X95.486 Y70.296 F2500
+G1 X95.548 Y70.496 F2500
+G1 X95.610 Y70.696 F2500
+G1 X95.671 Y70.896 F2500
+G1 X95.732 Y71.097 F2500
+G1 X95.792 Y71.297 F2500
+G1 X95.852 Y71.498 F2500
+G1 X95.912 Y71.699 F2500
+G1 X95.971 Y71.900 F2500
+G1 X96.029 Y72.101 F2500
+G1 X96.088 Y72.302 F2500
+G1 X96.145 Y72.503 F2500
+G1 X96.203 Y72.705 F2500
+G1 X96.260 Y72.906 F2500
+G1 X96.316 Y73.108 F2500
+G1 X96.372 Y73.310 F2500
+G1 X96.428 Y73.512 F2500
+G1 X96.483 Y73.714 F2500
+G1 X96.538 Y73.916 F2500
+G1 X96.593 Y74.118 F2500
+G1 X96.647 Y74.320 F2500
+G1 X96.700 Y74.523 F2500
+G1 X96.753 Y74.726 F2500
+G1 X96.806 Y74.928 F2500
+G1 X96.858 Y75.131 F2500
+G1 X96.910 Y75.334 F2500
+G1 X96.962 Y75.537 F2500
+G1 X97.013 Y75.740 F2500
+G1 X97.063 Y75.943 F2500
+G1 X97.113 Y76.147 F2500
+G1 X97.163 Y76.350 F2500
+G1 X97.212 Y76.554 F2500
+G1 X97.261 Y76.757 F2500
+G1 X97.310 Y76.961 F2500
+G1 X97.358 Y77.165 F2500
+G1 X97.406 Y77.369 F2500
+G1 X97.453 Y77.573 F2500
+G1 X97.499 Y77.777 F2500
+G1 X97.546 Y77.981 F2500
+G1 X97.592 Y78.186 F2500
+G1 X97.637 Y78.390 F2500
+G1 X97.682 Y78.595 F2500
+G1 X97.727 Y78.799 F2500
+G1 X97.771 Y79.004 F2500
+G1 X97.815 Y79.209 F2500
+G1 X97.858 Y79.414 F2500
+G1 X97.901 Y79.619 F2500
+G1 X97.943 Y79.824 F2500
+G1 X97.986 Y80.029 F2500
+G1 X98.027 Y80.234 F2500
+G1 X98.068 Y80.440 F2500
+G1 X98.109 Y80.645 F2500
+G1 X98.149 Y80.851 F2500
+G1 X98.189 Y81.056 F2500
+G1 X98.229 Y81.262 F2500
+G1 X98.268 Y81.468 F2500
+G1 X98.306 Y81.673 F2500
+G1 X98.345 Y81.879 F2500
+G1 X98.382 Y82.085 F2500
+G1 X98.420 Y82.292 F2500
+G1 X98.456 Y82.498 F2500
+G1 X98.493 Y82.704 F2500
+G1 X98.529 Y82.910 F2500
+G1 X98.564 Y83.117 F2500
+G1 X98.600 Y83.323 F2500
+G1 X98.634 Y83.530 F2500
+G1 X98.669 Y83.736 F2500
+G1 X98.702 Y83.943 F2500
+G1 X98.736 Y84.150 F2500
+G1 X98.769 Y84.357 F2500
+G1 X98.801 Y84.563 F2500
+G1 X98.833 Y84.770 F2500
+G1 X98.865 Y84.977 F2500
+G1 X98.896 Y85.185 F2500
+G1 X98.927 Y85.392 F2500
+G1 X98.958 Y85.599 F2500
+G1 X98.988 Y85.806 F2500
+G1 X99.017 Y86.014 F2500
+G1 X99.046 Y86.221 F2500
+G1 X99.075 Y86.428 F2500
+G1 X99.103 Y86.636 F2500
+G1 X99.131 Y86.844 F2500
+G1 X99.158 Y87.051 F2500
+G1 X99.185 Y87.259 F2500
+G1 X99.211 Y87.467 F2500
+G1 X99.238 Y87.674 F2500
+G1 X99.263 Y87.882 F2500
+G1 X99.288 Y88.090 F2500
+G1 X99.313 Y88.298 F2500
+G1 X99.337 Y88.506 F2500
+G1 X99.361 Y88.714 F2500
+G1 X99.385 Y88.922 F2500
+G1 X99.408 Y89.131 F2500
+G1 X99.430 Y89.339 F2500
+G1 X99.452 Y89.547 F2500
+G1 X99.474 Y89.755 F2500
+G1 X99.495 Y89.964 F2500
+G1 X99.516 Y90.172 F2500
+G1 X99.536 Y90.381 F2500
+G1 X99.556 Y90.589 F2500
+G1 X99.576 Y90.798 F2500
+G1 X99.595 Y91.006 F2500
+G1 X99.613 Y91.215 F2500
+G1 X99.632 Y91.424 F2500
+G1 X99.649 Y91.632 F2500
+G1 X99.667 Y91.841 F2500
+G1 X99.683 Y92.050 F2500
+G1 X99.700 Y92.258 F2500
+G1 X99.716 Y92.467 F2500
+G1 X99.731 Y92.676 F2500
+G1 X99.747 Y92.885 F2500
+G1 X99.761 Y93.094 F2500
+G1 X99.775 Y93.303 F2500
+G1 X99.789 Y93.512 F2500
+G1 X99.803 Y93.721 F2500
+G1 X99.816 Y93.930 F2500
+G1 X99.828 Y94.139 F2500
+G1 X99.840 Y94.348 F2500
+G1 X99.852 Y94.557 F2500
+G1 X99.863 Y94.766 F2500
+G1 X99.874 Y94.976 F2500
+G1 X99.884 Y95.185 F2500
+G1 X99.894 Y95.394 F2500
+G1 X99.903 Y95.603 F2500
+G1 X99.912 Y95.812 F2500
+G1 X99.921 Y96.022 F2500
+G1 X99.929 Y96.231 F2500
+G1 X99.937 Y96.440 F2500
+G1 X99.944 Y96.650 F2500
+G1 X99.951 Y96.859 F2500
+G1 X99.957 Y97.068 F2500
+G1 X99.963 Y97.278 F2500
+G1 X99.968 Y97.487 F2500
+G1 X99.973 Y97.696 F2500
+G1 X99.978 Y97.906 F2500
+G1 X99.982 Y98.115 F2500
+G1 X99.986 Y98.325 F2500
+G1 X99.989 Y98.534 F2500
+G1 X99.992 Y98.743 F2500
+G1 X99.995 Y98.953 F2500
+G1 X99.996 Y99.162 F2500
+G1 X99.998 Y99.372 F2500
+G1 X99.999 Y99.581 F2500
+G1 X100.000 Y99.791 F2500
+G1 X100.000 Y100.000 F2500
+G1 X100.000 Y100.209 F2500
+G1 X99.999 Y100.419 F2500
+G1 X99.998 Y100.628 F2500
+G1 X99.996 Y100.838 F2500
+G1 X99.995 Y101.047 F2500
+G1 X99.992 Y101.257 F2500
+G1 X99.989 Y101.466 F2500
+G1 X99.986 Y101.675 F2500
+G1 X99.982 Y101.885 F2500
+G1 X99.978 Y102.094 F2500
+G1 X99.973 Y102.304 F2500
+G1 X99.968 Y102.513 F2500
+G1 X99.963 Y102.722 F2500
+G1 X99.957 Y102.932 F2500
+G1 X99.951 Y103.141 F2500
+G1 X99.944 Y103.350 F2500
+G1 X99.937 Y103.560 F2500
+G1 X99.929 Y103.769 F2500
+G1 X99.921 Y103.978 F2500
+G1 X99.912 Y104.188 F2500
+G1 X99.903 Y104.397 F2500
+G1 X99.894 Y104.606 F2500
+G1 X99.884 Y104.815 F2500
+G1 X99.874 Y105.024 F2500
+G1 X99.863 Y105.234 F2500
+G1 X99.852 Y105.443 F2500
+G1 X99.840 Y105.652 F2500
+G1 X99.828 Y105.861 F2500
+G1 X99.816 Y106.070 F2500
+G1 X99.803 Y106.279 F2500
+G1 X99.789 Y106.488 F2500
+G1 X99.775 Y106.697 F2500
+G1 X99.761 Y106.906 F2500
+G1 X99.747 Y107.115 F2500
+G1 X99.731 Y107.324 F2500
+G1 X99.716 Y107.533 F2500
+G1 X99.700 Y107.742 F2500
+G1 X99.683 Y107.950 F2500
+G1 X99.667 Y108.159 F2500
+G1 X99.649 Y108.368 F2500
+G1 X99.632 Y108.576 F2500
+G1 X99.613 Y108.785 F2500
+G1 X99.595 Y108.994 F2500
+G1 X99.576 Y109.202 F2500
+G1 X99.556 Y109.411 F2500
+G1 X99.536 Y109.619 F2500
+G1 X99.516 Y109.828 F2500
+G1 X99.495 Y110.036 F2500
+G1 X99.474 Y110.245 F2500
+G1 X99.452 Y110.453 F2500
+G1 X99.430 Y110.661 F2500
+G1 X99.408 Y110.869 F2500
+G1 X99.385 Y111.078 F2500
+G1 X99.361 Y111.286 F2500
+G1 X99.337 Y111.494 F2500
+G1 X99.313 Y111.702 F2500
+G1 X99.288 Y111.910 F2500
+G1 X99.263 Y112.118 F2500
+G1 X99.238 Y112.326 F2500
+G1 X99.211 Y112.533 F2500
+G1 X99.185 Y112.741 F2500
+G1 X99.158 Y112.949 F2500
+G1 X99.131 Y113.156 F2500
+G1 X99.103 Y113.364 F2500
+G1 X99.075 Y113.572 F2500
+G1 X99.046 Y113.779 F2500
+G1 X99.017 Y113.986 F2500
+G1 X98.988 Y114.194 F2500
+G1 X98.958 Y114.401 F2500
+G1 X98.927 Y114.608 F2500
+G1 X98.896 Y114.815 F2500
+G1 X98.865 Y115.023 F2500
+G1 X98.833 Y115.230 F2500
+G1 X98.801 Y115.437 F2500
+G1 X98.769 Y115.643 F2500
+G1 X98.736 Y115.850 F2500
+G1 X98.702 Y116.057 F2500
+G1 X98.669 Y116.264 F2500
+G1 X98.634 Y116.470 F2500
+G1 X98.600 Y116.677 F2500
+G1 X98.564 Y116.883 F2500
+G1 X98.529 Y117.090 F2500
+G1 X98.493 Y117.296 F2500
+G1 X98.456 Y117.502 F2500
+G1 X98.420 Y117.708 F2500
+G1 X98.382 Y117.915 F2500
+G1 X98.345 Y118.121 F2500
+G1 X98.306 Y118.327 F2500
+G1 X98.268 Y118.532 F2500
+G1 X98.229 Y118.738 F2500
+G1 X98.189 Y118.944 F2500
+G1 X98.149 Y119.149 F2500
+G1 X98.109 Y119.355 F2500
+G1 X98.068 Y119.560 F2500
+G1 X98.027 Y119.766 F2500
+G1 X97.986 Y119.971 F2500
+G1 X97.943 Y120.176 F2500
+G1 X97.901 Y120.381 F2500
+G1 X97.858 Y120.586 F2500
+G1 X97.815 Y120.791 F2500
+G1 X97.771 Y120.996 F2500
+G1 X97.727 Y121.201 F2500
+G1 X97.682 Y121.405 F2500
+G1 X97.637 Y121.610 F2500
+G1 X97.592 Y121.814 F2500
+G1 X97.546 Y122.019 F2500
+G1 X97.499 Y122.223 F2500
+G1 X97.453 Y122.427 F2500
+G1 X97.406 Y122.631 F2500
+G1 X97.358 Y122.835 F2500
+G1 X97.310 Y123.039 F2500
+G1 X97.261 Y123.243 F2500
+G1 X97.212 Y123.446 F2500
+G1 X97.163 Y123.650 F2500
+G1 X97.113 Y123.853 F2500
+G1 X97.063 Y124.057 F2500
+G1 X97.013 Y124.260 F2500
+G1 X96.962 Y124.463 F2500
+G1 X96.910 Y124.666 F2500
+G1 X96.858 Y124.869 F2500
+G1 X96.806 Y125.072 F2500
+G1 X96.753 Y125.274 F2500
+G1 X96.700 Y125.477 F2500
+G1 X96.647 Y125.680 F2500
+G1 X96.593 Y125.882 F2500
+G1 X96.538 Y126.084 F2500
+G1 X96.483 Y126.286 F2500
+G1 X96.428 Y126.488 F2500
+G1 X96.372 Y126.690 F2500
+G1 X96.316 Y126.892 F2500
+G1 X96.260 Y127.094 F2500
+G1 X96.203 Y127.295 F2500
+G1 X96.145 Y127.497 F2500
+G1 X96.088 Y127.698 F2500
+G1 X96.029 Y127.899 F2500
+G1 X95.971 Y128.100 F2500
+G1 X95.912 Y128.301 F2500
+G1 X95.852 Y128.502 F2500
+G1 X95.792 Y128.703 F2500
+G1 X95.732 Y128.903 F2500
+G1 X95.671 Y129.104 F2500
+G1 X95.610 Y129.304 F2500
+G1 X95.548 Y129.504 F2500
+G1 X95.486 Y129.704 F2500
+G1 X95.424 Y129.904 F2500
+G1 X95.361 Y130.104 F2500
+G1 X95.298 Y130.304 F2500
+G1 X95.234 Y130.503 F2500
+G1 X95.170 Y130.702 F2500
+G1 X95.106 Y130.902 F2500
+G1 X95.041 Y131.101 F2500
+G1 X94.975 Y131.300 F2500
+G1 X94.910 Y131.499 F2500
+G1 X94.843 Y131.697 F2500
+G1 X94.777 Y131.896 F2500
+G1 X94.710 Y132.094 F2500
+G1 X94.642 Y132.293 F2500
+G1 X94.575 Y132.491 F2500
+G1 X94.506 Y132.689 F2500
+G1 X94.438 Y132.887 F2500
+G1 X94.369 Y133.084 F2500
+G1 X94.299 Y133.282 F2500
+G1 X94.229 Y133.479 F2500
+G1 X94.159 Y133.677 F2500
+G1 X94.088 Y133.874 F2500
+G1 X94.017 Y134.071 F2500
+G1 X93.945 Y134.268 F2500
+G1 X93.873 Y134.464 F2500
+G1 X93.801 Y134.661 F2500
+G1 X93.728 Y134.857 F2500
+G1 X93.655 Y135.053 F2500
+G1 X93.581 Y135.250 F2500
+G1 X93.507 Y135.445 F2500
+G1 X93.433 Y135.641 F2500
+G1 X93.358 Y135.837 F2500
+G1 X93.283 Y136.032 F2500
+G1 X93.207 Y136.228 F2500
+G1 X93.131 Y136.423 F2500
+G1 X93.055 Y136.618 F2500
+G1 X92.978 Y136.812 F2500
+G1 X92.900 Y137.007 F2500
+G1 X92.823 Y137.202 F2500
+G1 X92.745 Y137.396 F2500
+G1 X92.666 Y137.590 F2500
+G1 X92.587 Y137.784 F2500
+G1 X92.508 Y137.978 F2500
+G1 X92.428 Y138.172 F2500
+G1 X92.348 Y138.365 F2500
+G1 X92.267 Y138.558 F2500
+G1 X92.186 Y138.752 F2500
+G1 X92.105 Y138.945 F2500
+G1 X92.023 Y139.137 F2500
+G1 X91.941 Y139.330 F2500
+G1 X91.858 Y139.522 F2500
+G1 X91.775 Y139.715 F2500
+G1 X91.692 Y139.907 F2500
+G1 X91.608 Y140.099 F2500
+G1 X91.524 Y140.291 F2500
+G1 X91.440 Y140.482 F2500
+G1 X91.355 Y140.674 F2500
+G1 X91.269 Y140.865 F2500
+G1 X91.183 Y141.056 F2500
+G1 X91.097 Y141.247 F2500
+G1 X91.011 Y141.438 F2500
+G1 X90.924 Y141.628 F2500
+G1 X90.836 Y141.818 F2500
+G1 X90.748 Y142.009 F2500
+G1 X90.660 Y142.199 F2500
+G1 X90.572 Y142.388 F2500
+G1 X90.483 Y142.578 F2500
+G1 X90.393 Y142.767 F2500
+G1 X90.304 Y142.957 F2500
+G1 X90.213 Y143.146 F2500
+G1 X90.123 Y143.334 F2500
+G1 X90.032 Y143.523 F2500
+G1 X89.941 Y143.712 F2500
+G1 X89.849 Y143.900 F2500
+G1 X89.757 Y144.088 F2500
+G1 X89.664 Y144.276 F2500
+G1 X89.571 Y144.464 F2500
+G1 X89.478 Y144.651 F2500
+G1 X89.384 Y144.838 F2500
+G1 X89.290 Y145.025 F2500
+G1 X89.196 Y145.212 F2500
+G1 X89.101 Y145.399 F2500
+G1 X89.005 Y145.586 F2500
+G1 X88.910 Y145.772 F2500
+G1 X88.814 Y145.958 F2500
+G1 X88.717 Y146.144 F2500
+G1 X88.620 Y146.330 F2500
+G1 X88.523 Y146.515 F2500
+G1 X88.426 Y146.700 F2500
+G1 X88.328 Y146.886 F2500
+G1 X88.229 Y147.070 F2500
+G1 X88.130 Y147.255 F2500
+G1 X88.031 Y147.440 F2500
+G1 X87.932 Y147.624 F2500
+G1 X87.832 Y147.808 F2500
+G1 X87.731 Y147.992 F2500
+G1 X87.631 Y148.175 F2500
+G1 X87.530 Y148.359 F2500
+G1 X87.428 Y148.542 F2500
+G1 X87.326 Y148.725 F2500
+G1 X87.224 Y148.908 F2500
+G1 X87.121 Y149.090 F2500
+G1 X87.018 Y149.273 F2500
+G1 X86.915 Y149.455 F2500
+G1 X86.811 Y149.637 F2500
+G1 X86.707 Y149.819 F2500
+G1 X86.603 Y150.000 F2500
+G1 X86.498 Y150.181 F2500
+G1 X86.392 Y150.362 F2500
+G1 X86.287 Y150.543 F2500
+G1 X86.181 Y150.724 F2500
+G1 X86.074 Y150.904 F2500
+G1 X85.967 Y151.084 F2500
+G1 X85.860 Y151.264 F2500
+G1 X85.753 Y151.444 F2500
+G1 X85.645 Y151.623 F2500
+G1 X85.536 Y151.803 F2500
+G1 X85.428 Y151.982 F2500
+G1 X85.319 Y152.161 F2500
+G1 X85.209 Y152.339 F2500
+G1 X85.099 Y152.517 F2500
+G1 X84.989 Y152.696 F2500
+G1 X84.879 Y152.873 F2500
+G1 X84.768 Y153.051 F2500
+G1 X84.656 Y153.229 F2500
+G1 X84.545 Y153.406 F2500
+G1 X84.433 Y153.583 F2500
+G1 X84.320 Y153.759 F2500
+G1 X84.208 Y153.936 F2500
+G1 X84.094 Y154.112 F2500
+G1 X83.981 Y154.288 F2500
+G1 X83.867 Y154.464 F2500
+G1 X83.753 Y154.639 F2500
+G1 X83.638 Y154.815 F2500
+G1 X83.523 Y154.990 F2500
+G1 X83.408 Y155.165 F2500
+G1 X83.292 Y155.339 F2500
+G1 X83.176 Y155.513 F2500
+G1 X83.060 Y155.688 F2500
+G1 X82.943 Y155.861 F2500
+G1 X82.826 Y156.035 F2500
+G1 X82.708 Y156.208 F2500
+G1 X82.590 Y156.381 F2500
+G1 X82.472 Y156.554 F2500
+G1 X82.353 Y156.727 F2500
+G1 X82.234 Y156.899 F2500
+G1 X82.115 Y157.071 F2500
+G1 X81.995 Y157.243 F2500
+G1 X81.875 Y157.415 F2500
+G1 X81.755 Y157.586 F2500
+G1 X81.634 Y157.757 F2500
+G1 X81.513 Y157.928 F2500
+G1 X81.391 Y158.099 F2500
+G1 X81.269 Y158.269 F2500
+G1 X81.147 Y158.439 F2500
+G1 X81.025 Y158.609 F2500
+G1 X80.902 Y158.779 F2500
+G1 X80.778 Y158.948 F2500
+G1 X80.655 Y159.117 F2500
+G1 X80.531 Y159.286 F2500
+G1 X80.406 Y159.454 F2500
+G1 X80.282 Y159.622 F2500
+G1 X80.157 Y159.790 F2500
+G1 X80.031 Y159.958 F2500
+G1 X79.906 Y160.126 F2500
+G1 X79.779 Y160.293 F2500
+G1 X79.653 Y160.460 F2500
+G1 X79.526 Y160.627 F2500
+G1 X79.399 Y160.793 F2500
+G1 X79.272 Y160.959 F2500
+G1 X79.144 Y161.125 F2500
+G1 X79.016 Y161.291 F2500
+G1 X78.887 Y161.456 F2500
+G1 X78.758 Y161.621 F2500
+G1 X78.629 Y161.786 F2500
+G1 X78.499 Y161.951 F2500
+G1 X78.369 Y162.115 F2500
+G1 X78.239 Y162.279 F2500
+G1 X78.108 Y162.443 F2500
+G1 X77.978 Y162.606 F2500
+G1 X77.846 Y162.769 F2500
+G1 X77.715 Y162.932 F2500
+G1 X77.583 Y163.095 F2500
+G1 X77.450 Y163.257 F2500
+G1 X77.318 Y163.419 F2500
+G1 X77.185 Y163.581 F2500
+G1 X77.051 Y163.742 F2500
+G1 X76.918 Y163.904 F2500
+G1 X76.784 Y164.065 F2500
+G1 X76.649 Y164.225 F2500
+G1 X76.515 Y164.386 F2500
+G1 X76.380 Y164.546 F2500
+G1 X76.244 Y164.706 F2500
+G1 X76.109 Y164.865 F2500
+G1 X75.973 Y165.024 F2500
+G1 X75.836 Y165.183 F2500
+G1 X75.700 Y165.342 F2500
+G1 X75.562 Y165.500 F2500
+G1 X75.425 Y165.659 F2500
+G1 X75.287 Y165.816 F2500
+G1 X75.149 Y165.974 F2500
+G1 X75.011 Y166.131 F2500
+G1 X74.872 Y166.288 F2500
+G1 X74.733 Y166.445 F2500
+G1 X74.594 Y166.601 F2500
+G1 X74.454 Y166.757 F2500
+G1 X74.314 Y166.913 F2500
+G1 X74.174 Y167.069 F2500
+G1 X74.034 Y167.224 F2500
+G1 X73.893 Y167.379 F2500
+G1 X73.751 Y167.533 F2500
+G1 X73.610 Y167.688 F2500
+G1 X73.468 Y167.842 F2500
+G1 X73.326 Y167.995 F2500
+G1 X73.183 Y168.149 F2500
+G1 X73.040 Y168.302 F2500
+G1 X72.897 Y168.455 F2500
+G1 X72.753 Y168.607 F2500
+G1 X72.609 Y168.759 F2500
+G1 X72.465 Y168.911 F2500
+G1 X72.321 Y169.063 F2500
+G1 X72.176 Y169.214 F2500
+G1 X72.031 Y169.365 F2500
+G1 X71.885 Y169.516 F2500
+G1 X71.740 Y169.666 F2500
+G1 X71.594 Y169.817 F2500
+G1 X71.447 Y169.966 F2500
+G1 X71.301 Y170.116 F2500
+G1 X71.154 Y170.265 F2500
+G1 X71.006 Y170.414 F2500
+G1 X70.859 Y170.562 F2500
+G1 X70.711 Y170.711 F2500
+G1 X70.562 Y170.859 F2500
+G1 X70.414 Y171.006 F2500
+G1 X70.265 Y171.154 F2500
+G1 X70.116 Y171.301 F2500
+G1 X69.966 Y171.447 F2500
+G1 X69.817 Y171.594 F2500
+G1 X69.666 Y171.740 F2500
+G1 X69.516 Y171.885 F2500
+G1 X69.365 Y172.031 F2500
+G1 X69.214 Y172.176 F2500
+G1 X69.063 Y172.321 F2500
+G1 X68.911 Y172.465 F2500
+G1 X68.759 Y172.609 F2500
+G1 X68.607 Y172.753 F2500
+G1 X68.455 Y172.897 F2500
+G1 X68.302 Y173.040 F2500
+G1 X68.149 Y173.183 F2500
+G1 X67.995 Y173.326 F2500
+G1 X67.842 Y173.468 F2500
+G1 X67.688 Y173.610 F2500
+G1 X67.533 Y173.751 F2500
+G1 X67.379 Y173.893 F2500
+G1 X67.224 Y174.034 F2500
+G1 X67.069 Y174.174 F2500
+G1 X66.913 Y174.314 F2500
+G1 X66.757 Y174.454 F2500
+G1 X66.601 Y174.594 F2500
+G1 X66.445 Y174.733 F2500
+G1 X66.288 Y174.872 F2500
+G1 X66.131 Y175.011 F2500
+G1 X65.974 Y175.149 F2500
+G1 X65.816 Y175.287 F2500
+G1 X65.659 Y175.425 F2500
+G1 X65.500 Y175.562 F2500
+G1 X65.342 Y175.700 F2500
+G1 X65.183 Y175.836 F2500
+G1 X65.024 Y175.973 F2500
+G1 X64.865 Y176.109 F2500
+G1 X64.706 Y176.244 F2500
+G1 X64.546 Y176.380 F2500
+G1 X64.386 Y176.515 F2500
+G1 X64.225 Y176.649 F2500
+G1 X64.065 Y176.784 F2500
+G1 X63.904 Y176.918 F2500
+G1 X63.742 Y177.051 F2500
+G1 X63.581 Y177.185 F2500
+G1 X63.419 Y177.318 F2500
+G1 X63.257 Y177.450 F2500
+G1 X63.095 Y177.583 F2500
+G1 X62.932 Y177.715 F2500
+G1 X62.769 Y177.846 F2500
+G1 X62.606 Y177.978 F2500
+G1 X62.443 Y178.108 F2500
+G1 X62.279 Y178.239 F2500
+G1 X62.115 Y178.369 F2500
+G1 X61.951 Y178.499 F2500
+G1 X61.786 Y178.629 F2500
+G1 X61.621 Y178.758 F2500
+G1 X61.456 Y178.887 F2500
+G1 X61.291 Y179.016 F2500
+G1 X61.125 Y179.144 F2500
+G1 X60.959 Y179.272 F2500
+G1 X60.793 Y179.399 F2500
+G1 X60.627 Y179.526 F2500
+G1 X60.460 Y179.653 F2500
+G1 X60.293 Y179.779 F2500
+G1 X60.126 Y179.906 F2500
+G1 X59.958 Y180.031 F2500
+G1 X59.790 Y180.157 F2500
+G1 X59.622 Y180.282 F2500
+G1 X59.454 Y180.406 F2500
+G1 X59.286 Y180.531 F2500
+G1 X59.117 Y180.655 F2500
+G1 X58.948 Y180.778 F2500
+G1 X58.779 Y180.902 F2500
+G1 X58.609 Y181.025 F2500
+G1 X58.439 Y181.147 F2500
+G1 X58.269 Y181.269 F2500
+G1 X58.099 Y181.391 F2500
+G1 X57.928 Y181.513 F2500
+G1 X57.757 Y181.634 F2500
+G1 X57.586 Y181.755 F2500
+G1 X57.415 Y181.875 F2500
+G1 X57.243 Y181.995 F2500
+G1 X57.071 Y182.115 F2500
+G1 X56.899 Y182.234 F2500
+G1 X56.727 Y182.353 F2500
+G1 X56.554 Y182.472 F2500
+G1 X56.381 Y182.590 F2500
+G1 X56.208 Y182.708 F2500
+G1 X56.035 Y182.826 F2500
+G1 X55.861 Y182.943 F2500
+G1 X55.688 Y183.060 F2500
+G1 X55.513 Y183.176 F2500
+G1 X55.339 Y183.292 F2500
+G1 X55.165 Y183.408 F2500
+G1 X54.990 Y183.523 F2500
+G1 X54.815 Y183.638 F2500
+G1 X54.639 Y183.753 F2500
+G1 X54.464 Y183.867 F2500
+G1 X54.288 Y183.981 F2500
+G1 X54.112 Y184.094 F2500
+G1 X53.936 Y184.208 F2500
+G1 X53.759 Y184.320 F2500
+G1 X53.583 Y184.433 F2500
+G1 X53.406 Y184.545 F2500
+G1 X53.229 Y184.656 F2500
+G1 X53.051 Y184.768 F2500
+G1 X52.873 Y184.879 F2500
+G1 X52.696 Y184.989 F2500
+G1 X52.517 Y185.099 F2500
+G1 X52.339 Y185.209 F2500
+G1 X52.161 Y185.319 F2500
+G1 X51.982 Y185.428 F2500
+G1 X51.803 Y185.536 F2500
+G1 X51.623 Y185.645 F2500
+G1 X51.444 Y185.753 F2500
+G1 X51.264 Y185.860 F2500
+G1 X51.084 Y185.967 F2500
+G1 X50.904 Y186.074 F2500
+G1 X50.724 Y186.181 F2500
+G1 X50.543 Y186.287 F2500
+G1 X50.362 Y186.392 F2500
+G1 X50.181 Y186.498 F2500
+G1 X50.000 Y186.603 F2500
+G1 X49.819 Y186.707 F2500
+G1 X49.637 Y186.811 F2500
+G1 X49.455 Y186.915 F2500
+G1 X49.273 Y187.018 F2500
+G1 X49.090 Y187.121 F2500
+G1 X48.908 Y187.224 F2500
+G1 X48.725 Y187.326 F2500
+G1 X48.542 Y187.428 F2500
+G1 X48.359 Y187.530 F2500
+G1 X48.175 Y187.631 F2500
+G1 X47.992 Y187.731 F2500
+G1 X47.808 Y187.832 F2500
+G1 X47.624 Y187.932 F2500
+G1 X47.440 Y188.031 F2500
+G1 X47.255 Y188.130 F2500
+G1 X47.070 Y188.229 F2500
+G1 X46.886 Y188.328 F2500
+G1 X46.700 Y188.426 F2500
+G1 X46.515 Y188.523 F2500
+G1 X46.330 Y188.620 F2500
+G1 X46.144 Y188.717 F2500
+G1 X45.958 Y188.814 F2500
+G1 X45.772 Y188.910 F2500
+G1 X45.586 Y189.005 F2500
+G1 X45.399 Y189.101 F2500
+G1 X45.212 Y189.196 F2500
+G1 X45.025 Y189.290 F2500
+G1 X44.838 Y189.384 F2500
+G1 X44.651 Y189.478 F2500
+G1 X44.464 Y189.571 F2500
+G1 X44.276 Y189.664 F2500
+G1 X44.088 Y189.757 F2500
+G1 X43.900 Y189.849 F2500
+G1 X43.712 Y189.941 F2500
+G1 X43.523 Y190.032 F2500
+G1 X43.334 Y190.123 F2500
+G1 X43.146 Y190.213 F2500
+G1 X42.957 Y190.304 F2500
+G1 X42.767 Y190.393 F2500
+G1 X42.578 Y190.483 F2500
+G1 X42.388 Y190.572 F2500
+G1 X42.199 Y190.660 F2500
+G1 X42.009 Y190.748 F2500
+G1 X41.818 Y190.836 F2500
+G1 X41.628 Y190.924 F2500
+G1 X41.438 Y191.011 F2500
+G1 X41.247 Y191.097 F2500
+G1 X41.056 Y191.183 F2500
+G1 X40.865 Y191.269 F2500
+G1 X40.674 Y191.355 F2500
+G1 X40.482 Y191.440 F2500
+G1 X40.291 Y191.524 F2500
+G1 X40.099 Y191.608 F2500
+G1 X39.907 Y191.692 F2500
+G1 X39.715 Y191.775 F2500
+G1 X39.522 Y191.858 F2500
+G1 X39.330 Y191.941 F2500
+G1 X39.137 Y192.023 F2500
+G1 X38.945 Y192.105 F2500
+G1 X38.752 Y192.186 F2500
+G1 X38.558 Y192.267 F2500
+G1 X38.365 Y192.348 F2500
+G1 X38.172 Y192.428 F2500
+G1 X37.978 Y192.508 F2500
+G1 X37.784 Y192.587 F2500
+G1 X37.590 Y192.666 F2500
+G1 X37.396 Y192.745 F2500
+G1 X37.202 Y192.823 F2500
+G1 X37.007 Y192.900 F2500
+G1 X36.812 Y192.978 F2500
+G1 X36.618 Y193.055 F2500
+G1 X36.423 Y193.131 F2500
+G1 X36.228 Y193.207 F2500
+G1 X36.032 Y193.283 F2500
+G1 X35.837 Y193.358 F2500
+G1 X35.641 Y193.433 F2500
+G1 X35.445 Y193.507 F2500
+G1 X35.250 Y193.581 F2500
+G1 X35.053 Y193.655 F2500
+G1 X34.857 Y193.728 F2500
+G1 X34.661 Y193.801 F2500
+G1 X34.464 Y193.873 F2500
+G1 X34.268 Y193.945 F2500
+G1 X34.071 Y194.017 F2500
+G1 X33.874 Y194.088 F2500
+G1 X33.677 Y194.159 F2500
+G1 X33.479 Y194.229 F2500
+G1 X33.282 Y194.299 F2500
+G1 X33.084 Y194.369 F2500
+G1 X32.887 Y194.438 F2500
+G1 X32.689 Y194.506 F2500
+G1 X32.491 Y194.575 F2500
+G1 X32.293 Y194.642 F2500
+G1 X32.094 Y194.710 F2500
+G1 X31.896 Y194.777 F2500
+G1 X31.697 Y194.843 F2500
+G1 X31.499 Y194.910 F2500
+G1 X31.300 Y194.975 F2500
+G1 X31.101 Y195.041 F2500
+G1 X30.902 Y195.106 F2500
+G1 X30.702 Y195.170 F2500
+G1 X30.503 Y195.234 F2500
+G1 X30.304 Y195.298 F2500
+G1 X30.104 Y195.361 F2500
+G1 X29.904 Y195.424 F2500
+G1 X29.704 Y195.486 F2500
+G1 X29.504 Y195.548 F2500
+G1 X29.304 Y195.610 F2500
+G1 X29.104 Y195.671 F2500
+G1 X28.903 Y195.732 F2500
+G1 X28.703 Y195.792 F2500
+G1 X28.502 Y195.852 F2500
+G1 X28.301 Y195.912 F2500
+G1 X28.100 Y195.971 F2500
+G1 X27.899 Y196.029 F2500
+G1 X27.698 Y196.088 F2500
+G1 X27.497 Y196.145 F2500
+G1 X27.295 Y196.203 F2500
+G1 X27.094 Y196.260 F2500
+G1 X26.892 Y196.316 F2500
+G1 X26.690 Y196.372 F2500
+G1 X26.488 Y196.428 F2500
+G1 X26.286 Y196.483 F2500
+G1 X26.084 Y196.538 F2500
+G1 X25.882 Y196.593 F2500
+G1 X25.680 Y196.647 F2500
+G1 X25.477 Y196.700 F2500
+G1 X25.274 Y196.753 F2500
+G1 X25.072 Y196.806 F2500
+G1 X24.869 Y196.858 F2500
+G1 X24.666 Y196.910 F2500
+G1 X24.463 Y196.962 F2500
+G1 X24.260 Y197.013 F2500
+G1 X24.057 Y197.063 F2500
+G1 X23.853 Y197.113 F2500
+G1 X23.650 Y197.163 F2500
+G1 X23.446 Y197.212 F2500
+G1 X23.243 Y197.261 F2500
+G1 X23.039 Y197.310 F2500
+G1 X22.835 Y197.358 F2500
+G1 X22.631 Y197.406 F2500
+G1 X22.427 Y197.453 F2500
+G1 X22.223 Y197.499 F2500
+G1 X22.019 Y197.546 F2500
+G1 X21.814 Y197.592 F2500
+G1 X21.610 Y197.637 F2500
+G1 X21.405 Y197.682 F2500
+G1 X21.201 Y197.727 F2500
+G1 X20.996 Y197.771 F2500
+G1 X20.791 Y197.815 F2500
+G1 X20.586 Y197.858 F2500
+G1 X20.381 Y197.901 F2500
+G1 X20.176 Y197.943 F2500
+G1 X19.971 Y197.986 F2500
+G1 X19.766 Y198.027 F2500
+G1 X19.560 Y198.068 F2500
+G1 X19.355 Y198.109 F2500
+G1 X19.149 Y198.149 F2500
+G1 X18.944 Y198.189 F2500
+G1 X18.738 Y198.229 F2500
+G1 X18.532 Y198.268 F2500
+G1 X18.327 Y198.306 F2500
+G1 X18.121 Y198.345 F2500
+G1 X17.915 Y198.382 F2500
+G1 X17.708 Y198.420 F2500
+G1 X17.502 Y198.456 F2500
+G1 X17.296 Y198.493 F2500
+G1 X17.090 Y198.529 F2500
+G1 X16.883 Y198.564 F2500
+G1 X16.677 Y198.600 F2500
+G1 X16.470 Y198.634 F2500
+G1 X16.264 Y198.669 F2500
+G1 X16.057 Y198.702 F2500
+G1 X15.850 Y198.736 F2500
+G1 X15.643 Y198.769 F2500
+G1 X15.437 Y198.801 F2500
+G1 X15.230 Y198.833 F2500
+G1 X15.023 Y198.865 F2500
+G1 X14.815 Y198.896 F2500
+G1 X14.608 Y198.927 F2500
+G1 X14.401 Y198.958 F2500
+G1 X14.194 Y198.988 F2500
+G1 X13.986 Y199.017 F2500
+G1 X13.779 Y199.046 F2500
+G1 X13.572 Y199.075 F2500
+G1 X13.364 Y199.103 F2500
+G1 X13.156 Y199.131 F2500
+G1 X12.949 Y199.158 F2500
+G1 X12.741 Y199.185 F2500
+G1 X12.533 Y199.211 F2500
+G1 X12.326 Y199.238 F2500
+G1 X12.118 Y199.263 F2500
+G1 X11.910 Y199.288 F2500
+G1 X11.702 Y199.313 F2500
+G1 X11.494 Y199.337 F2500
+G1 X11.286 Y199.361 F2500
+G1 X11.078 Y199.385 F2500
+G1 X10.869 Y199.408 F2500
+G1 X10.661 Y199.430 F2500
+G1 X10.453 Y199.452 F2500
+G1 X10.245 Y199.474 F2500
+G1 X10.036 Y199.495 F2500
+G1 X9.828 Y199.516 F2500
+G1 X9.619 Y199.536 F2500
+G1 X9.411 Y199.556 F2500
+G1 X9.202 Y199.576 F2500
+G1 X8.994 Y199.595 F2500
+G1 X8.785 Y199.613 F2500
+G1 X8.576 Y199.632 F2500
+G1 X8.368 Y199.649 F2500
+G1 X8.159 Y199.667 F2500
+G1 X7.950 Y199.683 F2500
+G1 X7.742 Y199.700 F2500
+G1 X7.533 Y199.716 F2500
+G1 X7.324 Y199.731 F2500
+G1 X7.115 Y199.747 F2500
+G1 X6.906 Y199.761 F2500
+G1 X6.697 Y199.775 F2500
+G1 X6.488 Y199.789 F2500
+G1 X6.279 Y199.803 F2500
+G1 X6.070 Y199.816 F2500
+G1 X5.861 Y199.828 F2500
+G1 X5.652 Y199.840 F2500
+G1 X5.443 Y199.852 F2500
+G1 X5.234 Y199.863 F2500
+G1 X5.024 Y199.874 F2500
+G1 X4.815 Y199.884 F2500
+G1 X4.606 Y199.894 F2500
+G1 X4.397 Y199.903 F2500
+G1 X4.188 Y199.912 F2500
+G1 X3.978 Y199.921 F2500
+G1 X3.769 Y199.929 F2500
+G1 X3.560 Y199.937 F2500
+G1 X3.350 Y199.944 F2500
+G1 X3.141 Y199.951 F2500
+G1 X2.932 Y199.957 F2500
+G1 X2.722 Y199.963 F2500
+G1 X2.513 Y199.968 F2500
+G1 X2.304 Y199.973 F2500
+G1 X2.094 Y199.978 F2500
+G1 X1.885 Y199.982 F2500
+G1 X1.675 Y199.986 F2500
+G1 X1.466 Y199.989 F2500
+G1 X1.257 Y199.992 F2500
+G1 X1.047 Y199.995 F2500
+G1 X0.838 Y199.996 F2500
+G1 X0.628 Y199.998 F2500
+G1 X0.419 Y199.999 F2500
+G1 X0.209 Y200.000 F2500
+G1 X0.000 Y200.000 F2500
+G1 X-0.209 Y200.000 F2500
+G1 X-0.419 Y199.999 F2500
+G1 X-0.628 Y199.998 F2500
+G1 X-0.838 Y199.996 F2500
+G1 X-1.047 Y199.995 F2500
+G1 X-1.257 Y199.992 F2500
+G1 X-1.466 Y199.989 F2500
+G1 X-1.675 Y199.986 F2500
+G1 X-1.885 Y199.982 F2500
+G1 X-2.094 Y199.978 F2500
+G1 X-2.304 Y199.973 F2500
+G1 X-2.513 Y199.968 F2500
+G1 X-2.722 Y199.963 F2500
+G1 X-2.932 Y199.957 F2500
+G1 X-3.141 Y199.951 F2500
+G1 X-3.350 Y199.944 F2500
+G1 X-3.560 Y199.937 F2500
+G1 X-3.769 Y199.929 F2500
+G1 X-3.978 Y199.921 F2500
+G1 X-4.188 Y199.912 F2500
+G1 X-4.397 Y199.903 F2500
+G1 X-4.606 Y199.894 F2500
+G1 X-4.815 Y199.884 F2500
+G1 X-5.024 Y199.874 F2500
+G1 X-5.234 Y199.863 F2500
+G1 X-5.443 Y199.852 F2500
+G1 X-5.652 Y199.840 F2500
+G1 X-5.861 Y199.828 F2500
+G1 X-6.070 Y199.816 F2500
+G1 X-6.279 Y199.803 F2500
+G1 X-6.488 Y199.789 F2500
+G1 X-6.697 Y199.775 F2500
+G1 X-6.906 Y199.761 F2500
+G1 X-7.115 Y199.747 F2500
+G1 X-7.324 Y199.731 F2500
+G1 X-7.533 Y199.716 F2500
+G1 X-7.742 Y199.700 F2500
+G1 X-7.950 Y199.683 F2500
+G1 X-8.159 Y199.667 F2500
+G1 X-8.368 Y199.649 F2500
+G1 X-8.576 Y199.632 F2500
+G1 X-8.785 Y199.613 F2500
+G1 X-8.994 Y199.595 F2500
+G1 X-9.202 Y199.576 F2500
+G1 X-9.411 Y199.556 F2500
+G1 X-9.619 Y199.536 F2500
+G1 X-9.828 Y199.516 F2500
+G1 X-10.036 Y199.495 F2500
+G1 X-10.245 Y199.474 F2500
+G1 X-10.453 Y199.452 F2500
+G1 X-10.661 Y199.430 F2500
+G1 X-10.869 Y199.408 F2500
+G1 X-11.078 Y199.385 F2500
+G1 X-11.286 Y199.361 F2500
+G1 X-11.494 Y199.337 F2500
+G1 X-11.702 Y199.313 F2500
+G1 X-11.910 Y199.288 F2500
+G1 X-12.118 Y199.263 F2500
+G1 X-12.326 Y199.238 F2500
+G1 X-12.533 Y199.211 F2500
+G1 X-12.741 Y199.185 F2500
+G1 X-12.949 Y199.158 F2500
+G1 X-13.156 Y199.131 F2500
+G1 X-13.364 Y199.103 F2500
+G1 X-13.572 Y199.075 F2500
+G1 X-13.779 Y199.046 F2500
+G1 X-13.986 Y199.017 F2500
+G1 X-14.194 Y198.988 F2500
+G1 X-14.401 Y198.958 F2500
+G1 X-14.608 Y198.927 F2500
+G1 X-14.815 Y198.896 F2500
+G1 X-15.023 Y198.865 F2500
+G1 X-15.230 Y198.833 F2500
+G1 X-15.437 Y198.801 F2500
+G1 X-15.643 Y198.769 F2500
+G1 X-15.850 Y198.736 F2500
+G1 X-16.057 Y198.702 F2500
+G1 X-16.264 Y198.669 F2500
+G1 X-16.470 Y198.634 F2500
+G1 X-16.677 Y198.600 F2500
+G1 X-16.883 Y198.564 F2500
+G1 X-17.090 Y198.529 F2500
+G1 X-17.296 Y198.493 F2500
+G1 X-17.502 Y198.456 F2500
+G1 X-17.708 Y198.420 F2500
+G1 X-17.915 Y198.382 F2500
+G1 X-18.121 Y198.345 F2500
+G1 X-18.327 Y198.306 F2500
+G1 X-18.532 Y198.268 F2500
+G1 X-18.738 Y198.229 F2500
+G1 X-18.944 Y198.189 F2500
+G1 X-19.149 Y198.149 F2500
+G1 X-19.355 Y198.109 F2500
+G1 X-19.560 Y198.068 F2500
+G1 X-19.766 Y198.027 F2500
+G1 X-19.971 Y197.986 F2500
+G1 X-20.176 Y197.943 F2500
+G1 X-20.381 Y197.901 F2500
+G1 X-20.586 Y197.858 F2500
+G1 X-20.791 Y197.815 F2500
+G1 X-20.996 Y197.771 F2500
+G1 X-21.201 Y197.727 F2500
+G1 X-21.405 Y197.682 F2500
+G1 X-21.610 Y197.637 F2500
+G1 X-21.814 Y197.592 F2500
+G1 X-22.019 Y197.546 F2500
+G1 X-22.223 Y197.499 F2500
+G1 X-22.427 Y197.453 F2500
+G1 X-22.631 Y197.406 F2500
+G1 X-22.835 Y197.358 F2500
+G1 X-23.039 Y197.310 F2500
+G1 X-23.243 Y197.261 F2500
+G1 X-23.446 Y197.212 F2500
+G1 X-23.650 Y197.163 F2500
+G1 X-23.853 Y197.113 F2500
+G1 X-24.057 Y197.063 F2500
+G1 X-24.260 Y197.013 F2500
+G1 X-24.463 Y196.962 F2500
+G1 X-24.666 Y196.910 F2500
+G1 X-24.869 Y196.858 F2500
+G1 X-25.072 Y196.806 F2500
+G1 X-25.274 Y196.753 F2500
+G1 X-25.477 Y196.700 F2500
+G1 X-25.680 Y196.647 F2500
+G1 X-25.882 Y196.593 F2500
+G1 X-26.084 Y196.538 F2500
+G1 X-26.286 Y196.483 F2500
+G1 X-26.488 Y196.428 F2500
+G1 X-26.690 Y196.372 F2500
+G1 X-26.892 Y196.316 F2500
+G1 X-27.094 Y196.260 F2500
+G1 X-27.295 Y196.203 F2500
+G1 X-27.497 Y196.145 F2500
+G1 X-27.698 Y196.088 F2500
+G1 X-27.899 Y196.029 F2500
+G1 X-28.100 Y195.971 F2500
+G1 X-28.301 Y195.912 F2500
+G1 X-28.502 Y195.852 F2500
+G1 X-28.703 Y195.792 F2500
+G1 X-28.903 Y195.732 F2500
+G1 X-29.104 Y195.671 F2500
+G1 X-29.304 Y195.610 F2500
+G1 X-29.504 Y195.548 F2500
+G1 X-29.704 Y195.486 F2500
+G1 X-29.904 Y195.424 F2500
+G1 X-30.104 Y195.361 F2500
+G1 X-30.304 Y195.298 F2500
+G1 X-30.503 Y195.234 F2500
+G1 X-30.702 Y195.170 F2500
+G1 X-30.902 Y195.106 F2500
+G1 X-31.101 Y195.041 F2500
+G1 X-31.300 Y194.975 F2500
+G1 X-31.499 Y194.910 F2500
+G1 X-31.697 Y194.843 F2500
+G1 X-31.896 Y194.777 F2500
+G1 X-32.094 Y194.710 F2500
+G1 X-32.293 Y194.642 F2500
+G1 X-32.491 Y194.575 F2500
+G1 X-32.689 Y194.506 F2500
+G1 X-32.887 Y194.438 F2500
+G1 X-33.084 Y194.369 F2500
+G1 X-33.282 Y194.299 F2500
+G1 X-33.479 Y194.229 F2500
+G1 X-33.677 Y194.159 F2500
+G1 X-33.874 Y194.088 F2500
+G1 X-34.071 Y194.017 F2500
+G1 X-34.268 Y193.945 F2500
+G1 X-34.464 Y193.873 F2500
+G1 X-34.661 Y193.801 F2500
+G1 X-34.857 Y193.728 F2500
+G1 X-35.053 Y193.655 F2500
+G1 X-35.250 Y193.581 F2500
+G1 X-35.445 Y193.507 F2500
+G1 X-35.641 Y193.433 F2500
+G1 X-35.837 Y193.358 F2500
+G1 X-36.032 Y193.283 F2500
+G1 X-36.228 Y193.207 F2500
+G1 X-36.423 Y193.131 F2500
+G1 X-36.618 Y193.055 F2500
+G1 X-36.812 Y192.978 F2500
+G1 X-37.007 Y192.900 F2500
+G1 X-37.202 Y192.823 F2500
+G1 X-37.396 Y192.745 F2500
+G1 X-37.590 Y192.666 F2500
+G1 X-37.784 Y192.587 F2500
+G1 X-37.978 Y192.508 F2500
+G1 X-38.172 Y192.428 F2500
+G1 X-38.365 Y192.348 F2500
+G1 X-38.558 Y192.267 F2500
+G1 X-38.752 Y192.186 F2500
+G1 X-38.945 Y192.105 F2500
+G1 X-39.137 Y192.023 F2500
+G1 X-39.330 Y191.941 F2500
+G1 X-39.522 Y191.858 F2500
+G1 X-39.715 Y191.775 F2500
+G1 X-39.907 Y191.692 F2500
+G1 X-40.099 Y191.608 F2500
+G1 X-40.291 Y191.524 F2500
+G1 X-40.482 Y191.440 F2500
+G1 X-40.674 Y191.355 F2500
+G1 X-40.865 Y191.269 F2500
+G1 X-41.056 Y191.183 F2500
+G1 X-41.247 Y191.097 F2500
+G1 X-41.438 Y191.011 F2500
+G1 X-41.628 Y190.924 F2500
+G1 X-41.818 Y190.836 F2500
+G1 X-42.009 Y190.748 F2500
+G1 X-42.199 Y190.660 F2500
+G1 X-42.388 Y190.572 F2500
+G1 X-42.578 Y190.483 F2500
+G1 X-42.767 Y190.393 F2500
+G1 X-42.957 Y190.304 F2500
+G1 X-43.146 Y190.213 F2500
+G1 X-43.334 Y190.123 F2500
+G1 X-43.523 Y190.032 F2500
+G1 X-43.712 Y189.941 F2500
+G1 X-43.900 Y189.849 F2500
+G1 X-44.088 Y189.757 F2500
+G1 X-44.276 Y189.664 F2500
+G1 X-44.464 Y189.571 F2500
+G1 X-44.651 Y189.478 F2500
+G1 X-44.838 Y189.384 F2500
+G1 X-45.025 Y189.290 F2500
+G1 X-45.212 Y189.196 F2500
+G1 X-45.399 Y189.101 F2500
+G1 X-45.586 Y189.005 F2500
+G1 X-45.772 Y188.910 F2500
+G1 X-45.958 Y188.814 F2500
+G1 X-46.144 Y188.717 F2500
+G1 X-46.330 Y188.620 F2500
+G1 X-46.515 Y188.523 F2500
+G1 X-46.700 Y188.426 F2500
+G1 X-46.886 Y188.328 F2500
+G1 X-47.070 Y188.229 F2500
+G1 X-47.255 Y188.130 F2500
+G1 X-47.440 Y188.031 F2500
+G1 X-47.624 Y187.932 F2500
+G1 X-47.808 Y187.832 F2500
+G1 X-47.992 Y187.731 F2500
+G1 X-48.175 Y187.631 F2500
+G1 X-48.359 Y187.530 F2500
+G1 X-48.542 Y187.428 F2500
+G1 X-48.725 Y187.326 F2500
+G1 X-48.908 Y187.224 F2500
+G1 X-49.090 Y187.121 F2500
+G1 X-49.273 Y187.018 F2500
+G1 X-49.455 Y186.915 F2500
+G1 X-49.637 Y186.811 F2500
+G1 X-49.819 Y186.707 F2500
+G1 X-50.000 Y186.603 F2500
+G1 X-50.181 Y186.498 F2500
+G1 X-50.362 Y186.392 F2500
+G1 X-50.543 Y186.287 F2500
+G1 X-50.724 Y186.181 F2500
+G1 X-50.904 Y186.074 F2500
+G1 X-51.084 Y185.967 F2500
+G1 X-51.264 Y185.860 F2500
+G1 X-51.444 Y185.753 F2500
+G1 X-51.623 Y185.645 F2500
+G1 X-51.803 Y185.536 F2500
+G1 X-51.982 Y185.428 F2500
+G1 X-52.161 Y185.319 F2500
+G1 X-52.339 Y185.209 F2500
+G1 X-52.517 Y185.099 F2500
+G1 X-52.696 Y184.989 F2500
+G1 X-52.873 Y184.879 F2500
+G1 X-53.051 Y184.768 F2500
+G1 X-53.229 Y184.656 F2500
+G1 X-53.406 Y184.545 F2500
+G1 X-53.583 Y184.433 F2500
+G1 X-53.759 Y184.320 F2500
+G1 X-53.936 Y184.208 F2500
+G1 X-54.112 Y184.094 F2500
+G1 X-54.288 Y183.981 F2500
+G1 X-54.464 Y183.867 F2500
+G1 X-54.639 Y183.753 F2500
+G1 X-54.815 Y183.638 F2500
+G1 X-54.990 Y183.523 F2500
+G1 X-55.165 Y183.408 F2500
+G1 X-55.339 Y183.292 F2500
+G1 X-55.513 Y183.176 F2500
+G1 X-55.688 Y183.060 F2500
+G1 X-55.861 Y182.943 F2500
+G1 X-56.035 Y182.826 F2500
+G1 X-56.208 Y182.708 F2500
+G1 X-56.381 Y182.590 F2500
+G1 X-56.554 Y182.472 F2500
+G1 X-56.727 Y182.353 F2500
+G1 X-56.899 Y182.234 F2500
+G1 X-57.071 Y182.115 F2500
+G1 X-57.243 Y181.995 F2500
+G1 X-57.415 Y181.875 F2500
+G1 X-57.586 Y181.755 F2500
+G1 X-57.757 Y181.634 F2500
+G1 X-57.928 Y181.513 F2500
+G1 X-58.099 Y181.391 F2500
+G1 X-58.269 Y181.269 F2500
+G1 X-58.439 Y181.147 F2500
+G1 X-58.609 Y181.025 F2500
+G1 X-58.779 Y180.902 F2500
+G1 X-58.948 Y180.778 F2500
+G1 X-59.117 Y180.655 F2500
+G1 X-59.286 Y180.531 F2500
+G1 X-59.454 Y180.406 F2500
+G1 X-59.622 Y180.282 F2500
+G1 X-59.790 Y180.157 F2500
+G1 X-59.958 Y180.031 F2500
+G1 X-60.126 Y179.906 F2500
+G1 X-60.293 Y179.779 F2500
+G1 X-60.460 Y179.653 F2500
+G1 X-60.627 Y179.526 F2500
+G1 X-60.793 Y179.399 F2500
+G1 X-60.959 Y179.272 F2500
+G1 X-61.125 Y179.144 F2500
+G1 X-61.291 Y179.016 F2500
+G1 X-61.456 Y178.887 F2500
+G1 X-61.621 Y178.758 F2500
+G1 X-61.786 Y178.629 F2500
+G1 X-61.951 Y178.499 F2500
+G1 X-62.115 Y178.369 F2500
+G1 X-62.279 Y178.239 F2500
+G1 X-62.443 Y178.108 F2500
+G1 X-62.606 Y177.978 F2500
+G1 X-62.769 Y177.846 F2500
+G1 X-62.932 Y177.715 F2500
+G1 X-63.095 Y177.583 F2500
+G1 X-63.257 Y177.450 F2500
+G1 X-63.419 Y177.318 F2500
+G1 X-63.581 Y177.185 F2500
+G1 X-63.742 Y177.051 F2500
+G1 X-63.904 Y176.918 F2500
+G1 X-64.065 Y176.784 F2500
+G1 X-64.225 Y176.649 F2500
+G1 X-64.386 Y176.515 F2500
+G1 X-64.546 Y176.380 F2500
+G1 X-64.706 Y176.244 F2500
+G1 X-64.865 Y176.109 F2500
+G1 X-65.024 Y175.973 F2500
+G1 X-65.183 Y175.836 F2500
+G1 X-65.342 Y175.700 F2500
+G1 X-65.500 Y175.562 F2500
+G1 X-65.659 Y175.425 F2500
+G1 X-65.816 Y175.287 F2500
+G1 X-65.974 Y175.149 F2500
+G1 X-66.131 Y175.011 F2500
+G1 X-66.288 Y174.872 F2500
+G1 X-66.445 Y174.733 F2500
+G1 X-66.601 Y174.594 F2500
+G1 X-66.757 Y174.454 F2500
+G1 X-66.913 Y174.314 F2500
+G1 X-67.069 Y174.174 F2500
+G1 X-67.224 Y174.034 F2500
+G1 X-67.379 Y173.893 F2500
+G1 X-67.533 Y173.751 F2500
+G1 X-67.688 Y173.610 F2500
+G1 X-67.842 Y173.468 F2500
+G1 X-67.995 Y173.326 F2500
+G1 X-68.149 Y173.183 F2500
+G1 X-68.302 Y173.040 F2500
+G1 X-68.455 Y172.897 F2500
+G1 X-68.607 Y172.753 F2500
+G1 X-68.759 Y172.609 F2500
+G1 X-68.911 Y172.465 F2500
+G1 X-69.063 Y172.321 F2500
+G1 X-69.214 Y172.176 F2500
+G1 X-69.365 Y172.031 F2500
+G1 X-69.516 Y171.885 F2500
+G1 X-69.666 Y171.740 F2500
+G1 X-69.817 Y171.594 F2500
+G1 X-69.966 Y171.447 F2500
+G1 X-70.116 Y171.301 F2500
+G1 X-70.265 Y171.154 F2500
+G1 X-70.414 Y171.006 F2500
+G1 X-70.562 Y170.859 F2500
+G1 X-70.711 Y170.711 F2500
+G1 X-70.859 Y170.562 F2500
+G1 X-71.006 Y170.414 F2500
+G1 X-71.154 Y170.265 F2500
+G1 X-71.301 Y170.116 F2500
+G1 X-71.447 Y169.966 F2500
+G1 X-71.594 Y169.817 F2500
+G1 X-71.740 Y169.666 F2500
+G1 X-71.885 Y169.516 F2500
+G1 X-72.031 Y169.365 F2500
+G1 X-72.176 Y169.214 F2500
+G1 X-72.321 Y169.063 F2500
+G1 X-72.465 Y168.911 F2500
+G1 X-72.609 Y168.759 F2500
+G1 X-72.753 Y168.607 F2500
+G1 X-72.897 Y168.455 F2500
+G1 X-73.040 Y168.302 F2500
+G1 X-73.183 Y168.149 F2500
+G1 X-73.326 Y167.995 F2500
+G1 X-73.468 Y167.842 F2500
+G1 X-73.610 Y167.688 F2500
+G1 X-73.751 Y167.533 F2500
+G1 X-73.893 Y167.379 F2500
+G1 X-74.034 Y167.224 F2500
+G1 X-74.174 Y167.069 F2500
+G1 X-74.314 Y166.913 F2500
+G1 X-74.454 Y166.757 F2500
+G1 X-74.594 Y166.601 F2500
+G1 X-74.733 Y166.445 F2500
+G1 X-74.872 Y166.288 F2500
+G1 X-75.011 Y166.131 F2500
+G1 X-75.149 Y165.974 F2500
+G1 X-75.287 Y165.816 F2500
+G1 X-75.425 Y165.659 F2500
+G1 X-75.562 Y165.500 F2500
+G1 X-75.700 Y165.342 F2500
+G1 X-75.836 Y165.183 F2500
+G1 X-75.973 Y165.024 F2500
+G1 X-76.109 Y164.865 F2500
+G1 X-76.244 Y164.706 F2500
+G1 X-76.380 Y164.546 F2500
+G1 X-76.515 Y164.386 F2500
+G1 X-76.649 Y164.225 F2500
+G1 X-76.784 Y164.065 F2500
+G1 X-76.918 Y163.904 F2500
+G1 X-77.051 Y163.742 F2500
+G1 X-77.185 Y163.581 F2500
+G1 X-77.318 Y163.419 F2500
+G1 X-77.450 Y163.257 F2500
+G1 X-77.583 Y163.095 F2500
+G1 X-77.715 Y162.932 F2500
+G1 X-77.846 Y162.769 F2500
+G1 X-77.978 Y162.606 F2500
+G1 X-78.108 Y162.443 F2500
+G1 X-78.239 Y162.279 F2500
+G1 X-78.369 Y162.115 F2500
+G1 X-78.499 Y161.951 F2500
+G1 X-78.629 Y161.786 F2500
+G1 X-78.758 Y161.621 F2500
+G1 X-78.887 Y161.456 F2500
+G1 X-79.016 Y161.291 F2500
+G1 X-79.144 Y161.125 F2500
+G1 X-79.272 Y160.959 F2500
+G1 X-79.399 Y160.793 F2500
+G1 X-79.526 Y160.627 F2500
+G1 X-79.653 Y160.460 F2500
+G1 X-79.779 Y160.293 F2500
+G1 X-79.906 Y160.126 F2500
+G1 X-80.031 Y159.958 F2500
+G1 X-80.157 Y159.790 F2500
+G1 X-80.282 Y159.622 F2500
+G1 X-80.406 Y159.454 F2500
+G1 X-80.531 Y159.286 F2500
+G1 X-80.655 Y159.117 F2500
+G1 X-80.778 Y158.948 F2500
+G1 X-80.902 Y158.779 F2500
+G1 X-81.025 Y158.609 F2500
+G1 X-81.147 Y158.439 F2500
+G1 X-81.269 Y158.269 F2500
+G1 X-81.391 Y158.099 F2500
+G1 X-81.513 Y157.928 F2500
+G1 X-81.634 Y157.757 F2500
+G1 X-81.755 Y157.586 F2500
+G1 X-81.875 Y157.415 F2500
+G1 X-81.995 Y157.243 F2500
+G1 X-82.115 Y157.071 F2500
+G1 X-82.234 Y156.899 F2500
+G1 X-82.353 Y156.727 F2500
+G1 X-82.472 Y156.554 F2500
+G1 X-82.590 Y156.381 F2500
+G1 X-82.708 Y156.208 F2500
+G1 X-82.826 Y156.035 F2500
+G1 X-82.943 Y155.861 F2500
+G1 X-83.060 Y155.688 F2500
+G1 X-83.176 Y155.513 F2500
+G1 X-83.292 Y155.339 F2500
+G1 X-83.408 Y155.165 F2500
+G1 X-83.523 Y154.990 F2500
+G1 X-83.638 Y154.815 F2500
+G1 X-83.753 Y154.639 F2500
+G1 X-83.867 Y154.464 F2500
+G1 X-83.981 Y154.288 F2500
+G1 X-84.094 Y154.112 F2500
+G1 X-84.208 Y153.936 F2500
+G1 X-84.320 Y153.759 F2500
+G1 X-84.433 Y153.583 F2500
+G1 X-84.545 Y153.406 F2500
+G1 X-84.656 Y153.229 F2500
+G1 X-84.768 Y153.051 F2500
+G1 X-84.879 Y152.873 F2500
+G1 X-84.989 Y152.696 F2500
+G1 X-85.099 Y152.517 F2500
+G1 X-85.209 Y152.339 F2500
+G1 X-85.319 Y152.161 F2500
+G1 X-85.428 Y151.982 F2500
+G1 X-85.536 Y151.803 F2500
+G1 X-85.645 Y151.623 F2500
+G1 X-85.753 Y151.444 F2500
+G1 X-85.860 Y151.264 F2500
+G1 X-85.967 Y151.084 F2500
+G1 X-86.074 Y150.904 F2500
+G1 X-86.181 Y150.724 F2500
+G1 X-86.287 Y150.543 F2500
+G1 X-86.392 Y150.362 F2500
+G1 X-86.498 Y150.181 F2500
+G1 X-86.603 Y150.000 F2500
+G1 X-86.707 Y149.819 F2500
+G1 X-86.811 Y149.637 F2500
+G1 X-86.915 Y149.455 F2500
+G1 X-87.018 Y149.273 F2500
+G1 X-87.121 Y149.090 F2500
+G1 X-87.224 Y148.908 F2500
+G1 X-87.326 Y148.725 F2500
+G1 X-87.428 Y148.542 F2500
+G1 X-87.530 Y148.359 F2500
+G1 X-87.631 Y148.175 F2500
+G1 X-87.731 Y147.992 F2500
+G1 X-87.832 Y147.808 F2500
+G1 X-87.932 Y147.624 F2500
+G1 X-88.031 Y147.440 F2500
+G1 X-88.130 Y147.255 F2500
+G1 X-88.229 Y147.070 F2500
+G1 X-88.328 Y146.886 F2500
+G1 X-88.426 Y146.700 F2500
+G1 X-88.523 Y146.515 F2500
+G1 X-88.620 Y146.330 F2500
+G1 X-88.717 Y146.144 F2500
+G1 X-88.814 Y145.958 F2500
+G1 X-88.910 Y145.772 F2500
+G1 X-89.005 Y145.586 F2500
+G1 X-89.101 Y145.399 F2500
+G1 X-89.196 Y145.212 F2500
+G1 X-89.290 Y145.025 F2500
+G1 X-89.384 Y144.838 F2500
+G1 X-89.478 Y144.651 F2500
+G1 X-89.571 Y144.464 F2500
+G1 X-89.664 Y144.276 F2500
+G1 X-89.757 Y144.088 F2500
+G1 X-89.849 Y143.900 F2500
+G1 X-89.941 Y143.712 F2500
+G1 X-90.032 Y143.523 F2500
+G1 X-90.123 Y143.334 F2500
+G1 X-90.213 Y143.146 F2500
+G1 X-90.304 Y142.957 F2500
+G1 X-90.393 Y142.767 F2500
+G1 X-90.483 Y142.578 F2500
+G1 X-90.572 Y142.388 F2500
+G1 X-90.660 Y142.199 F2500
+G1 X-90.748 Y142.009 F2500
+G1 X-90.836 Y141.818 F2500
+G1 X-90.924 Y141.628 F2500
+G1 X-91.011 Y141.438 F2500
+G1 X-91.097 Y141.247 F2500
+G1 X-91.183 Y141.056 F2500
+G1 X-91.269 Y140.865 F2500
+G1 X-91.355 Y140.674 F2500
+G1 X-91.440 Y140.482 F2500
+G1 X-91.524 Y140.291 F2500
+G1 X-91.608 Y140.099 F2500
+G1 X-91.692 Y139.907 F2500
+G1 X-91.775 Y139.715 F2500
+G1 X-91.858 Y139.522 F2500
+G1 X-91.941 Y139.330 F2500
+G1 X-92.023 Y139.137 F2500
+G1 X-92.105 Y138.945 F2500
+G1 X-92.186 Y138.752 F2500
+G1 X-92.267 Y138.558 F2500
+G1 X-92.348 Y138.365 F2500
+G1 X-92.428 Y138.172 F2500
+G1 X-92.508 Y137.978 F2500
+G1 X-92.587 Y137.784 F2500
+G1 X-92.666 Y137.590 F2500
+G1 X-92.745 Y137.396 F2500
+G1 X-92.823 Y137.202 F2500
+G1 X-92.900 Y137.007 F2500
+G1 X-92.978 Y136.812 F2500
+G1 X-93.055 Y136.618 F2500
+G1 X-93.131 Y136.423 F2500
+G1 X-93.207 Y136.228 F2500
+G1 X-93.283 Y136.032 F2500
+G1 X-93.358 Y135.837 F2500
+G1 X-93.433 Y135.641 F2500
+G1 X-93.507 Y135.445 F2500
+G1 X-93.581 Y135.250 F2500
+G1 X-93.655 Y135.053 F2500
+G1 X-93.728 Y134.857 F2500
+G1 X-93.801 Y134.661 F2500
+G1 X-93.873 Y134.464 F2500
+G1 X-93.945 Y134.268 F2500
+G1 X-94.017 Y134.071 F2500
+G1 X-94.088 Y133.874 F2500
+G1 X-94.159 Y133.677 F2500
+G1 X-94.229 Y133.479 F2500
+G1 X-94.299 Y133.282 F2500
+G1 X-94.369 Y133.084 F2500
+G1 X-94.438 Y132.887 F2500
+G1 X-94.506 Y132.689 F2500
+G1 X-94.575 Y132.491 F2500
+G1 X-94.642 Y132.293 F2500
+G1 X-94.710 Y132.094 F2500
+G1 X-94.777 Y131.896 F2500
+G1 X-94.843 Y131.697 F2500
+G1 X-94.910 Y131.499 F2500
+G1 X-94.975 Y131.300 F2500
+G1 X-95.041 Y131.101 F2500
+G1 X-95.106 Y130.902 F2500
+G1 X-95.170 Y130.702 F2500
+G1 X-95.234 Y130.503 F2500
+G1 X-95.298 Y130.304 F2500
+G1 X-95.361 Y130.104 F2500
+G1 X-95.424 Y129.904 F2500
+G1 X-95.486 Y129.704 F2500
+G1 X-95.548 Y129.504 F2500
+G1 X-95.610 Y129.304 F2500
+G1 X-95.671 Y129.104 F2500
+G1 X-95.732 Y128.903 F2500
+G1 X-95.792 Y128.703 F2500
+G1 X-95.852 Y128.502 F2500
+G1 X-95.912 Y128.301 F2500
+G1 X-95.971 Y128.100 F2500
+G1 X-96.029 Y127.899 F2500
+G1 X-96.088 Y127.698 F2500
+G1 X-96.145 Y127.497 F2500
+G1 X-96.203 Y127.295 F2500
+G1 X-96.260 Y127.094 F2500
+G1 X-96.316 Y126.892 F2500
+G1 X-96.372 Y126.690 F2500
+G1 X-96.428 Y126.488 F2500
+G1 X-96.483 Y126.286 F2500
+G1 X-96.538 Y126.084 F2500
+G1 X-96.593 Y125.882 F2500
+G1 X-96.647 Y125.680 F2500
+G1 X-96.700 Y125.477 F2500
+G1 X-96.753 Y125.274 F2500
+G1 X-96.806 Y125.072 F2500
+G1 X-96.858 Y124.869 F2500
+G1 X-96.910 Y124.666 F2500
+G1 X-96.962 Y124.463 F2500
+G1 X-97.013 Y124.260 F2500
+G1 X-97.063 Y124.057 F2500
+G1 X-97.113 Y123.853 F2500
+G1 X-97.163 Y123.650 F2500
+G1 X-97.212 Y123.446 F2500
+G1 X-97.261 Y123.243 F2500
+G1 X-97.310 Y123.039 F2500
+G1 X-97.358 Y122.835 F2500
+G1 X-97.406 Y122.631 F2500
+G1 X-97.453 Y122.427 F2500
+G1 X-97.499 Y122.223 F2500
+G1 X-97.546 Y122.019 F2500
+G1 X-97.592 Y121.814 F2500
+G1 X-97.637 Y121.610 F2500
+G1 X-97.682 Y121.405 F2500
+G1 X-97.727 Y121.201 F2500
+G1 X-97.771 Y120.996 F2500
+G1 X-97.815 Y120.791 F2500
+G1 X-97.858 Y120.586 F2500
+G1 X-97.901 Y120.381 F2500
+G1 X-97.943 Y120.176 F2500
+G1 X-97.986 Y119.971 F2500
+G1 X-98.027 Y119.766 F2500
+G1 X-98.068 Y119.560 F2500
+G1 X-98.109 Y119.355 F2500
+G1 X-98.149 Y119.149 F2500
+G1 X-98.189 Y118.944 F2500
+G1 X-98.229 Y118.738 F2500
+G1 X-98.268 Y118.532 F2500
+G1 X-98.306 Y118.327 F2500
+G1 X-98.345 Y118.121 F2500
+G1 X-98.382 Y117.915 F2500
+G1 X-98.420 Y117.708 F2500
+G1 X-98.456 Y117.502 F2500
+G1 X-98.493 Y117.296 F2500
+G1 X-98.529 Y117.090 F2500
+G1 X-98.564 Y116.883 F2500
+G1 X-98.600 Y116.677 F2500
+G1 X-98.634 Y116.470 F2500
+G1 X-98.669 Y116.264 F2500
+G1 X-98.702 Y116.057 F2500
+G1 X-98.736 Y115.850 F2500
+G1 X-98.769 Y115.643 F2500
+G1 X-98.801 Y115.437 F2500
+G1 X-98.833 Y115.230 F2500
+G1 X-98.865 Y115.023 F2500
+G1 X-98.896 Y114.815 F2500
+G1 X-98.927 Y114.608 F2500
+G1 X-98.958 Y114.401 F2500
+G1 X-98.988 Y114.194 F2500
+G1 X-99.017 Y113.986 F2500
+G1 X-99.046 Y113.779 F2500
+G1 X-99.075 Y113.572 F2500
+G1 X-99.103 Y113.364 F2500
+G1 X-99.131 Y113.156 F2500
+G1 X-99.158 Y112.949 F2500
+G1 X-99.185 Y112.741 F2500
+G1 X-99.211 Y112.533 F2500
+G1 X-99.238 Y112.326 F2500
+G1 X-99.263 Y112.118 F2500
+G1 X-99.288 Y111.910 F2500
+G1 X-99.313 Y111.702 F2500
+G1 X-99.337 Y111.494 F2500
+G1 X-99.361 Y111.286 F2500
+G1 X-99.385 Y111.078 F2500
+G1 X-99.408 Y110.869 F2500
+G1 X-99.430 Y110.661 F2500
+G1 X-99.452 Y110.453 F2500
+G1 X-99.474 Y110.245 F2500
+G1 X-99.495 Y110.036 F2500
+G1 X-99.516 Y109.828 F2500
+G1 X-99.536 Y109.619 F2500
+G1 X-99.556 Y109.411 F2500
+G1 X-99.576 Y109.202 F2500
+G1 X-99.595 Y108.994 F2500
+G1 X-99.613 Y108.785 F2500
+G1 X-99.632 Y108.576 F2500
+G1 X-99.649 Y108.368 F2500
+G1 X-99.667 Y108.159 F2500
+G1 X-99.683 Y107.950 F2500
+G1 X-99.700 Y107.742 F2500
+G1 X-99.716 Y107.533 F2500
+G1 X-99.731 Y107.324 F2500
+G1 X-99.747 Y107.115 F2500
+G1 X-99.761 Y106.906 F2500
+G1 X-99.775 Y106.697 F2500
+G1 X-99.789 Y106.488 F2500
+G1 X-99.803 Y106.279 F2500
+G1 X-99.816 Y106.070 F2500
+G1 X-99.828 Y105.861 F2500
+G1 X-99.840 Y105.652 F2500
+G1 X-99.852 Y105.443 F2500
+G1 X-99.863 Y105.234 F2500
+G1 X-99.874 Y105.024 F2500
+G1 X-99.884 Y104.815 F2500
+G1 X-99.894 Y104.606 F2500
+G1 X-99.903 Y104.397 F2500
+G1 X-99.912 Y104.188 F2500
+G1 X-99.921 Y103.978 F2500
+G1 X-99.929 Y103.769 F2500
+G1 X-99.937 Y103.560 F2500
+G1 X-99.944 Y103.350 F2500
+G1 X-99.951 Y103.141 F2500
+G1 X-99.957 Y102.932 F2500
+G1 X-99.963 Y102.722 F2500
+G1 X-99.968 Y102.513 F2500
+G1 X-99.973 Y102.304 F2500
+G1 X-99.978 Y102.094 F2500
+G1 X-99.982 Y101.885 F2500
+G1 X-99.986 Y101.675 F2500
+G1 X-99.989 Y101.466 F2500
+G1 X-99.992 Y101.257 F2500
+G1 X-99.995 Y101.047 F2500
+G1 X-99.996 Y100.838 F2500
+G1 X-99.998 Y100.628 F2500
+G1 X-99.999 Y100.419 F2500
+G1 X-100.000 Y100.209 F2500
+G1 X-100.000 Y100.000 F2500
+G1 X-100.000 Y99.791 F2500
+G1 X-99.999 Y99.581 F2500
+G1 X-99.998 Y99.372 F2500
+G1 X-99.996 Y99.162 F2500
+G1 X-99.995 Y98.953 F2500
+G1 X-99.992 Y98.743 F2500
+G1 X-99.989 Y98.534 F2500
+G1 X-99.986 Y98.325 F2500
+G1 X-99.982 Y98.115 F2500
+G1 X-99.978 Y97.906 F2500
+G1 X-99.973 Y97.696 F2500
+G1 X-99.968 Y97.487 F2500
+G1 X-99.963 Y97.278 F2500
+G1 X-99.957 Y97.068 F2500
+G1 X-99.951 Y96.859 F2500
+G1 X-99.944 Y96.650 F2500
+G1 X-99.937 Y96.440 F2500
+G1 X-99.929 Y96.231 F2500
+G1 X-99.921 Y96.022 F2500
+G1 X-99.912 Y95.812 F2500
+G1 X-99.903 Y95.603 F2500
+G1 X-99.894 Y95.394 F2500
+G1 X-99.884 Y95.185 F2500
+G1 X-99.874 Y94.976 F2500
+G1 X-99.863 Y94.766 F2500
+G1 X-99.852 Y94.557 F2500
+G1 X-99.840 Y94.348 F2500
+G1 X-99.828 Y94.139 F2500
+G1 X-99.816 Y93.930 F2500
+G1 X-99.803 Y93.721 F2500
+G1 X-99.789 Y93.512 F2500
+G1 X-99.775 Y93.303 F2500
+G1 X-99.761 Y93.094 F2500
+G1 X-99.747 Y92.885 F2500
+G1 X-99.731 Y92.676 F2500
+G1 X-99.716 Y92.467 F2500
+G1 X-99.700 Y92.258 F2500
+G1 X-99.683 Y92.050 F2500
+G1 X-99.667 Y91.841 F2500
+G1 X-99.649 Y91.632 F2500
+G1 X-99.632 Y91.424 F2500
+G1 X-99.613 Y91.215 F2500
+G1 X-99.595 Y91.006 F2500
+G1 X-99.576 Y90.798 F2500
+G1 X-99.556 Y90.589 F2500
+G1 X-99.536 Y90.381 F2500
+G1 X-99.516 Y90.172 F2500
+G1 X-99.495 Y89.964 F2500
+G1 X-99.474 Y89.755 F2500
+G1 X-99.452 Y89.547 F2500
+G1 X-99.430 Y89.339 F2500
+G1 X-99.408 Y89.131 F2500
+G1 X-99.385 Y88.922 F2500
+G1 X-99.361 Y88.714 F2500
+G1 X-99.337 Y88.506 F2500
+G1 X-99.313 Y88.298 F2500
+G1 X-99.288 Y88.090 F2500
+G1 X-99.263 Y87.882 F2500
+G1 X-99.238 Y87.674 F2500
+G1 X-99.211 Y87.467 F2500
+G1 X-99.185 Y87.259 F2500
+G1 X-99.158 Y87.051 F2500
+G1 X-99.131 Y86.844 F2500
+G1 X-99.103 Y86.636 F2500
+G1 X-99.075 Y86.428 F2500
+G1 X-99.046 Y86.221 F2500
+G1 X-99.017 Y86.014 F2500
+G1 X-98.988 Y85.806 F2500
+G1 X-98.958 Y85.599 F2500
+G1 X-98.927 Y85.392 F2500
+G1 X-98.896 Y85.185 F2500
+G1 X-98.865 Y84.977 F2500
+G1 X-98.833 Y84.770 F2500
+G1 X-98.801 Y84.563 F2500
+G1 X-98.769 Y84.357 F2500
+G1 X-98.736 Y84.150 F2500
+G1 X-98.702 Y83.943 F2500
+G1 X-98.669 Y83.736 F2500
+G1 X-98.634 Y83.530 F2500
+G1 X-98.600 Y83.323 F2500
+G1 X-98.564 Y83.117 F2500
+G1 X-98.529 Y82.910 F2500
+G1 X-98.493 Y82.704 F2500
+G1 X-98.456 Y82.498 F2500
+G1 X-98.420 Y82.292 F2500
+G1 X-98.382 Y82.085 F2500
+G1 X-98.345 Y81.879 F2500
+G1 X-98.306 Y81.673 F2500
+G1 X-98.268 Y81.468 F2500
+G1 X-98.229 Y81.262 F2500
+G1 X-98.189 Y81.056 F2500
+G1 X-98.149 Y80.851 F2500
+G1 X-98.109 Y80.645 F2500
+G1 X-98.068 Y80.440 F2500
+G1 X-98.027 Y80.234 F2500
+G1 X-97.986 Y80.029 F2500
+G1 X-97.943 Y79.824 F2500
+G1 X-97.901 Y79.619 F2500
+G1 X-97.858 Y79.414 F2500
+G1 X-97.815 Y79.209 F2500
+G1 X-97.771 Y79.004 F2500
+G1 X-97.727 Y78.799 F2500
+G1 X-97.682 Y78.595 F2500
+G1 X-97.637 Y78.390 F2500
+G1 X-97.592 Y78.186 F2500
+G1 X-97.546 Y77.981 F2500
+G1 X-97.499 Y77.777 F2500
+G1 X-97.453 Y77.573 F2500
+G1 X-97.406 Y77.369 F2500
+G1 X-97.358 Y77.165 F2500
+G1 X-97.310 Y76.961 F2500
+G1 X-97.261 Y76.757 F2500
+G1 X-97.212 Y76.554 F2500
+G1 X-97.163 Y76.350 F2500
+G1 X-97.113 Y76.147 F2500
+G1 X-97.063 Y75.943 F2500
+G1 X-97.013 Y75.740 F2500
+G1 X-96.962 Y75.537 F2500
+G1 X-96.910 Y75.334 F2500
+G1 X-96.858 Y75.131 F2500
+G1 X-96.806 Y74.928 F2500
+G1 X-96.753 Y74.726 F2500
+G1 X-96.700 Y74.523 F2500
+G1 X-96.647 Y74.320 F2500
+G1 X-96.593 Y74.118 F2500
+G1 X-96.538 Y73.916 F2500
+G1 X-96.483 Y73.714 F2500
+G1 X-96.428 Y73.512 F2500
+G1 X-96.372 Y73.310 F2500
+G1 X-96.316 Y73.108 F2500
+G1 X-96.260 Y72.906 F2500
+G1 X-96.203 Y72.705 F2500
+G1 X-96.145 Y72.503 F2500
+G1 X-96.088 Y72.302 F2500
+G1 X-96.029 Y72.101 F2500
+G1 X-95.971 Y71.900 F2500
+G1 X-95.912 Y71.699 F2500
+G1 X-95.852 Y71.498 F2500
+G1 X-95.792 Y71.297 F2500
+G1 X-95.732 Y71.097 F2500
+G1 X-95.671 Y70.896 F2500
+G1 X-95.610 Y70.696 F2500
+G1 X-95.548 Y70.496 F2500
+G1 X-95.486 Y70.296 F2500
+G1 X-95.424 Y70.096 F2500
+G1 X-95.361 Y69.896 F2500
+G1 X-95.298 Y69.696 F2500
+G1 X-95.234 Y69.497 F2500
+G1 X-95.170 Y69.298 F2500
+G1 X-95.106 Y69.098 F2500
+G1 X-95.041 Y68.899 F2500
+G1 X-94.975 Y68.700 F2500
+G1 X-94.910 Y68.501 F2500
+G1 X-94.843 Y68.303 F2500
+G1 X-94.777 Y68.104 F2500
+G1 X-94.710 Y67.906 F2500
+G1 X-94.642 Y67.707 F2500
+G1 X-94.575 Y67.509 F2500
+G1 X-94.506 Y67.311 F2500
+G1 X-94.438 Y67.113 F2500
+G1 X-94.369 Y66.916 F2500
+G1 X-94.299 Y66.718 F2500
+G1 X-94.229 Y66.521 F2500
+G1 X-94.159 Y66.323 F2500
+G1 X-94.088 Y66.126 F2500
+G1 X-94.017 Y65.929 F2500
+G1 X-93.945 Y65.732 F2500
+G1 X-93.873 Y65.536 F2500
+G1 X-93.801 Y65.339 F2500
+G1 X-93.728 Y65.143 F2500
+G1 X-93.655 Y64.947 F2500
+G1 X-93.581 Y64.750 F2500
+G1 X-93.507 Y64.555 F2500
+G1 X-93.433 Y64.359 F2500
+G1 X-93.358 Y64.163 F2500
+G1 X-93.283 Y63.968 F2500
+G1 X-93.207 Y63.772 F2500
+G1 X-93.131 Y63.577 F2500
+G1 X-93.055 Y63.382 F2500
+G1 X-92.978 Y63.188 F2500
+G1 X-92.900 Y62.993 F2500
+G1 X-92.823 Y62.798 F2500
+G1 X-92.745 Y62.604 F2500
+G1 X-92.666 Y62.410 F2500
+G1 X-92.587 Y62.216 F2500
+G1 X-92.508 Y62.022 F2500
+G1 X-92.428 Y61.828 F2500
+G1 X-92.348 Y61.635 F2500
+G1 X-92.267 Y61.442 F2500
+G1 X-92.186 Y61.248 F2500
+G1 X-92.105 Y61.055 F2500
+G1 X-92.023 Y60.863 F2500
+G1 X-91.941 Y60.670 F2500
+G1 X-91.858 Y60.478 F2500
+G1 X-91.775 Y60.285 F2500
+G1 X-91.692 Y60.093 F2500
+G1 X-91.608 Y59.901 F2500
+G1 X-91.524 Y59.709 F2500
+G1 X-91.440 Y59.518 F2500
+G1 X-91.355 Y59.326 F2500
+G1 X-91.269 Y59.135 F2500
+G1 X-91.183 Y58.944 F2500
+G1 X-91.097 Y58.753 F2500
+G1 X-91.011 Y58.562 F2500
+G1 X-90.924 Y58.372 F2500
+G1 X-90.836 Y58.182 F2500
+G1 X-90.748 Y57.991 F2500
+G1 X-90.660 Y57.801 F2500
+G1 X-90.572 Y57.612 F2500
+G1 X-90.483 Y57.422 F2500
+G1 X-90.393 Y57.233 F2500
+G1 X-90.304 Y57.043 F2500
+G1 X-90.213 Y56.854 F2500
+G1 X-90.123 Y56.666 F2500
+G1 X-90.032 Y56.477 F2500
+G1 X-89.941 Y56.288 F2500
+G1 X-89.849 Y56.100 F2500
+G1 X-89.757 Y55.912 F2500
+G1 X-89.664 Y55.724 F2500
+G1 X-89.571 Y55.536 F2500
+G1 X-89.478 Y55.349 F2500
+G1 X-89.384 Y55.162 F2500
+G1 X-89.290 Y54.975 F2500
+G1 X-89.196 Y54.788 F2500
+G1 X-89.101 Y54.601 F2500
+G1 X-89.005 Y54.414 F2500
+G1 X-88.910 Y54.228 F2500
+G1 X-88.814 Y54.042 F2500
+G1 X-88.717 Y53.856 F2500
+G1 X-88.620 Y53.670 F2500
+G1 X-88.523 Y53.485 F2500
+G1 X-88.426 Y53.300 F2500
+G1 X-88.328 Y53.114 F2500
+G1 X-88.229 Y52.930 F2500
+G1 X-88.130 Y52.745 F2500
+G1 X-88.031 Y52.560 F2500
+G1 X-87.932 Y52.376 F2500
+G1 X-87.832 Y52.192 F2500
+G1 X-87.731 Y52.008 F2500
+G1 X-87.631 Y51.825 F2500
+G1 X-87.530 Y51.641 F2500
+G1 X-87.428 Y51.458 F2500
+G1 X-87.326 Y51.275 F2500
+G1 X-87.224 Y51.092 F2500
+G1 X-87.121 Y50.910 F2500
+G1 X-87.018 Y50.727 F2500
+G1 X-86.915 Y50.545 F2500
+G1 X-86.811 Y50.363 F2500
+G1 X-86.707 Y50.181 F2500
+G1 X-86.603 Y50.000 F2500
+G1 X-86.498 Y49.819 F2500
+G1 X-86.392 Y49.638 F2500
+G1 X-86.287 Y49.457 F2500
+G1 X-86.181 Y49.276 F2500
+G1 X-86.074 Y49.096 F2500
+G1 X-85.967 Y48.916 F2500
+G1 X-85.860 Y48.736 F2500
+G1 X-85.753 Y48.556 F2500
+G1 X-85.645 Y48.377 F2500
+G1 X-85.536 Y48.197 F2500
+G1 X-85.428 Y48.018 F2500
+G1 X-85.319 Y47.839 F2500
+G1 X-85.209 Y47.661 F2500
+G1 X-85.099 Y47.483 F2500
+G1 X-84.989 Y47.304 F2500
+G1 X-84.879 Y47.127 F2500
+G1 X-84.768 Y46.949 F2500
+G1 X-84.656 Y46.771 F2500
+G1 X-84.545 Y46.594 F2500
+G1 X-84.433 Y46.417 F2500
+G1 X-84.320 Y46.241 F2500
+G1 X-84.208 Y46.064 F2500
+G1 X-84.094 Y45.888 F2500
+G1 X-83.981 Y45.712 F2500
+G1 X-83.867 Y45.536 F2500
+G1 X-83.753 Y45.361 F2500
+G1 X-83.638 Y45.185 F2500
+G1 X-83.523 Y45.010 F2500
+G1 X-83.408 Y44.835 F2500
+G1 X-83.292 Y44.661 F2500
+G1 X-83.176 Y44.487 F2500
+G1 X-83.060 Y44.312 F2500
+G1 X-82.943 Y44.139 F2500
+G1 X-82.826 Y43.965 F2500
+G1 X-82.708 Y43.792 F2500
+G1 X-82.590 Y43.619 F2500
+G1 X-82.472 Y43.446 F2500
+G1 X-82.353 Y43.273 F2500
+G1 X-82.234 Y43.101 F2500
+G1 X-82.115 Y42.929 F2500
+G1 X-81.995 Y42.757 F2500
+G1 X-81.875 Y42.585 F2500
+G1 X-81.755 Y42.414 F2500
+G1 X-81.634 Y42.243 F2500
+G1 X-81.513 Y42.072 F2500
+G1 X-81.391 Y41.901 F2500
+G1 X-81.269 Y41.731 F2500
+G1 X-81.147 Y41.561 F2500
+G1 X-81.025 Y41.391 F2500
+G1 X-80.902 Y41.221 F2500
+G1 X-80.778 Y41.052 F2500
+G1 X-80.655 Y40.883 F2500
+G1 X-80.531 Y40.714 F2500
+G1 X-80.406 Y40.546 F2500
+G1 X-80.282 Y40.378 F2500
+G1 X-80.157 Y40.210 F2500
+G1 X-80.031 Y40.042 F2500
+G1 X-79.906 Y39.874 F2500
+G1 X-79.779 Y39.707 F2500
+G1 X-79.653 Y39.540 F2500
+G1 X-79.526 Y39.373 F2500
+G1 X-79.399 Y39.207 F2500
+G1 X-79.272 Y39.041 F2500
+G1 X-79.144 Y38.875 F2500
+G1 X-79.016 Y38.709 F2500
+G1 X-78.887 Y38.544 F2500
+G1 X-78.758 Y38.379 F2500
+G1 X-78.629 Y38.214 F2500
+G1 X-78.499 Y38.049 F2500
+G1 X-78.369 Y37.885 F2500
+G1 X-78.239 Y37.721 F2500
+G1 X-78.108 Y37.557 F2500
+G1 X-77.978 Y37.394 F2500
+G1 X-77.846 Y37.231 F2500
+G1 X-77.715 Y37.068 F2500
+G1 X-77.583 Y36.905 F2500
+G1 X-77.450 Y36.743 F2500
+G1 X-77.318 Y36.581 F2500
+G1 X-77.185 Y36.419 F2500
+G1 X-77.051 Y36.258 F2500
+G1 X-76.918 Y36.096 F2500
+G1 X-76.784 Y35.935 F2500
+G1 X-76.649 Y35.775 F2500
+G1 X-76.515 Y35.614 F2500
+G1 X-76.380 Y35.454 F2500
+G1 X-76.244 Y35.294 F2500
+G1 X-76.109 Y35.135 F2500
+G1 X-75.973 Y34.976 F2500
+G1 X-75.836 Y34.817 F2500
+G1 X-75.700 Y34.658 F2500
+G1 X-75.562 Y34.500 F2500
+G1 X-75.425 Y34.341 F2500
+G1 X-75.287 Y34.184 F2500
+G1 X-75.149 Y34.026 F2500
+G1 X-75.011 Y33.869 F2500
+G1 X-74.872 Y33.712 F2500
+G1 X-74.733 Y33.555 F2500
+G1 X-74.594 Y33.399 F2500
+G1 X-74.454 Y33.243 F2500
+G1 X-74.314 Y33.087 F2500
+G1 X-74.174 Y32.931 F2500
+G1 X-74.034 Y32.776 F2500
+G1 X-73.893 Y32.621 F2500
+G1 X-73.751 Y32.467 F2500
+G1 X-73.610 Y32.312 F2500
+G1 X-73.468 Y32.158 F2500
+G1 X-73.326 Y32.005 F2500
+G1 X-73.183 Y31.851 F2500
+G1 X-73.040 Y31.698 F2500
+G1 X-72.897 Y31.545 F2500
+G1 X-72.753 Y31.393 F2500
+G1 X-72.609 Y31.241 F2500
+G1 X-72.465 Y31.089 F2500
+G1 X-72.321 Y30.937 F2500
+G1 X-72.176 Y30.786 F2500
+G1 X-72.031 Y30.635 F2500
+G1 X-71.885 Y30.484 F2500
+G1 X-71.740 Y30.334 F2500
+G1 X-71.594 Y30.183 F2500
+G1 X-71.447 Y30.034 F2500
+G1 X-71.301 Y29.884 F2500
+G1 X-71.154 Y29.735 F2500
+G1 X-71.006 Y29.586 F2500
+G1 X-70.859 Y29.438 F2500
+G1 X-70.711 Y29.289 F2500
+G1 X-70.562 Y29.141 F2500
+G1 X-70.414 Y28.994 F2500
+G1 X-70.265 Y28.846 F2500
+G1 X-70.116 Y28.699 F2500
+G1 X-69.966 Y28.553 F2500
+G1 X-69.817 Y28.406 F2500
+G1 X-69.666 Y28.260 F2500
+G1 X-69.516 Y28.115 F2500
+G1 X-69.365 Y27.969 F2500
+G1 X-69.214 Y27.824 F2500
+G1 X-69.063 Y27.679 F2500
+G1 X-68.911 Y27.535 F2500
+G1 X-68.759 Y27.391 F2500
+G1 X-68.607 Y27.247 F2500
+G1 X-68.455 Y27.103 F2500
+G1 X-68.302 Y26.960 F2500
+G1 X-68.149 Y26.817 F2500
+G1 X-67.995 Y26.674 F2500
+G1 X-67.842 Y26.532 F2500
+G1 X-67.688 Y26.390 F2500
+G1 X-67.533 Y26.249 F2500
+G1 X-67.379 Y26.107 F2500
+G1 X-67.224 Y25.966 F2500
+G1 X-67.069 Y25.826 F2500
+G1 X-66.913 Y25.686 F2500
+G1 X-66.757 Y25.546 F2500
+G1 X-66.601 Y25.406 F2500
+G1 X-66.445 Y25.267 F2500
+G1 X-66.288 Y25.128 F2500
+G1 X-66.131 Y24.989 F2500
+G1 X-65.974 Y24.851 F2500
+G1 X-65.816 Y24.713 F2500
+G1 X-65.659 Y24.575 F2500
+G1 X-65.500 Y24.438 F2500
+G1 X-65.342 Y24.300 F2500
+G1 X-65.183 Y24.164 F2500
+G1 X-65.024 Y24.027 F2500
+G1 X-64.865 Y23.891 F2500
+G1 X-64.706 Y23.756 F2500
+G1 X-64.546 Y23.620 F2500
+G1 X-64.386 Y23.485 F2500
+G1 X-64.225 Y23.351 F2500
+G1 X-64.065 Y23.216 F2500
+G1 X-63.904 Y23.082 F2500
+G1 X-63.742 Y22.949 F2500
+G1 X-63.581 Y22.815 F2500
+G1 X-63.419 Y22.682 F2500
+G1 X-63.257 Y22.550 F2500
+G1 X-63.095 Y22.417 F2500
+G1 X-62.932 Y22.285 F2500
+G1 X-62.769 Y22.154 F2500
+G1 X-62.606 Y22.022 F2500
+G1 X-62.443 Y21.892 F2500
+G1 X-62.279 Y21.761 F2500
+G1 X-62.115 Y21.631 F2500
+G1 X-61.951 Y21.501 F2500
+G1 X-61.786 Y21.371 F2500
+G1 X-61.621 Y21.242 F2500
+G1 X-61.456 Y21.113 F2500
+G1 X-61.291 Y20.984 F2500
+G1 X-61.125 Y20.856 F2500
+G1 X-60.959 Y20.728 F2500
+G1 X-60.793 Y20.601 F2500
+G1 X-60.627 Y20.474 F2500
+G1 X-60.460 Y20.347 F2500
+G1 X-60.293 Y20.221 F2500
+G1 X-60.126 Y20.094 F2500
+G1 X-59.958 Y19.969 F2500
+G1 X-59.790 Y19.843 F2500
+G1 X-59.622 Y19.718 F2500
+G1 X-59.454 Y19.594 F2500
+G1 X-59.286 Y19.469 F2500
+G1 X-59.117 Y19.345 F2500
+G1 X-58.948 Y19.222 F2500
+G1 X-58.779 Y19.098 F2500
+G1 X-58.609 Y18.975 F2500
+G1 X-58.439 Y18.853 F2500
+G1 X-58.269 Y18.731 F2500
+G1 X-58.099 Y18.609 F2500
+G1 X-57.928 Y18.487 F2500
+G1 X-57.757 Y18.366 F2500
+G1 X-57.586 Y18.245 F2500
+G1 X-57.415 Y18.125 F2500
+G1 X-57.243 Y18.005 F2500
+G1 X-57.071 Y17.885 F2500
+G1 X-56.899 Y17.766 F2500
+G1 X-56.727 Y17.647 F2500
+G1 X-56.554 Y17.528 F2500
+G1 X-56.381 Y17.410 F2500
+G1 X-56.208 Y17.292 F2500
+G1 X-56.035 Y17.174 F2500
+G1 X-55.861 Y17.057 F2500
+G1 X-55.688 Y16.940 F2500
+G1 X-55.513 Y16.824 F2500
+G1 X-55.339 Y16.708 F2500
+G1 X-55.165 Y16.592 F2500
+G1 X-54.990 Y16.477 F2500
+G1 X-54.815 Y16.362 F2500
+G1 X-54.639 Y16.247 F2500
+G1 X-54.464 Y16.133 F2500
+G1 X-54.288 Y16.019 F2500
+G1 X-54.112 Y15.906 F2500
+G1 X-53.936 Y15.792 F2500
+G1 X-53.759 Y15.680 F2500
+G1 X-53.583 Y15.567 F2500
+G1 X-53.406 Y15.455 F2500
+G1 X-53.229 Y15.344 F2500
+G1 X-53.051 Y15.232 F2500
+G1 X-52.873 Y15.121 F2500
+G1 X-52.696 Y15.011 F2500
+G1 X-52.517 Y14.901 F2500
+G1 X-52.339 Y14.791 F2500
+G1 X-52.161 Y14.681 F2500
+G1 X-51.982 Y14.572 F2500
+G1 X-51.803 Y14.464 F2500
+G1 X-51.623 Y14.355 F2500
+G1 X-51.444 Y14.247 F2500
+G1 X-51.264 Y14.140 F2500
+G1 X-51.084 Y14.033 F2500
+G1 X-50.904 Y13.926 F2500
+G1 X-50.724 Y13.819 F2500
+G1 X-50.543 Y13.713 F2500
+G1 X-50.362 Y13.608 F2500
+G1 X-50.181 Y13.502 F2500
+G1 X-50.000 Y13.397 F2500
+G1 X-49.819 Y13.293 F2500
+G1 X-49.637 Y13.189 F2500
+G1 X-49.455 Y13.085 F2500
+G1 X-49.273 Y12.982 F2500
+G1 X-49.090 Y12.879 F2500
+G1 X-48.908 Y12.776 F2500
+G1 X-48.725 Y12.674 F2500
+G1 X-48.542 Y12.572 F2500
+G1 X-48.359 Y12.470 F2500
+G1 X-48.175 Y12.369 F2500
+G1 X-47.992 Y12.269 F2500
+G1 X-47.808 Y12.168 F2500
+G1 X-47.624 Y12.068 F2500
+G1 X-47.440 Y11.969 F2500
+G1 X-47.255 Y11.870 F2500
+G1 X-47.070 Y11.771 F2500
+G1 X-46.886 Y11.672 F2500
+G1 X-46.700 Y11.574 F2500
+G1 X-46.515 Y11.477 F2500
+G1 X-46.330 Y11.380 F2500
+G1 X-46.144 Y11.283 F2500
+G1 X-45.958 Y11.186 F2500
+G1 X-45.772 Y11.090 F2500
+G1 X-45.586 Y10.995 F2500
+G1 X-45.399 Y10.899 F2500
+G1 X-45.212 Y10.804 F2500
+G1 X-45.025 Y10.710 F2500
+G1 X-44.838 Y10.616 F2500
+G1 X-44.651 Y10.522 F2500
+G1 X-44.464 Y10.429 F2500
+G1 X-44.276 Y10.336 F2500
+G1 X-44.088 Y10.243 F2500
+G1 X-43.900 Y10.151 F2500
+G1 X-43.712 Y10.059 F2500
+G1 X-43.523 Y9.968 F2500
+G1 X-43.334 Y9.877 F2500
+G1 X-43.146 Y9.787 F2500
+G1 X-42.957 Y9.696 F2500
+G1 X-42.767 Y9.607 F2500
+G1 X-42.578 Y9.517 F2500
+G1 X-42.388 Y9.428 F2500
+G1 X-42.199 Y9.340 F2500
+G1 X-42.009 Y9.252 F2500
+G1 X-41.818 Y9.164 F2500
+G1 X-41.628 Y9.076 F2500
+G1 X-41.438 Y8.989 F2500
+G1 X-41.247 Y8.903 F2500
+G1 X-41.056 Y8.817 F2500
+G1 X-40.865 Y8.731 F2500
+G1 X-40.674 Y8.645 F2500
+G1 X-40.482 Y8.560 F2500
+G1 X-40.291 Y8.476 F2500
+G1 X-40.099 Y8.392 F2500
+G1 X-39.907 Y8.308 F2500
+G1 X-39.715 Y8.225 F2500
+G1 X-39.522 Y8.142 F2500
+G1 X-39.330 Y8.059 F2500
+G1 X-39.137 Y7.977 F2500
+G1 X-38.945 Y7.895 F2500
+G1 X-38.752 Y7.814 F2500
+G1 X-38.558 Y7.733 F2500
+G1 X-38.365 Y7.652 F2500
+G1 X-38.172 Y7.572 F2500
+G1 X-37.978 Y7.492 F2500
+G1 X-37.784 Y7.413 F2500
+G1 X-37.590 Y7.334 F2500
+G1 X-37.396 Y7.255 F2500
+G1 X-37.202 Y7.177 F2500
+G1 X-37.007 Y7.100 F2500
+G1 X-36.812 Y7.022 F2500
+G1 X-36.618 Y6.945 F2500
+G1 X-36.423 Y6.869 F2500
+G1 X-36.228 Y6.793 F2500
+G1 X-36.032 Y6.717 F2500
+G1 X-35.837 Y6.642 F2500
+G1 X-35.641 Y6.567 F2500
+G1 X-35.445 Y6.493 F2500
+G1 X-35.250 Y6.419 F2500
+G1 X-35.053 Y6.345 F2500
+G1 X-34.857 Y6.272 F2500
+G1 X-34.661 Y6.199 F2500
+G1 X-34.464 Y6.127 F2500
+G1 X-34.268 Y6.055 F2500
+G1 X-34.071 Y5.983 F2500
+G1 X-33.874 Y5.912 F2500
+G1 X-33.677 Y5.841 F2500
+G1 X-33.479 Y5.771 F2500
+G1 X-33.282 Y5.701 F2500
+G1 X-33.084 Y5.631 F2500
+G1 X-32.887 Y5.562 F2500
+G1 X-32.689 Y5.494 F2500
+G1 X-32.491 Y5.425 F2500
+G1 X-32.293 Y5.358 F2500
+G1 X-32.094 Y5.290 F2500
+G1 X-31.896 Y5.223 F2500
+G1 X-31.697 Y5.157 F2500
+G1 X-31.499 Y5.090 F2500
+G1 X-31.300 Y5.025 F2500
+G1 X-31.101 Y4.959 F2500
+G1 X-30.902 Y4.894 F2500
+G1 X-30.702 Y4.830 F2500
+G1 X-30.503 Y4.766 F2500
+G1 X-30.304 Y4.702 F2500
+G1 X-30.104 Y4.639 F2500
+G1 X-29.904 Y4.576 F2500
+G1 X-29.704 Y4.514 F2500
+G1 X-29.504 Y4.452 F2500
+G1 X-29.304 Y4.390 F2500
+G1 X-29.104 Y4.329 F2500
+G1 X-28.903 Y4.268 F2500
+G1 X-28.703 Y4.208 F2500
+G1 X-28.502 Y4.148 F2500
+G1 X-28.301 Y4.088 F2500
+G1 X-28.100 Y4.029 F2500
+G1 X-27.899 Y3.971 F2500
+G1 X-27.698 Y3.912 F2500
+G1 X-27.497 Y3.855 F2500
+G1 X-27.295 Y3.797 F2500
+G1 X-27.094 Y3.740 F2500
+G1 X-26.892 Y3.684 F2500
+G1 X-26.690 Y3.628 F2500
+G1 X-26.488 Y3.572 F2500
+G1 X-26.286 Y3.517 F2500
+G1 X-26.084 Y3.462 F2500
+G1 X-25.882 Y3.407 F2500
+G1 X-25.680 Y3.353 F2500
+G1 X-25.477 Y3.300 F2500
+G1 X-25.274 Y3.247 F2500
+G1 X-25.072 Y3.194 F2500
+G1 X-24.869 Y3.142 F2500
+G1 X-24.666 Y3.090 F2500
+G1 X-24.463 Y3.038 F2500
+G1 X-24.260 Y2.987 F2500
+G1 X-24.057 Y2.937 F2500
+G1 X-23.853 Y2.887 F2500
+G1 X-23.650 Y2.837 F2500
+G1 X-23.446 Y2.788 F2500
+G1 X-23.243 Y2.739 F2500
+G1 X-23.039 Y2.690 F2500
+G1 X-22.835 Y2.642 F2500
+G1 X-22.631 Y2.594 F2500
+G1 X-22.427 Y2.547 F2500
+G1 X-22.223 Y2.501 F2500
+G1 X-22.019 Y2.454 F2500
+G1 X-21.814 Y2.408 F2500
+G1 X-21.610 Y2.363 F2500
+G1 X-21.405 Y2.318 F2500
+G1 X-21.201 Y2.273 F2500
+G1 X-20.996 Y2.229 F2500
+G1 X-20.791 Y2.185 F2500
+G1 X-20.586 Y2.142 F2500
+G1 X-20.381 Y2.099 F2500
+G1 X-20.176 Y2.057 F2500
+G1 X-19.971 Y2.014 F2500
+G1 X-19.766 Y1.973 F2500
+G1 X-19.560 Y1.932 F2500
+G1 X-19.355 Y1.891 F2500
+G1 X-19.149 Y1.851 F2500
+G1 X-18.944 Y1.811 F2500
+G1 X-18.738 Y1.771 F2500
+G1 X-18.532 Y1.732 F2500
+G1 X-18.327 Y1.694 F2500
+G1 X-18.121 Y1.655 F2500
+G1 X-17.915 Y1.618 F2500
+G1 X-17.708 Y1.580 F2500
+G1 X-17.502 Y1.544 F2500
+G1 X-17.296 Y1.507 F2500
+G1 X-17.090 Y1.471 F2500
+G1 X-16.883 Y1.436 F2500
+G1 X-16.677 Y1.400 F2500
+G1 X-16.470 Y1.366 F2500
+G1 X-16.264 Y1.331 F2500
+G1 X-16.057 Y1.298 F2500
+G1 X-15.850 Y1.264 F2500
+G1 X-15.643 Y1.231 F2500
+G1 X-15.437 Y1.199 F2500
+G1 X-15.230 Y1.167 F2500
+G1 X-15.023 Y1.135 F2500
+G1 X-14.815 Y1.104 F2500
+G1 X-14.608 Y1.073 F2500
+G1 X-14.401 Y1.042 F2500
+G1 X-14.194 Y1.012 F2500
+G1 X-13.986 Y0.983 F2500
+G1 X-13.779 Y0.954 F2500
+G1 X-13.572 Y0.925 F2500
+G1 X-13.364 Y0.897 F2500
+G1 X-13.156 Y0.869 F2500
+G1 X-12.949 Y0.842 F2500
+G1 X-12.741 Y0.815 F2500
+G1 X-12.533 Y0.789 F2500
+G1 X-12.326 Y0.762 F2500
+G1 X-12.118 Y0.737 F2500
+G1 X-11.910 Y0.712 F2500
+G1 X-11.702 Y0.687 F2500
+G1 X-11.494 Y0.663 F2500
+G1 X-11.286 Y0.639 F2500
+G1 X-11.078 Y0.615 F2500
+G1 X-10.869 Y0.592 F2500
+G1 X-10.661 Y0.570 F2500
+G1 X-10.453 Y0.548 F2500
+G1 X-10.245 Y0.526 F2500
+G1 X-10.036 Y0.505 F2500
+G1 X-9.828 Y0.484 F2500
+G1 X-9.619 Y0.464 F2500
+G1 X-9.411 Y0.444 F2500
+G1 X-9.202 Y0.424 F2500
+G1 X-8.994 Y0.405 F2500
+G1 X-8.785 Y0.387 F2500
+G1 X-8.576 Y0.368 F2500
+G1 X-8.368 Y0.351 F2500
+G1 X-8.159 Y0.333 F2500
+G1 X-7.950 Y0.317 F2500
+G1 X-7.742 Y0.300 F2500
+G1 X-7.533 Y0.284 F2500
+G1 X-7.324 Y0.269 F2500
+G1 X-7.115 Y0.253 F2500
+G1 X-6.906 Y0.239 F2500
+G1 X-6.697 Y0.225 F2500
+G1 X-6.488 Y0.211 F2500
+G1 X-6.279 Y0.197 F2500
+G1 X-6.070 Y0.184 F2500
+G1 X-5.861 Y0.172 F2500
+G1 X-5.652 Y0.160 F2500
+G1 X-5.443 Y0.148 F2500
+G1 X-5.234 Y0.137 F2500
+G1 X-5.024 Y0.126 F2500
+G1 X-4.815 Y0.116 F2500
+G1 X-4.606 Y0.106 F2500
+G1 X-4.397 Y0.097 F2500
+G1 X-4.188 Y0.088 F2500
+G1 X-3.978 Y0.079 F2500
+G1 X-3.769 Y0.071 F2500
+G1 X-3.560 Y0.063 F2500
+G1 X-3.350 Y0.056 F2500
+G1 X-3.141 Y0.049 F2500
+G1 X-2.932 Y0.043 F2500
+G1 X-2.722 Y0.037 F2500
+G1 X-2.513 Y0.032 F2500
+G1 X-2.304 Y0.027 F2500
+G1 X-2.094 Y0.022 F2500
+G1 X-1.885 Y0.018 F2500
+G1 X-1.675 Y0.014 F2500
+G1 X-1.466 Y0.011 F2500
+G1 X-1.257 Y0.008 F2500
+G1 X-1.047 Y0.005 F2500
+G1 X-0.838 Y0.004 F2500
+G1 X-0.628 Y0.002 F2500
+G1 X-0.419 Y0.001 F2500
+G1 X-0.209 Y0.000 F2500
+G1 X-0.000 Y0.000 F2500
+M5
+G0 Z5
+M2
@@ -0,0 +1,1777 @@
+G21 G90 G17
+G0 Z5
+G0 X28.000 Y20.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X28.000 Y20.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X42.000 Y20.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X42.298 Y20.779 F3000
+G1 X42.555 Y21.577 F3000
+G1 X42.756 Y22.392 F3000
+G1 X42.890 Y23.217 F3000
+G1 X42.945 Y24.046 F3000
+G1 X42.915 Y24.871 F3000
+G1 X42.794 Y25.683 F3000
+G1 X42.582 Y26.475 F3000
+G1 X42.280 Y27.239 F3000
+G1 X41.894 Y27.969 F3000
+G1 X41.432 Y28.659 F3000
+G1 X40.903 Y29.307 F3000
+G1 X40.322 Y29.912 F3000
+G1 X39.700 Y30.475 F3000
+G1 X39.053 Y31.000 F3000
+G1 X38.393 Y31.493 F3000
+G1 X37.733 Y31.961 F3000
+G1 X37.085 Y32.413 F3000
+G1 X36.458 Y32.858 F3000
+G1 X35.858 Y33.306 F3000
+G1 X35.289 Y33.766 F3000
+G1 X34.752 Y34.246 F3000
+G1 X34.246 Y34.752 F3000
+G1 X33.766 Y35.289 F3000
+G1 X33.306 Y35.858 F3000
+G1 X32.858 Y36.458 F3000
+G1 X32.413 Y37.085 F3000
+G1 X31.961 Y37.733 F3000
+G1 X31.493 Y38.393 F3000
+G1 X31.000 Y39.053 F3000
+G1 X30.475 Y39.700 F3000
+G1 X29.912 Y40.322 F3000
+G1 X29.307 Y40.903 F3000
+G1 X28.659 Y41.432 F3000
+G1 X27.969 Y41.894 F3000
+G1 X27.239 Y42.280 F3000
+G1 X26.475 Y42.582 F3000
+G1 X25.683 Y42.794 F3000
+G1 X24.871 Y42.915 F3000
+G1 X24.046 Y42.945 F3000
+G1 X23.217 Y42.890 F3000
+G1 X22.392 Y42.756 F3000
+G1 X21.577 Y42.555 F3000
+G1 X20.779 Y42.298 F3000
+G1 X20.000 Y42.000 F3000
+G1 X19.243 Y41.675 F3000
+G1 X18.508 Y41.338 F3000
+G1 X17.793 Y41.003 F3000
+G1 X17.093 Y40.682 F3000
+G1 X16.405 Y40.386 F3000
+G1 X15.723 Y40.124 F3000
+G1 X15.039 Y39.899 F3000
+G1 X14.347 Y39.714 F3000
+G1 X13.642 Y39.566 F3000
+G1 X12.920 Y39.453 F3000
+G1 X12.176 Y39.364 F3000
+G1 X11.410 Y39.293 F3000
+G1 X10.623 Y39.225 F3000
+G1 X9.818 Y39.149 F3000
+G1 X9.000 Y39.053 F3000
+G1 X8.177 Y38.922 F3000
+G1 X7.357 Y38.745 F3000
+G1 X6.550 Y38.512 F3000
+G1 X5.769 Y38.215 F3000
+G1 X5.024 Y37.848 F3000
+G1 X4.325 Y37.409 F3000
+G1 X3.681 Y36.899 F3000
+G1 X3.101 Y36.319 F3000
+G1 X2.591 Y35.675 F3000
+G1 X2.152 Y34.976 F3000
+G1 X1.785 Y34.231 F3000
+G1 X1.488 Y33.450 F3000
+G1 X1.255 Y32.643 F3000
+G1 X1.078 Y31.823 F3000
+G1 X0.947 Y31.000 F3000
+G1 X0.851 Y30.182 F3000
+G1 X0.775 Y29.377 F3000
+G1 X0.707 Y28.590 F3000
+G1 X0.636 Y27.824 F3000
+G1 X0.547 Y27.080 F3000
+G1 X0.434 Y26.358 F3000
+G1 X0.286 Y25.653 F3000
+G1 X0.101 Y24.961 F3000
+G1 X-0.124 Y24.277 F3000
+G1 X-0.386 Y23.595 F3000
+G1 X-0.682 Y22.907 F3000
+G1 X-1.003 Y22.207 F3000
+G1 X-1.338 Y21.492 F3000
+G1 X-1.675 Y20.757 F3000
+G1 X-2.000 Y20.000 F3000
+G1 X-2.298 Y19.221 F3000
+G1 X-2.555 Y18.423 F3000
+G1 X-2.756 Y17.608 F3000
+G1 X-2.890 Y16.783 F3000
+G1 X-2.945 Y15.954 F3000
+G1 X-2.915 Y15.129 F3000
+G1 X-2.794 Y14.317 F3000
+G1 X-2.582 Y13.525 F3000
+G1 X-2.280 Y12.761 F3000
+G1 X-1.894 Y12.031 F3000
+G1 X-1.432 Y11.341 F3000
+G1 X-0.903 Y10.693 F3000
+G1 X-0.322 Y10.088 F3000
+G1 X0.300 Y9.525 F3000
+G1 X0.947 Y9.000 F3000
+G1 X1.607 Y8.507 F3000
+G1 X2.267 Y8.039 F3000
+G1 X2.915 Y7.587 F3000
+G1 X3.542 Y7.142 F3000
+G1 X4.142 Y6.694 F3000
+G1 X4.711 Y6.234 F3000
+G1 X5.248 Y5.754 F3000
+G1 X5.754 Y5.248 F3000
+G1 X6.234 Y4.711 F3000
+G1 X6.694 Y4.142 F3000
+G1 X7.142 Y3.542 F3000
+G1 X7.587 Y2.915 F3000
+G1 X8.039 Y2.267 F3000
+G1 X8.507 Y1.607 F3000
+G1 X9.000 Y0.947 F3000
+G1 X9.525 Y0.300 F3000
+G1 X10.088 Y-0.322 F3000
+G1 X10.693 Y-0.903 F3000
+G1 X11.341 Y-1.432 F3000
+G1 X12.031 Y-1.894 F3000
+G1 X12.761 Y-2.280 F3000
+G1 X13.525 Y-2.582 F3000
+G1 X14.317 Y-2.794 F3000
+G1 X15.129 Y-2.915 F3000
+G1 X15.954 Y-2.945 F3000
+G1 X16.783 Y-2.890 F3000
+G1 X17.608 Y-2.756 F3000
+G1 X18.423 Y-2.555 F3000
+G1 X19.221 Y-2.298 F3000
+G1 X20.000 Y-2.000 F3000
+G1 X20.757 Y-1.675 F3000
+G1 X21.492 Y-1.338 F3000
+G1 X22.207 Y-1.003 F3000
+G1 X22.907 Y-0.682 F3000
+G1 X23.595 Y-0.386 F3000
+G1 X24.277 Y-0.124 F3000
+G1 X24.961 Y0.101 F3000
+G1 X25.653 Y0.286 F3000
+G1 X26.358 Y0.434 F3000
+G1 X27.080 Y0.547 F3000
+G1 X27.824 Y0.636 F3000
+G1 X28.590 Y0.707 F3000
+G1 X29.377 Y0.775 F3000
+G1 X30.182 Y0.851 F3000
+G1 X31.000 Y0.947 F3000
+G1 X31.823 Y1.078 F3000
+G1 X32.643 Y1.255 F3000
+G1 X33.450 Y1.488 F3000
+G1 X34.231 Y1.785 F3000
+G1 X34.976 Y2.152 F3000
+G1 X35.675 Y2.591 F3000
+G1 X36.319 Y3.101 F3000
+G1 X36.899 Y3.681 F3000
+G1 X37.409 Y4.325 F3000
+G1 X37.848 Y5.024 F3000
+G1 X38.215 Y5.769 F3000
+G1 X38.512 Y6.550 F3000
+G1 X38.745 Y7.357 F3000
+G1 X38.922 Y8.177 F3000
+G1 X39.053 Y9.000 F3000
+G1 X39.149 Y9.818 F3000
+G1 X39.225 Y10.623 F3000
+G1 X39.293 Y11.410 F3000
+G1 X39.364 Y12.176 F3000
+G1 X39.453 Y12.920 F3000
+G1 X39.566 Y13.642 F3000
+G1 X39.714 Y14.347 F3000
+G1 X39.899 Y15.039 F3000
+G1 X40.124 Y15.723 F3000
+G1 X40.386 Y16.405 F3000
+G1 X40.682 Y17.093 F3000
+G1 X41.003 Y17.793 F3000
+G1 X41.338 Y18.508 F3000
+G1 X41.675 Y19.243 F3000
+G1 X42.000 Y20.000 F3000
+M235
+M5
+G0 Z5
+G0 X88.000 Y20.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X88.000 Y20.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X102.000 Y20.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X102.298 Y20.779 F3000
+G1 X102.555 Y21.577 F3000
+G1 X102.756 Y22.392 F3000
+G1 X102.890 Y23.217 F3000
+G1 X102.945 Y24.046 F3000
+G1 X102.915 Y24.871 F3000
+G1 X102.794 Y25.683 F3000
+G1 X102.582 Y26.475 F3000
+G1 X102.280 Y27.239 F3000
+G1 X101.894 Y27.969 F3000
+G1 X101.432 Y28.659 F3000
+G1 X100.903 Y29.307 F3000
+G1 X100.322 Y29.912 F3000
+G1 X99.700 Y30.475 F3000
+G1 X99.053 Y31.000 F3000
+G1 X98.393 Y31.493 F3000
+G1 X97.733 Y31.961 F3000
+G1 X97.085 Y32.413 F3000
+G1 X96.458 Y32.858 F3000
+G1 X95.858 Y33.306 F3000
+G1 X95.289 Y33.766 F3000
+G1 X94.752 Y34.246 F3000
+G1 X94.246 Y34.752 F3000
+G1 X93.766 Y35.289 F3000
+G1 X93.306 Y35.858 F3000
+G1 X92.858 Y36.458 F3000
+G1 X92.413 Y37.085 F3000
+G1 X91.961 Y37.733 F3000
+G1 X91.493 Y38.393 F3000
+G1 X91.000 Y39.053 F3000
+G1 X90.475 Y39.700 F3000
+G1 X89.912 Y40.322 F3000
+G1 X89.307 Y40.903 F3000
+G1 X88.659 Y41.432 F3000
+G1 X87.969 Y41.894 F3000
+G1 X87.239 Y42.280 F3000
+G1 X86.475 Y42.582 F3000
+G1 X85.683 Y42.794 F3000
+G1 X84.871 Y42.915 F3000
+G1 X84.046 Y42.945 F3000
+G1 X83.217 Y42.890 F3000
+G1 X82.392 Y42.756 F3000
+G1 X81.577 Y42.555 F3000
+G1 X80.779 Y42.298 F3000
+G1 X80.000 Y42.000 F3000
+G1 X79.243 Y41.675 F3000
+G1 X78.508 Y41.338 F3000
+G1 X77.793 Y41.003 F3000
+G1 X77.093 Y40.682 F3000
+G1 X76.405 Y40.386 F3000
+G1 X75.723 Y40.124 F3000
+G1 X75.039 Y39.899 F3000
+G1 X74.347 Y39.714 F3000
+G1 X73.642 Y39.566 F3000
+G1 X72.920 Y39.453 F3000
+G1 X72.176 Y39.364 F3000
+G1 X71.410 Y39.293 F3000
+G1 X70.623 Y39.225 F3000
+G1 X69.818 Y39.149 F3000
+G1 X69.000 Y39.053 F3000
+G1 X68.177 Y38.922 F3000
+G1 X67.357 Y38.745 F3000
+G1 X66.550 Y38.512 F3000
+G1 X65.769 Y38.215 F3000
+G1 X65.024 Y37.848 F3000
+G1 X64.325 Y37.409 F3000
+G1 X63.681 Y36.899 F3000
+G1 X63.101 Y36.319 F3000
+G1 X62.591 Y35.675 F3000
+G1 X62.152 Y34.976 F3000
+G1 X61.785 Y34.231 F3000
+G1 X61.488 Y33.450 F3000
+G1 X61.255 Y32.643 F3000
+G1 X61.078 Y31.823 F3000
+G1 X60.947 Y31.000 F3000
+G1 X60.851 Y30.182 F3000
+G1 X60.775 Y29.377 F3000
+G1 X60.707 Y28.590 F3000
+G1 X60.636 Y27.824 F3000
+G1 X60.547 Y27.080 F3000
+G1 X60.434 Y26.358 F3000
+G1 X60.286 Y25.653 F3000
+G1 X60.101 Y24.961 F3000
+G1 X59.876 Y24.277 F3000
+G1 X59.614 Y23.595 F3000
+G1 X59.318 Y22.907 F3000
+G1 X58.997 Y22.207 F3000
+G1 X58.662 Y21.492 F3000
+G1 X58.325 Y20.757 F3000
+G1 X58.000 Y20.000 F3000
+G1 X57.702 Y19.221 F3000
+G1 X57.445 Y18.423 F3000
+G1 X57.244 Y17.608 F3000
+G1 X57.110 Y16.783 F3000
+G1 X57.055 Y15.954 F3000
+G1 X57.085 Y15.129 F3000
+G1 X57.206 Y14.317 F3000
+G1 X57.418 Y13.525 F3000
+G1 X57.720 Y12.761 F3000
+G1 X58.106 Y12.031 F3000
+G1 X58.568 Y11.341 F3000
+G1 X59.097 Y10.693 F3000
+G1 X59.678 Y10.088 F3000
+G1 X60.300 Y9.525 F3000
+G1 X60.947 Y9.000 F3000
+G1 X61.607 Y8.507 F3000
+G1 X62.267 Y8.039 F3000
+G1 X62.915 Y7.587 F3000
+G1 X63.542 Y7.142 F3000
+G1 X64.142 Y6.694 F3000
+G1 X64.711 Y6.234 F3000
+G1 X65.248 Y5.754 F3000
+G1 X65.754 Y5.248 F3000
+G1 X66.234 Y4.711 F3000
+G1 X66.694 Y4.142 F3000
+G1 X67.142 Y3.542 F3000
+G1 X67.587 Y2.915 F3000
+G1 X68.039 Y2.267 F3000
+G1 X68.507 Y1.607 F3000
+G1 X69.000 Y0.947 F3000
+G1 X69.525 Y0.300 F3000
+G1 X70.088 Y-0.322 F3000
+G1 X70.693 Y-0.903 F3000
+G1 X71.341 Y-1.432 F3000
+G1 X72.031 Y-1.894 F3000
+G1 X72.761 Y-2.280 F3000
+G1 X73.525 Y-2.582 F3000
+G1 X74.317 Y-2.794 F3000
+G1 X75.129 Y-2.915 F3000
+G1 X75.954 Y-2.945 F3000
+G1 X76.783 Y-2.890 F3000
+G1 X77.608 Y-2.756 F3000
+G1 X78.423 Y-2.555 F3000
+G1 X79.221 Y-2.298 F3000
+G1 X80.000 Y-2.000 F3000
+G1 X80.757 Y-1.675 F3000
+G1 X81.492 Y-1.338 F3000
+G1 X82.207 Y-1.003 F3000
+G1 X82.907 Y-0.682 F3000
+G1 X83.595 Y-0.386 F3000
+G1 X84.277 Y-0.124 F3000
+G1 X84.961 Y0.101 F3000
+G1 X85.653 Y0.286 F3000
+G1 X86.358 Y0.434 F3000
+G1 X87.080 Y0.547 F3000
+G1 X87.824 Y0.636 F3000
+G1 X88.590 Y0.707 F3000
+G1 X89.377 Y0.775 F3000
+G1 X90.182 Y0.851 F3000
+G1 X91.000 Y0.947 F3000
+G1 X91.823 Y1.078 F3000
+G1 X92.643 Y1.255 F3000
+G1 X93.450 Y1.488 F3000
+G1 X94.231 Y1.785 F3000
+G1 X94.976 Y2.152 F3000
+G1 X95.675 Y2.591 F3000
+G1 X96.319 Y3.101 F3000
+G1 X96.899 Y3.681 F3000
+G1 X97.409 Y4.325 F3000
+G1 X97.848 Y5.024 F3000
+G1 X98.215 Y5.769 F3000
+G1 X98.512 Y6.550 F3000
+G1 X98.745 Y7.357 F3000
+G1 X98.922 Y8.177 F3000
+G1 X99.053 Y9.000 F3000
+G1 X99.149 Y9.818 F3000
+G1 X99.225 Y10.623 F3000
+G1 X99.293 Y11.410 F3000
+G1 X99.364 Y12.176 F3000
+G1 X99.453 Y12.920 F3000
+G1 X99.566 Y13.642 F3000
+G1 X99.714 Y14.347 F3000
+G1 X99.899 Y15.039 F3000
+G1 X100.124 Y15.723 F3000
+G1 X100.386 Y16.405 F3000
+G1 X100.682 Y17.093 F3000
+G1 X101.003 Y17.793 F3000
+G1 X101.338 Y18.508 F3000
+G1 X101.675 Y19.243 F3000
+G1 X102.000 Y20.000 F3000
+M235
+M5
+G0 Z5
+G0 X148.000 Y20.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X148.000 Y20.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X162.000 Y20.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X162.298 Y20.779 F3000
+G1 X162.555 Y21.577 F3000
+G1 X162.756 Y22.392 F3000
+G1 X162.890 Y23.217 F3000
+G1 X162.945 Y24.046 F3000
+G1 X162.915 Y24.871 F3000
+G1 X162.794 Y25.683 F3000
+G1 X162.582 Y26.475 F3000
+G1 X162.280 Y27.239 F3000
+G1 X161.894 Y27.969 F3000
+G1 X161.432 Y28.659 F3000
+G1 X160.903 Y29.307 F3000
+G1 X160.322 Y29.912 F3000
+G1 X159.700 Y30.475 F3000
+G1 X159.053 Y31.000 F3000
+G1 X158.393 Y31.493 F3000
+G1 X157.733 Y31.961 F3000
+G1 X157.085 Y32.413 F3000
+G1 X156.458 Y32.858 F3000
+G1 X155.858 Y33.306 F3000
+G1 X155.289 Y33.766 F3000
+G1 X154.752 Y34.246 F3000
+G1 X154.246 Y34.752 F3000
+G1 X153.766 Y35.289 F3000
+G1 X153.306 Y35.858 F3000
+G1 X152.858 Y36.458 F3000
+G1 X152.413 Y37.085 F3000
+G1 X151.961 Y37.733 F3000
+G1 X151.493 Y38.393 F3000
+G1 X151.000 Y39.053 F3000
+G1 X150.475 Y39.700 F3000
+G1 X149.912 Y40.322 F3000
+G1 X149.307 Y40.903 F3000
+G1 X148.659 Y41.432 F3000
+G1 X147.969 Y41.894 F3000
+G1 X147.239 Y42.280 F3000
+G1 X146.475 Y42.582 F3000
+G1 X145.683 Y42.794 F3000
+G1 X144.871 Y42.915 F3000
+G1 X144.046 Y42.945 F3000
+G1 X143.217 Y42.890 F3000
+G1 X142.392 Y42.756 F3000
+G1 X141.577 Y42.555 F3000
+G1 X140.779 Y42.298 F3000
+G1 X140.000 Y42.000 F3000
+G1 X139.243 Y41.675 F3000
+G1 X138.508 Y41.338 F3000
+G1 X137.793 Y41.003 F3000
+G1 X137.093 Y40.682 F3000
+G1 X136.405 Y40.386 F3000
+G1 X135.723 Y40.124 F3000
+G1 X135.039 Y39.899 F3000
+G1 X134.347 Y39.714 F3000
+G1 X133.642 Y39.566 F3000
+G1 X132.920 Y39.453 F3000
+G1 X132.176 Y39.364 F3000
+G1 X131.410 Y39.293 F3000
+G1 X130.623 Y39.225 F3000
+G1 X129.818 Y39.149 F3000
+G1 X129.000 Y39.053 F3000
+G1 X128.177 Y38.922 F3000
+G1 X127.357 Y38.745 F3000
+G1 X126.550 Y38.512 F3000
+G1 X125.769 Y38.215 F3000
+G1 X125.024 Y37.848 F3000
+G1 X124.325 Y37.409 F3000
+G1 X123.681 Y36.899 F3000
+G1 X123.101 Y36.319 F3000
+G1 X122.591 Y35.675 F3000
+G1 X122.152 Y34.976 F3000
+G1 X121.785 Y34.231 F3000
+G1 X121.488 Y33.450 F3000
+G1 X121.255 Y32.643 F3000
+G1 X121.078 Y31.823 F3000
+G1 X120.947 Y31.000 F3000
+G1 X120.851 Y30.182 F3000
+G1 X120.775 Y29.377 F3000
+G1 X120.707 Y28.590 F3000
+G1 X120.636 Y27.824 F3000
+G1 X120.547 Y27.080 F3000
+G1 X120.434 Y26.358 F3000
+G1 X120.286 Y25.653 F3000
+G1 X120.101 Y24.961 F3000
+G1 X119.876 Y24.277 F3000
+G1 X119.614 Y23.595 F3000
+G1 X119.318 Y22.907 F3000
+G1 X118.997 Y22.207 F3000
+G1 X118.662 Y21.492 F3000
+G1 X118.325 Y20.757 F3000
+G1 X118.000 Y20.000 F3000
+G1 X117.702 Y19.221 F3000
+G1 X117.445 Y18.423 F3000
+G1 X117.244 Y17.608 F3000
+G1 X117.110 Y16.783 F3000
+G1 X117.055 Y15.954 F3000
+G1 X117.085 Y15.129 F3000
+G1 X117.206 Y14.317 F3000
+G1 X117.418 Y13.525 F3000
+G1 X117.720 Y12.761 F3000
+G1 X118.106 Y12.031 F3000
+G1 X118.568 Y11.341 F3000
+G1 X119.097 Y10.693 F3000
+G1 X119.678 Y10.088 F3000
+G1 X120.300 Y9.525 F3000
+G1 X120.947 Y9.000 F3000
+G1 X121.607 Y8.507 F3000
+G1 X122.267 Y8.039 F3000
+G1 X122.915 Y7.587 F3000
+G1 X123.542 Y7.142 F3000
+G1 X124.142 Y6.694 F3000
+G1 X124.711 Y6.234 F3000
+G1 X125.248 Y5.754 F3000
+G1 X125.754 Y5.248 F3000
+G1 X126.234 Y4.711 F3000
+G1 X126.694 Y4.142 F3000
+G1 X127.142 Y3.542 F3000
+G1 X127.587 Y2.915 F3000
+G1 X128.039 Y2.267 F3000
+G1 X128.507 Y1.607 F3000
+G1 X129.000 Y0.947 F3000
+G1 X129.525 Y0.300 F3000
+G1 X130.088 Y-0.322 F3000
+G1 X130.693 Y-0.903 F3000
+G1 X131.341 Y-1.432 F3000
+G1 X132.031 Y-1.894 F3000
+G1 X132.761 Y-2.280 F3000
+G1 X133.525 Y-2.582 F3000
+G1 X134.317 Y-2.794 F3000
+G1 X135.129 Y-2.915 F3000
+G1 X135.954 Y-2.945 F3000
+G1 X136.783 Y-2.890 F3000
+G1 X137.608 Y-2.756 F3000
+G1 X138.423 Y-2.555 F3000
+G1 X139.221 Y-2.298 F3000
+G1 X140.000 Y-2.000 F3000
+G1 X140.757 Y-1.675 F3000
+G1 X141.492 Y-1.338 F3000
+G1 X142.207 Y-1.003 F3000
+G1 X142.907 Y-0.682 F3000
+G1 X143.595 Y-0.386 F3000
+G1 X144.277 Y-0.124 F3000
+G1 X144.961 Y0.101 F3000
+G1 X145.653 Y0.286 F3000
+G1 X146.358 Y0.434 F3000
+G1 X147.080 Y0.547 F3000
+G1 X147.824 Y0.636 F3000
+G1 X148.590 Y0.707 F3000
+G1 X149.377 Y0.775 F3000
+G1 X150.182 Y0.851 F3000
+G1 X151.000 Y0.947 F3000
+G1 X151.823 Y1.078 F3000
+G1 X152.643 Y1.255 F3000
+G1 X153.450 Y1.488 F3000
+G1 X154.231 Y1.785 F3000
+G1 X154.976 Y2.152 F3000
+G1 X155.675 Y2.591 F3000
+G1 X156.319 Y3.101 F3000
+G1 X156.899 Y3.681 F3000
+G1 X157.409 Y4.325 F3000
+G1 X157.848 Y5.024 F3000
+G1 X158.215 Y5.769 F3000
+G1 X158.512 Y6.550 F3000
+G1 X158.745 Y7.357 F3000
+G1 X158.922 Y8.177 F3000
+G1 X159.053 Y9.000 F3000
+G1 X159.149 Y9.818 F3000
+G1 X159.225 Y10.623 F3000
+G1 X159.293 Y11.410 F3000
+G1 X159.364 Y12.176 F3000
+G1 X159.453 Y12.920 F3000
+G1 X159.566 Y13.642 F3000
+G1 X159.714 Y14.347 F3000
+G1 X159.899 Y15.039 F3000
+G1 X160.124 Y15.723 F3000
+G1 X160.386 Y16.405 F3000
+G1 X160.682 Y17.093 F3000
+G1 X161.003 Y17.793 F3000
+G1 X161.338 Y18.508 F3000
+G1 X161.675 Y19.243 F3000
+G1 X162.000 Y20.000 F3000
+M235
+M5
+G0 Z5
+G0 X28.000 Y80.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X28.000 Y80.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X42.000 Y80.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X42.298 Y80.779 F3000
+G1 X42.555 Y81.577 F3000
+G1 X42.756 Y82.392 F3000
+G1 X42.890 Y83.217 F3000
+G1 X42.945 Y84.046 F3000
+G1 X42.915 Y84.871 F3000
+G1 X42.794 Y85.683 F3000
+G1 X42.582 Y86.475 F3000
+G1 X42.280 Y87.239 F3000
+G1 X41.894 Y87.969 F3000
+G1 X41.432 Y88.659 F3000
+G1 X40.903 Y89.307 F3000
+G1 X40.322 Y89.912 F3000
+G1 X39.700 Y90.475 F3000
+G1 X39.053 Y91.000 F3000
+G1 X38.393 Y91.493 F3000
+G1 X37.733 Y91.961 F3000
+G1 X37.085 Y92.413 F3000
+G1 X36.458 Y92.858 F3000
+G1 X35.858 Y93.306 F3000
+G1 X35.289 Y93.766 F3000
+G1 X34.752 Y94.246 F3000
+G1 X34.246 Y94.752 F3000
+G1 X33.766 Y95.289 F3000
+G1 X33.306 Y95.858 F3000
+G1 X32.858 Y96.458 F3000
+G1 X32.413 Y97.085 F3000
+G1 X31.961 Y97.733 F3000
+G1 X31.493 Y98.393 F3000
+G1 X31.000 Y99.053 F3000
+G1 X30.475 Y99.700 F3000
+G1 X29.912 Y100.322 F3000
+G1 X29.307 Y100.903 F3000
+G1 X28.659 Y101.432 F3000
+G1 X27.969 Y101.894 F3000
+G1 X27.239 Y102.280 F3000
+G1 X26.475 Y102.582 F3000
+G1 X25.683 Y102.794 F3000
+G1 X24.871 Y102.915 F3000
+G1 X24.046 Y102.945 F3000
+G1 X23.217 Y102.890 F3000
+G1 X22.392 Y102.756 F3000
+G1 X21.577 Y102.555 F3000
+G1 X20.779 Y102.298 F3000
+G1 X20.000 Y102.000 F3000
+G1 X19.243 Y101.675 F3000
+G1 X18.508 Y101.338 F3000
+G1 X17.793 Y101.003 F3000
+G1 X17.093 Y100.682 F3000
+G1 X16.405 Y100.386 F3000
+G1 X15.723 Y100.124 F3000
+G1 X15.039 Y99.899 F3000
+G1 X14.347 Y99.714 F3000
+G1 X13.642 Y99.566 F3000
+G1 X12.920 Y99.453 F3000
+G1 X12.176 Y99.364 F3000
+G1 X11.410 Y99.293 F3000
+G1 X10.623 Y99.225 F3000
+G1 X9.818 Y99.149 F3000
+G1 X9.000 Y99.053 F3000
+G1 X8.177 Y98.922 F3000
+G1 X7.357 Y98.745 F3000
+G1 X6.550 Y98.512 F3000
+G1 X5.769 Y98.215 F3000
+G1 X5.024 Y97.848 F3000
+G1 X4.325 Y97.409 F3000
+G1 X3.681 Y96.899 F3000
+G1 X3.101 Y96.319 F3000
+G1 X2.591 Y95.675 F3000
+G1 X2.152 Y94.976 F3000
+G1 X1.785 Y94.231 F3000
+G1 X1.488 Y93.450 F3000
+G1 X1.255 Y92.643 F3000
+G1 X1.078 Y91.823 F3000
+G1 X0.947 Y91.000 F3000
+G1 X0.851 Y90.182 F3000
+G1 X0.775 Y89.377 F3000
+G1 X0.707 Y88.590 F3000
+G1 X0.636 Y87.824 F3000
+G1 X0.547 Y87.080 F3000
+G1 X0.434 Y86.358 F3000
+G1 X0.286 Y85.653 F3000
+G1 X0.101 Y84.961 F3000
+G1 X-0.124 Y84.277 F3000
+G1 X-0.386 Y83.595 F3000
+G1 X-0.682 Y82.907 F3000
+G1 X-1.003 Y82.207 F3000
+G1 X-1.338 Y81.492 F3000
+G1 X-1.675 Y80.757 F3000
+G1 X-2.000 Y80.000 F3000
+G1 X-2.298 Y79.221 F3000
+G1 X-2.555 Y78.423 F3000
+G1 X-2.756 Y77.608 F3000
+G1 X-2.890 Y76.783 F3000
+G1 X-2.945 Y75.954 F3000
+G1 X-2.915 Y75.129 F3000
+G1 X-2.794 Y74.317 F3000
+G1 X-2.582 Y73.525 F3000
+G1 X-2.280 Y72.761 F3000
+G1 X-1.894 Y72.031 F3000
+G1 X-1.432 Y71.341 F3000
+G1 X-0.903 Y70.693 F3000
+G1 X-0.322 Y70.088 F3000
+G1 X0.300 Y69.525 F3000
+G1 X0.947 Y69.000 F3000
+G1 X1.607 Y68.507 F3000
+G1 X2.267 Y68.039 F3000
+G1 X2.915 Y67.587 F3000
+G1 X3.542 Y67.142 F3000
+G1 X4.142 Y66.694 F3000
+G1 X4.711 Y66.234 F3000
+G1 X5.248 Y65.754 F3000
+G1 X5.754 Y65.248 F3000
+G1 X6.234 Y64.711 F3000
+G1 X6.694 Y64.142 F3000
+G1 X7.142 Y63.542 F3000
+G1 X7.587 Y62.915 F3000
+G1 X8.039 Y62.267 F3000
+G1 X8.507 Y61.607 F3000
+G1 X9.000 Y60.947 F3000
+G1 X9.525 Y60.300 F3000
+G1 X10.088 Y59.678 F3000
+G1 X10.693 Y59.097 F3000
+G1 X11.341 Y58.568 F3000
+G1 X12.031 Y58.106 F3000
+G1 X12.761 Y57.720 F3000
+G1 X13.525 Y57.418 F3000
+G1 X14.317 Y57.206 F3000
+G1 X15.129 Y57.085 F3000
+G1 X15.954 Y57.055 F3000
+G1 X16.783 Y57.110 F3000
+G1 X17.608 Y57.244 F3000
+G1 X18.423 Y57.445 F3000
+G1 X19.221 Y57.702 F3000
+G1 X20.000 Y58.000 F3000
+G1 X20.757 Y58.325 F3000
+G1 X21.492 Y58.662 F3000
+G1 X22.207 Y58.997 F3000
+G1 X22.907 Y59.318 F3000
+G1 X23.595 Y59.614 F3000
+G1 X24.277 Y59.876 F3000
+G1 X24.961 Y60.101 F3000
+G1 X25.653 Y60.286 F3000
+G1 X26.358 Y60.434 F3000
+G1 X27.080 Y60.547 F3000
+G1 X27.824 Y60.636 F3000
+G1 X28.590 Y60.707 F3000
+G1 X29.377 Y60.775 F3000
+G1 X30.182 Y60.851 F3000
+G1 X31.000 Y60.947 F3000
+G1 X31.823 Y61.078 F3000
+G1 X32.643 Y61.255 F3000
+G1 X33.450 Y61.488 F3000
+G1 X34.231 Y61.785 F3000
+G1 X34.976 Y62.152 F3000
+G1 X35.675 Y62.591 F3000
+G1 X36.319 Y63.101 F3000
+G1 X36.899 Y63.681 F3000
+G1 X37.409 Y64.325 F3000
+G1 X37.848 Y65.024 F3000
+G1 X38.215 Y65.769 F3000
+G1 X38.512 Y66.550 F3000
+G1 X38.745 Y67.357 F3000
+G1 X38.922 Y68.177 F3000
+G1 X39.053 Y69.000 F3000
+G1 X39.149 Y69.818 F3000
+G1 X39.225 Y70.623 F3000
+G1 X39.293 Y71.410 F3000
+G1 X39.364 Y72.176 F3000
+G1 X39.453 Y72.920 F3000
+G1 X39.566 Y73.642 F3000
+G1 X39.714 Y74.347 F3000
+G1 X39.899 Y75.039 F3000
+G1 X40.124 Y75.723 F3000
+G1 X40.386 Y76.405 F3000
+G1 X40.682 Y77.093 F3000
+G1 X41.003 Y77.793 F3000
+G1 X41.338 Y78.508 F3000
+G1 X41.675 Y79.243 F3000
+G1 X42.000 Y80.000 F3000
+M235
+M5
+G0 Z5
+G0 X88.000 Y80.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X88.000 Y80.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X102.000 Y80.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X102.298 Y80.779 F3000
+G1 X102.555 Y81.577 F3000
+G1 X102.756 Y82.392 F3000
+G1 X102.890 Y83.217 F3000
+G1 X102.945 Y84.046 F3000
+G1 X102.915 Y84.871 F3000
+G1 X102.794 Y85.683 F3000
+G1 X102.582 Y86.475 F3000
+G1 X102.280 Y87.239 F3000
+G1 X101.894 Y87.969 F3000
+G1 X101.432 Y88.659 F3000
+G1 X100.903 Y89.307 F3000
+G1 X100.322 Y89.912 F3000
+G1 X99.700 Y90.475 F3000
+G1 X99.053 Y91.000 F3000
+G1 X98.393 Y91.493 F3000
+G1 X97.733 Y91.961 F3000
+G1 X97.085 Y92.413 F3000
+G1 X96.458 Y92.858 F3000
+G1 X95.858 Y93.306 F3000
+G1 X95.289 Y93.766 F3000
+G1 X94.752 Y94.246 F3000
+G1 X94.246 Y94.752 F3000
+G1 X93.766 Y95.289 F3000
+G1 X93.306 Y95.858 F3000
+G1 X92.858 Y96.458 F3000
+G1 X92.413 Y97.085 F3000
+G1 X91.961 Y97.733 F3000
+G1 X91.493 Y98.393 F3000
+G1 X91.000 Y99.053 F3000
+G1 X90.475 Y99.700 F3000
+G1 X89.912 Y100.322 F3000
+G1 X89.307 Y100.903 F3000
+G1 X88.659 Y101.432 F3000
+G1 X87.969 Y101.894 F3000
+G1 X87.239 Y102.280 F3000
+G1 X86.475 Y102.582 F3000
+G1 X85.683 Y102.794 F3000
+G1 X84.871 Y102.915 F3000
+G1 X84.046 Y102.945 F3000
+G1 X83.217 Y102.890 F3000
+G1 X82.392 Y102.756 F3000
+G1 X81.577 Y102.555 F3000
+G1 X80.779 Y102.298 F3000
+G1 X80.000 Y102.000 F3000
+G1 X79.243 Y101.675 F3000
+G1 X78.508 Y101.338 F3000
+G1 X77.793 Y101.003 F3000
+G1 X77.093 Y100.682 F3000
+G1 X76.405 Y100.386 F3000
+G1 X75.723 Y100.124 F3000
+G1 X75.039 Y99.899 F3000
+G1 X74.347 Y99.714 F3000
+G1 X73.642 Y99.566 F3000
+G1 X72.920 Y99.453 F3000
+G1 X72.176 Y99.364 F3000
+G1 X71.410 Y99.293 F3000
+G1 X70.623 Y99.225 F3000
+G1 X69.818 Y99.149 F3000
+G1 X69.000 Y99.053 F3000
+G1 X68.177 Y98.922 F3000
+G1 X67.357 Y98.745 F3000
+G1 X66.550 Y98.512 F3000
+G1 X65.769 Y98.215 F3000
+G1 X65.024 Y97.848 F3000
+G1 X64.325 Y97.409 F3000
+G1 X63.681 Y96.899 F3000
+G1 X63.101 Y96.319 F3000
+G1 X62.591 Y95.675 F3000
+G1 X62.152 Y94.976 F3000
+G1 X61.785 Y94.231 F3000
+G1 X61.488 Y93.450 F3000
+G1 X61.255 Y92.643 F3000
+G1 X61.078 Y91.823 F3000
+G1 X60.947 Y91.000 F3000
+G1 X60.851 Y90.182 F3000
+G1 X60.775 Y89.377 F3000
+G1 X60.707 Y88.590 F3000
+G1 X60.636 Y87.824 F3000
+G1 X60.547 Y87.080 F3000
+G1 X60.434 Y86.358 F3000
+G1 X60.286 Y85.653 F3000
+G1 X60.101 Y84.961 F3000
+G1 X59.876 Y84.277 F3000
+G1 X59.614 Y83.595 F3000
+G1 X59.318 Y82.907 F3000
+G1 X58.997 Y82.207 F3000
+G1 X58.662 Y81.492 F3000
+G1 X58.325 Y80.757 F3000
+G1 X58.000 Y80.000 F3000
+G1 X57.702 Y79.221 F3000
+G1 X57.445 Y78.423 F3000
+G1 X57.244 Y77.608 F3000
+G1 X57.110 Y76.783 F3000
+G1 X57.055 Y75.954 F3000
+G1 X57.085 Y75.129 F3000
+G1 X57.206 Y74.317 F3000
+G1 X57.418 Y73.525 F3000
+G1 X57.720 Y72.761 F3000
+G1 X58.106 Y72.031 F3000
+G1 X58.568 Y71.341 F3000
+G1 X59.097 Y70.693 F3000
+G1 X59.678 Y70.088 F3000
+G1 X60.300 Y69.525 F3000
+G1 X60.947 Y69.000 F3000
+G1 X61.607 Y68.507 F3000
+G1 X62.267 Y68.039 F3000
+G1 X62.915 Y67.587 F3000
+G1 X63.542 Y67.142 F3000
+G1 X64.142 Y66.694 F3000
+G1 X64.711 Y66.234 F3000
+G1 X65.248 Y65.754 F3000
+G1 X65.754 Y65.248 F3000
+G1 X66.234 Y64.711 F3000
+G1 X66.694 Y64.142 F3000
+G1 X67.142 Y63.542 F3000
+G1 X67.587 Y62.915 F3000
+G1 X68.039 Y62.267 F3000
+G1 X68.507 Y61.607 F3000
+G1 X69.000 Y60.947 F3000
+G1 X69.525 Y60.300 F3000
+G1 X70.088 Y59.678 F3000
+G1 X70.693 Y59.097 F3000
+G1 X71.341 Y58.568 F3000
+G1 X72.031 Y58.106 F3000
+G1 X72.761 Y57.720 F3000
+G1 X73.525 Y57.418 F3000
+G1 X74.317 Y57.206 F3000
+G1 X75.129 Y57.085 F3000
+G1 X75.954 Y57.055 F3000
+G1 X76.783 Y57.110 F3000
+G1 X77.608 Y57.244 F3000
+G1 X78.423 Y57.445 F3000
+G1 X79.221 Y57.702 F3000
+G1 X80.000 Y58.000 F3000
+G1 X80.757 Y58.325 F3000
+G1 X81.492 Y58.662 F3000
+G1 X82.207 Y58.997 F3000
+G1 X82.907 Y59.318 F3000
+G1 X83.595 Y59.614 F3000
+G1 X84.277 Y59.876 F3000
+G1 X84.961 Y60.101 F3000
+G1 X85.653 Y60.286 F3000
+G1 X86.358 Y60.434 F3000
+G1 X87.080 Y60.547 F3000
+G1 X87.824 Y60.636 F3000
+G1 X88.590 Y60.707 F3000
+G1 X89.377 Y60.775 F3000
+G1 X90.182 Y60.851 F3000
+G1 X91.000 Y60.947 F3000
+G1 X91.823 Y61.078 F3000
+G1 X92.643 Y61.255 F3000
+G1 X93.450 Y61.488 F3000
+G1 X94.231 Y61.785 F3000
+G1 X94.976 Y62.152 F3000
+G1 X95.675 Y62.591 F3000
+G1 X96.319 Y63.101 F3000
+G1 X96.899 Y63.681 F3000
+G1 X97.409 Y64.325 F3000
+G1 X97.848 Y65.024 F3000
+G1 X98.215 Y65.769 F3000
+G1 X98.512 Y66.550 F3000
+G1 X98.745 Y67.357 F3000
+G1 X98.922 Y68.177 F3000
+G1 X99.053 Y69.000 F3000
+G1 X99.149 Y69.818 F3000
+G1 X99.225 Y70.623 F3000
+G1 X99.293 Y71.410 F3000
+G1 X99.364 Y72.176 F3000
+G1 X99.453 Y72.920 F3000
+G1 X99.566 Y73.642 F3000
+G1 X99.714 Y74.347 F3000
+G1 X99.899 Y75.039 F3000
+G1 X100.124 Y75.723 F3000
+G1 X100.386 Y76.405 F3000
+G1 X100.682 Y77.093 F3000
+G1 X101.003 Y77.793 F3000
+G1 X101.338 Y78.508 F3000
+G1 X101.675 Y79.243 F3000
+G1 X102.000 Y80.000 F3000
+M235
+M5
+G0 Z5
+G0 X148.000 Y80.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X148.000 Y80.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X162.000 Y80.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X162.298 Y80.779 F3000
+G1 X162.555 Y81.577 F3000
+G1 X162.756 Y82.392 F3000
+G1 X162.890 Y83.217 F3000
+G1 X162.945 Y84.046 F3000
+G1 X162.915 Y84.871 F3000
+G1 X162.794 Y85.683 F3000
+G1 X162.582 Y86.475 F3000
+G1 X162.280 Y87.239 F3000
+G1 X161.894 Y87.969 F3000
+G1 X161.432 Y88.659 F3000
+G1 X160.903 Y89.307 F3000
+G1 X160.322 Y89.912 F3000
+G1 X159.700 Y90.475 F3000
+G1 X159.053 Y91.000 F3000
+G1 X158.393 Y91.493 F3000
+G1 X157.733 Y91.961 F3000
+G1 X157.085 Y92.413 F3000
+G1 X156.458 Y92.858 F3000
+G1 X155.858 Y93.306 F3000
+G1 X155.289 Y93.766 F3000
+G1 X154.752 Y94.246 F3000
+G1 X154.246 Y94.752 F3000
+G1 X153.766 Y95.289 F3000
+G1 X153.306 Y95.858 F3000
+G1 X152.858 Y96.458 F3000
+G1 X152.413 Y97.085 F3000
+G1 X151.961 Y97.733 F3000
+G1 X151.493 Y98.393 F3000
+G1 X151.000 Y99.053 F3000
+G1 X150.475 Y99.700 F3000
+G1 X149.912 Y100.322 F3000
+G1 X149.307 Y100.903 F3000
+G1 X148.659 Y101.432 F3000
+G1 X147.969 Y101.894 F3000
+G1 X147.239 Y102.280 F3000
+G1 X146.475 Y102.582 F3000
+G1 X145.683 Y102.794 F3000
+G1 X144.871 Y102.915 F3000
+G1 X144.046 Y102.945 F3000
+G1 X143.217 Y102.890 F3000
+G1 X142.392 Y102.756 F3000
+G1 X141.577 Y102.555 F3000
+G1 X140.779 Y102.298 F3000
+G1 X140.000 Y102.000 F3000
+G1 X139.243 Y101.675 F3000
+G1 X138.508 Y101.338 F3000
+G1 X137.793 Y101.003 F3000
+G1 X137.093 Y100.682 F3000
+G1 X136.405 Y100.386 F3000
+G1 X135.723 Y100.124 F3000
+G1 X135.039 Y99.899 F3000
+G1 X134.347 Y99.714 F3000
+G1 X133.642 Y99.566 F3000
+G1 X132.920 Y99.453 F3000
+G1 X132.176 Y99.364 F3000
+G1 X131.410 Y99.293 F3000
+G1 X130.623 Y99.225 F3000
+G1 X129.818 Y99.149 F3000
+G1 X129.000 Y99.053 F3000
+G1 X128.177 Y98.922 F3000
+G1 X127.357 Y98.745 F3000
+G1 X126.550 Y98.512 F3000
+G1 X125.769 Y98.215 F3000
+G1 X125.024 Y97.848 F3000
+G1 X124.325 Y97.409 F3000
+G1 X123.681 Y96.899 F3000
+G1 X123.101 Y96.319 F3000
+G1 X122.591 Y95.675 F3000
+G1 X122.152 Y94.976 F3000
+G1 X121.785 Y94.231 F3000
+G1 X121.488 Y93.450 F3000
+G1 X121.255 Y92.643 F3000
+G1 X121.078 Y91.823 F3000
+G1 X120.947 Y91.000 F3000
+G1 X120.851 Y90.182 F3000
+G1 X120.775 Y89.377 F3000
+G1 X120.707 Y88.590 F3000
+G1 X120.636 Y87.824 F3000
+G1 X120.547 Y87.080 F3000
+G1 X120.434 Y86.358 F3000
+G1 X120.286 Y85.653 F3000
+G1 X120.101 Y84.961 F3000
+G1 X119.876 Y84.277 F3000
+G1 X119.614 Y83.595 F3000
+G1 X119.318 Y82.907 F3000
+G1 X118.997 Y82.207 F3000
+G1 X118.662 Y81.492 F3000
+G1 X118.325 Y80.757 F3000
+G1 X118.000 Y80.000 F3000
+G1 X117.702 Y79.221 F3000
+G1 X117.445 Y78.423 F3000
+G1 X117.244 Y77.608 F3000
+G1 X117.110 Y76.783 F3000
+G1 X117.055 Y75.954 F3000
+G1 X117.085 Y75.129 F3000
+G1 X117.206 Y74.317 F3000
+G1 X117.418 Y73.525 F3000
+G1 X117.720 Y72.761 F3000
+G1 X118.106 Y72.031 F3000
+G1 X118.568 Y71.341 F3000
+G1 X119.097 Y70.693 F3000
+G1 X119.678 Y70.088 F3000
+G1 X120.300 Y69.525 F3000
+G1 X120.947 Y69.000 F3000
+G1 X121.607 Y68.507 F3000
+G1 X122.267 Y68.039 F3000
+G1 X122.915 Y67.587 F3000
+G1 X123.542 Y67.142 F3000
+G1 X124.142 Y66.694 F3000
+G1 X124.711 Y66.234 F3000
+G1 X125.248 Y65.754 F3000
+G1 X125.754 Y65.248 F3000
+G1 X126.234 Y64.711 F3000
+G1 X126.694 Y64.142 F3000
+G1 X127.142 Y63.542 F3000
+G1 X127.587 Y62.915 F3000
+G1 X128.039 Y62.267 F3000
+G1 X128.507 Y61.607 F3000
+G1 X129.000 Y60.947 F3000
+G1 X129.525 Y60.300 F3000
+G1 X130.088 Y59.678 F3000
+G1 X130.693 Y59.097 F3000
+G1 X131.341 Y58.568 F3000
+G1 X132.031 Y58.106 F3000
+G1 X132.761 Y57.720 F3000
+G1 X133.525 Y57.418 F3000
+G1 X134.317 Y57.206 F3000
+G1 X135.129 Y57.085 F3000
+G1 X135.954 Y57.055 F3000
+G1 X136.783 Y57.110 F3000
+G1 X137.608 Y57.244 F3000
+G1 X138.423 Y57.445 F3000
+G1 X139.221 Y57.702 F3000
+G1 X140.000 Y58.000 F3000
+G1 X140.757 Y58.325 F3000
+G1 X141.492 Y58.662 F3000
+G1 X142.207 Y58.997 F3000
+G1 X142.907 Y59.318 F3000
+G1 X143.595 Y59.614 F3000
+G1 X144.277 Y59.876 F3000
+G1 X144.961 Y60.101 F3000
+G1 X145.653 Y60.286 F3000
+G1 X146.358 Y60.434 F3000
+G1 X147.080 Y60.547 F3000
+G1 X147.824 Y60.636 F3000
+G1 X148.590 Y60.707 F3000
+G1 X149.377 Y60.775 F3000
+G1 X150.182 Y60.851 F3000
+G1 X151.000 Y60.947 F3000
+G1 X151.823 Y61.078 F3000
+G1 X152.643 Y61.255 F3000
+G1 X153.450 Y61.488 F3000
+G1 X154.231 Y61.785 F3000
+G1 X154.976 Y62.152 F3000
+G1 X155.675 Y62.591 F3000
+G1 X156.319 Y63.101 F3000
+G1 X156.899 Y63.681 F3000
+G1 X157.409 Y64.325 F3000
+G1 X157.848 Y65.024 F3000
+G1 X158.215 Y65.769 F3000
+G1 X158.512 Y66.550 F3000
+G1 X158.745 Y67.357 F3000
+G1 X158.922 Y68.177 F3000
+G1 X159.053 Y69.000 F3000
+G1 X159.149 Y69.818 F3000
+G1 X159.225 Y70.623 F3000
+G1 X159.293 Y71.410 F3000
+G1 X159.364 Y72.176 F3000
+G1 X159.453 Y72.920 F3000
+G1 X159.566 Y73.642 F3000
+G1 X159.714 Y74.347 F3000
+G1 X159.899 Y75.039 F3000
+G1 X160.124 Y75.723 F3000
+G1 X160.386 Y76.405 F3000
+G1 X160.682 Y77.093 F3000
+G1 X161.003 Y77.793 F3000
+G1 X161.338 Y78.508 F3000
+G1 X161.675 Y79.243 F3000
+G1 X162.000 Y80.000 F3000
+M235
+M5
+G0 Z5
+G0 X28.000 Y140.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X28.000 Y140.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X42.000 Y140.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X42.298 Y140.779 F3000
+G1 X42.555 Y141.577 F3000
+G1 X42.756 Y142.392 F3000
+G1 X42.890 Y143.217 F3000
+G1 X42.945 Y144.046 F3000
+G1 X42.915 Y144.871 F3000
+G1 X42.794 Y145.683 F3000
+G1 X42.582 Y146.475 F3000
+G1 X42.280 Y147.239 F3000
+G1 X41.894 Y147.969 F3000
+G1 X41.432 Y148.659 F3000
+G1 X40.903 Y149.307 F3000
+G1 X40.322 Y149.912 F3000
+G1 X39.700 Y150.475 F3000
+G1 X39.053 Y151.000 F3000
+G1 X38.393 Y151.493 F3000
+G1 X37.733 Y151.961 F3000
+G1 X37.085 Y152.413 F3000
+G1 X36.458 Y152.858 F3000
+G1 X35.858 Y153.306 F3000
+G1 X35.289 Y153.766 F3000
+G1 X34.752 Y154.246 F3000
+G1 X34.246 Y154.752 F3000
+G1 X33.766 Y155.289 F3000
+G1 X33.306 Y155.858 F3000
+G1 X32.858 Y156.458 F3000
+G1 X32.413 Y157.085 F3000
+G1 X31.961 Y157.733 F3000
+G1 X31.493 Y158.393 F3000
+G1 X31.000 Y159.053 F3000
+G1 X30.475 Y159.700 F3000
+G1 X29.912 Y160.322 F3000
+G1 X29.307 Y160.903 F3000
+G1 X28.659 Y161.432 F3000
+G1 X27.969 Y161.894 F3000
+G1 X27.239 Y162.280 F3000
+G1 X26.475 Y162.582 F3000
+G1 X25.683 Y162.794 F3000
+G1 X24.871 Y162.915 F3000
+G1 X24.046 Y162.945 F3000
+G1 X23.217 Y162.890 F3000
+G1 X22.392 Y162.756 F3000
+G1 X21.577 Y162.555 F3000
+G1 X20.779 Y162.298 F3000
+G1 X20.000 Y162.000 F3000
+G1 X19.243 Y161.675 F3000
+G1 X18.508 Y161.338 F3000
+G1 X17.793 Y161.003 F3000
+G1 X17.093 Y160.682 F3000
+G1 X16.405 Y160.386 F3000
+G1 X15.723 Y160.124 F3000
+G1 X15.039 Y159.899 F3000
+G1 X14.347 Y159.714 F3000
+G1 X13.642 Y159.566 F3000
+G1 X12.920 Y159.453 F3000
+G1 X12.176 Y159.364 F3000
+G1 X11.410 Y159.293 F3000
+G1 X10.623 Y159.225 F3000
+G1 X9.818 Y159.149 F3000
+G1 X9.000 Y159.053 F3000
+G1 X8.177 Y158.922 F3000
+G1 X7.357 Y158.745 F3000
+G1 X6.550 Y158.512 F3000
+G1 X5.769 Y158.215 F3000
+G1 X5.024 Y157.848 F3000
+G1 X4.325 Y157.409 F3000
+G1 X3.681 Y156.899 F3000
+G1 X3.101 Y156.319 F3000
+G1 X2.591 Y155.675 F3000
+G1 X2.152 Y154.976 F3000
+G1 X1.785 Y154.231 F3000
+G1 X1.488 Y153.450 F3000
+G1 X1.255 Y152.643 F3000
+G1 X1.078 Y151.823 F3000
+G1 X0.947 Y151.000 F3000
+G1 X0.851 Y150.182 F3000
+G1 X0.775 Y149.377 F3000
+G1 X0.707 Y148.590 F3000
+G1 X0.636 Y147.824 F3000
+G1 X0.547 Y147.080 F3000
+G1 X0.434 Y146.358 F3000
+G1 X0.286 Y145.653 F3000
+G1 X0.101 Y144.961 F3000
+G1 X-0.124 Y144.277 F3000
+G1 X-0.386 Y143.595 F3000
+G1 X-0.682 Y142.907 F3000
+G1 X-1.003 Y142.207 F3000
+G1 X-1.338 Y141.492 F3000
+G1 X-1.675 Y140.757 F3000
+G1 X-2.000 Y140.000 F3000
+G1 X-2.298 Y139.221 F3000
+G1 X-2.555 Y138.423 F3000
+G1 X-2.756 Y137.608 F3000
+G1 X-2.890 Y136.783 F3000
+G1 X-2.945 Y135.954 F3000
+G1 X-2.915 Y135.129 F3000
+G1 X-2.794 Y134.317 F3000
+G1 X-2.582 Y133.525 F3000
+G1 X-2.280 Y132.761 F3000
+G1 X-1.894 Y132.031 F3000
+G1 X-1.432 Y131.341 F3000
+G1 X-0.903 Y130.693 F3000
+G1 X-0.322 Y130.088 F3000
+G1 X0.300 Y129.525 F3000
+G1 X0.947 Y129.000 F3000
+G1 X1.607 Y128.507 F3000
+G1 X2.267 Y128.039 F3000
+G1 X2.915 Y127.587 F3000
+G1 X3.542 Y127.142 F3000
+G1 X4.142 Y126.694 F3000
+G1 X4.711 Y126.234 F3000
+G1 X5.248 Y125.754 F3000
+G1 X5.754 Y125.248 F3000
+G1 X6.234 Y124.711 F3000
+G1 X6.694 Y124.142 F3000
+G1 X7.142 Y123.542 F3000
+G1 X7.587 Y122.915 F3000
+G1 X8.039 Y122.267 F3000
+G1 X8.507 Y121.607 F3000
+G1 X9.000 Y120.947 F3000
+G1 X9.525 Y120.300 F3000
+G1 X10.088 Y119.678 F3000
+G1 X10.693 Y119.097 F3000
+G1 X11.341 Y118.568 F3000
+G1 X12.031 Y118.106 F3000
+G1 X12.761 Y117.720 F3000
+G1 X13.525 Y117.418 F3000
+G1 X14.317 Y117.206 F3000
+G1 X15.129 Y117.085 F3000
+G1 X15.954 Y117.055 F3000
+G1 X16.783 Y117.110 F3000
+G1 X17.608 Y117.244 F3000
+G1 X18.423 Y117.445 F3000
+G1 X19.221 Y117.702 F3000
+G1 X20.000 Y118.000 F3000
+G1 X20.757 Y118.325 F3000
+G1 X21.492 Y118.662 F3000
+G1 X22.207 Y118.997 F3000
+G1 X22.907 Y119.318 F3000
+G1 X23.595 Y119.614 F3000
+G1 X24.277 Y119.876 F3000
+G1 X24.961 Y120.101 F3000
+G1 X25.653 Y120.286 F3000
+G1 X26.358 Y120.434 F3000
+G1 X27.080 Y120.547 F3000
+G1 X27.824 Y120.636 F3000
+G1 X28.590 Y120.707 F3000
+G1 X29.377 Y120.775 F3000
+G1 X30.182 Y120.851 F3000
+G1 X31.000 Y120.947 F3000
+G1 X31.823 Y121.078 F3000
+G1 X32.643 Y121.255 F3000
+G1 X33.450 Y121.488 F3000
+G1 X34.231 Y121.785 F3000
+G1 X34.976 Y122.152 F3000
+G1 X35.675 Y122.591 F3000
+G1 X36.319 Y123.101 F3000
+G1 X36.899 Y123.681 F3000
+G1 X37.409 Y124.325 F3000
+G1 X37.848 Y125.024 F3000
+G1 X38.215 Y125.769 F3000
+G1 X38.512 Y126.550 F3000
+G1 X38.745 Y127.357 F3000
+G1 X38.922 Y128.177 F3000
+G1 X39.053 Y129.000 F3000
+G1 X39.149 Y129.818 F3000
+G1 X39.225 Y130.623 F3000
+G1 X39.293 Y131.410 F3000
+G1 X39.364 Y132.176 F3000
+G1 X39.453 Y132.920 F3000
+G1 X39.566 Y133.642 F3000
+G1 X39.714 Y134.347 F3000
+G1 X39.899 Y135.039 F3000
+G1 X40.124 Y135.723 F3000
+G1 X40.386 Y136.405 F3000
+G1 X40.682 Y137.093 F3000
+G1 X41.003 Y137.793 F3000
+G1 X41.338 Y138.508 F3000
+G1 X41.675 Y139.243 F3000
+G1 X42.000 Y140.000 F3000
+M235
+M5
+G0 Z5
+G0 X88.000 Y140.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X88.000 Y140.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X102.000 Y140.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X102.298 Y140.779 F3000
+G1 X102.555 Y141.577 F3000
+G1 X102.756 Y142.392 F3000
+G1 X102.890 Y143.217 F3000
+G1 X102.945 Y144.046 F3000
+G1 X102.915 Y144.871 F3000
+G1 X102.794 Y145.683 F3000
+G1 X102.582 Y146.475 F3000
+G1 X102.280 Y147.239 F3000
+G1 X101.894 Y147.969 F3000
+G1 X101.432 Y148.659 F3000
+G1 X100.903 Y149.307 F3000
+G1 X100.322 Y149.912 F3000
+G1 X99.700 Y150.475 F3000
+G1 X99.053 Y151.000 F3000
+G1 X98.393 Y151.493 F3000
+G1 X97.733 Y151.961 F3000
+G1 X97.085 Y152.413 F3000
+G1 X96.458 Y152.858 F3000
+G1 X95.858 Y153.306 F3000
+G1 X95.289 Y153.766 F3000
+G1 X94.752 Y154.246 F3000
+G1 X94.246 Y154.752 F3000
+G1 X93.766 Y155.289 F3000
+G1 X93.306 Y155.858 F3000
+G1 X92.858 Y156.458 F3000
+G1 X92.413 Y157.085 F3000
+G1 X91.961 Y157.733 F3000
+G1 X91.493 Y158.393 F3000
+G1 X91.000 Y159.053 F3000
+G1 X90.475 Y159.700 F3000
+G1 X89.912 Y160.322 F3000
+G1 X89.307 Y160.903 F3000
+G1 X88.659 Y161.432 F3000
+G1 X87.969 Y161.894 F3000
+G1 X87.239 Y162.280 F3000
+G1 X86.475 Y162.582 F3000
+G1 X85.683 Y162.794 F3000
+G1 X84.871 Y162.915 F3000
+G1 X84.046 Y162.945 F3000
+G1 X83.217 Y162.890 F3000
+G1 X82.392 Y162.756 F3000
+G1 X81.577 Y162.555 F3000
+G1 X80.779 Y162.298 F3000
+G1 X80.000 Y162.000 F3000
+G1 X79.243 Y161.675 F3000
+G1 X78.508 Y161.338 F3000
+G1 X77.793 Y161.003 F3000
+G1 X77.093 Y160.682 F3000
+G1 X76.405 Y160.386 F3000
+G1 X75.723 Y160.124 F3000
+G1 X75.039 Y159.899 F3000
+G1 X74.347 Y159.714 F3000
+G1 X73.642 Y159.566 F3000
+G1 X72.920 Y159.453 F3000
+G1 X72.176 Y159.364 F3000
+G1 X71.410 Y159.293 F3000
+G1 X70.623 Y159.225 F3000
+G1 X69.818 Y159.149 F3000
+G1 X69.000 Y159.053 F3000
+G1 X68.177 Y158.922 F3000
+G1 X67.357 Y158.745 F3000
+G1 X66.550 Y158.512 F3000
+G1 X65.769 Y158.215 F3000
+G1 X65.024 Y157.848 F3000
+G1 X64.325 Y157.409 F3000
+G1 X63.681 Y156.899 F3000
+G1 X63.101 Y156.319 F3000
+G1 X62.591 Y155.675 F3000
+G1 X62.152 Y154.976 F3000
+G1 X61.785 Y154.231 F3000
+G1 X61.488 Y153.450 F3000
+G1 X61.255 Y152.643 F3000
+G1 X61.078 Y151.823 F3000
+G1 X60.947 Y151.000 F3000
+G1 X60.851 Y150.182 F3000
+G1 X60.775 Y149.377 F3000
+G1 X60.707 Y148.590 F3000
+G1 X60.636 Y147.824 F3000
+G1 X60.547 Y147.080 F3000
+G1 X60.434 Y146.358 F3000
+G1 X60.286 Y145.653 F3000
+G1 X60.101 Y144.961 F3000
+G1 X59.876 Y144.277 F3000
+G1 X59.614 Y143.595 F3000
+G1 X59.318 Y142.907 F3000
+G1 X58.997 Y142.207 F3000
+G1 X58.662 Y141.492 F3000
+G1 X58.325 Y140.757 F3000
+G1 X58.000 Y140.000 F3000
+G1 X57.702 Y139.221 F3000
+G1 X57.445 Y138.423 F3000
+G1 X57.244 Y137.608 F3000
+G1 X57.110 Y136.783 F3000
+G1 X57.055 Y135.954 F3000
+G1 X57.085 Y135.129 F3000
+G1 X57.206 Y134.317 F3000
+G1 X57.418 Y133.525 F3000
+G1 X57.720 Y132.761 F3000
+G1 X58.106 Y132.031 F3000
+G1 X58.568 Y131.341 F3000
+G1 X59.097 Y130.693 F3000
+G1 X59.678 Y130.088 F3000
+G1 X60.300 Y129.525 F3000
+G1 X60.947 Y129.000 F3000
+G1 X61.607 Y128.507 F3000
+G1 X62.267 Y128.039 F3000
+G1 X62.915 Y127.587 F3000
+G1 X63.542 Y127.142 F3000
+G1 X64.142 Y126.694 F3000
+G1 X64.711 Y126.234 F3000
+G1 X65.248 Y125.754 F3000
+G1 X65.754 Y125.248 F3000
+G1 X66.234 Y124.711 F3000
+G1 X66.694 Y124.142 F3000
+G1 X67.142 Y123.542 F3000
+G1 X67.587 Y122.915 F3000
+G1 X68.039 Y122.267 F3000
+G1 X68.507 Y121.607 F3000
+G1 X69.000 Y120.947 F3000
+G1 X69.525 Y120.300 F3000
+G1 X70.088 Y119.678 F3000
+G1 X70.693 Y119.097 F3000
+G1 X71.341 Y118.568 F3000
+G1 X72.031 Y118.106 F3000
+G1 X72.761 Y117.720 F3000
+G1 X73.525 Y117.418 F3000
+G1 X74.317 Y117.206 F3000
+G1 X75.129 Y117.085 F3000
+G1 X75.954 Y117.055 F3000
+G1 X76.783 Y117.110 F3000
+G1 X77.608 Y117.244 F3000
+G1 X78.423 Y117.445 F3000
+G1 X79.221 Y117.702 F3000
+G1 X80.000 Y118.000 F3000
+G1 X80.757 Y118.325 F3000
+G1 X81.492 Y118.662 F3000
+G1 X82.207 Y118.997 F3000
+G1 X82.907 Y119.318 F3000
+G1 X83.595 Y119.614 F3000
+G1 X84.277 Y119.876 F3000
+G1 X84.961 Y120.101 F3000
+G1 X85.653 Y120.286 F3000
+G1 X86.358 Y120.434 F3000
+G1 X87.080 Y120.547 F3000
+G1 X87.824 Y120.636 F3000
+G1 X88.590 Y120.707 F3000
+G1 X89.377 Y120.775 F3000
+G1 X90.182 Y120.851 F3000
+G1 X91.000 Y120.947 F3000
+G1 X91.823 Y121.078 F3000
+G1 X92.643 Y121.255 F3000
+G1 X93.450 Y121.488 F3000
+G1 X94.231 Y121.785 F3000
+G1 X94.976 Y122.152 F3000
+G1 X95.675 Y122.591 F3000
+G1 X96.319 Y123.101 F3000
+G1 X96.899 Y123.681 F3000
+G1 X97.409 Y124.325 F3000
+G1 X97.848 Y125.024 F3000
+G1 X98.215 Y125.769 F3000
+G1 X98.512 Y126.550 F3000
+G1 X98.745 Y127.357 F3000
+G1 X98.922 Y128.177 F3000
+G1 X99.053 Y129.000 F3000
+G1 X99.149 Y129.818 F3000
+G1 X99.225 Y130.623 F3000
+G1 X99.293 Y131.410 F3000
+G1 X99.364 Y132.176 F3000
+G1 X99.453 Y132.920 F3000
+G1 X99.566 Y133.642 F3000
+G1 X99.714 Y134.347 F3000
+G1 X99.899 Y135.039 F3000
+G1 X100.124 Y135.723 F3000
+G1 X100.386 Y136.405 F3000
+G1 X100.682 Y137.093 F3000
+G1 X101.003 Y137.793 F3000
+G1 X101.338 Y138.508 F3000
+G1 X101.675 Y139.243 F3000
+G1 X102.000 Y140.000 F3000
+M235
+M5
+G0 Z5
+G0 X148.000 Y140.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G2 X148.000 Y140.000 I-8 J0 F2500
+M235
+M5
+G0 Z5
+G0 X162.000 Y140.000
+M3 S1000
+G4 P0.2
+G1 Z1.5 F600
+M234
+G1 X162.298 Y140.779 F3000
+G1 X162.555 Y141.577 F3000
+G1 X162.756 Y142.392 F3000
+G1 X162.890 Y143.217 F3000
+G1 X162.945 Y144.046 F3000
+G1 X162.915 Y144.871 F3000
+G1 X162.794 Y145.683 F3000
+G1 X162.582 Y146.475 F3000
+G1 X162.280 Y147.239 F3000
+G1 X161.894 Y147.969 F3000
+G1 X161.432 Y148.659 F3000
+G1 X160.903 Y149.307 F3000
+G1 X160.322 Y149.912 F3000
+G1 X159.700 Y150.475 F3000
+G1 X159.053 Y151.000 F3000
+G1 X158.393 Y151.493 F3000
+G1 X157.733 Y151.961 F3000
+G1 X157.085 Y152.413 F3000
+G1 X156.458 Y152.858 F3000
+G1 X155.858 Y153.306 F3000
+G1 X155.289 Y153.766 F3000
+G1 X154.752 Y154.246 F3000
+G1 X154.246 Y154.752 F3000
+G1 X153.766 Y155.289 F3000
+G1 X153.306 Y155.858 F3000
+G1 X152.858 Y156.458 F3000
+G1 X152.413 Y157.085 F3000
+G1 X151.961 Y157.733 F3000
+G1 X151.493 Y158.393 F3000
+G1 X151.000 Y159.053 F3000
+G1 X150.475 Y159.700 F3000
+G1 X149.912 Y160.322 F3000
+G1 X149.307 Y160.903 F3000
+G1 X148.659 Y161.432 F3000
+G1 X147.969 Y161.894 F3000
+G1 X147.239 Y162.280 F3000
+G1 X146.475 Y162.582 F3000
+G1 X145.683 Y162.794 F3000
+G1 X144.871 Y162.915 F3000
+G1 X144.046 Y162.945 F3000
+G1 X143.217 Y162.890 F3000
+G1 X142.392 Y162.756 F3000
+G1 X141.577 Y162.555 F3000
+G1 X140.779 Y162.298 F3000
+G1 X140.000 Y162.000 F3000
+G1 X139.243 Y161.675 F3000
+G1 X138.508 Y161.338 F3000
+G1 X137.793 Y161.003 F3000
+G1 X137.093 Y160.682 F3000
+G1 X136.405 Y160.386 F3000
+G1 X135.723 Y160.124 F3000
+G1 X135.039 Y159.899 F3000
+G1 X134.347 Y159.714 F3000
+G1 X133.642 Y159.566 F3000
+G1 X132.920 Y159.453 F3000
+G1 X132.176 Y159.364 F3000
+G1 X131.410 Y159.293 F3000
+G1 X130.623 Y159.225 F3000
+G1 X129.818 Y159.149 F3000
+G1 X129.000 Y159.053 F3000
+G1 X128.177 Y158.922 F3000
+G1 X127.357 Y158.745 F3000
+G1 X126.550 Y158.512 F3000
+G1 X125.769 Y158.215 F3000
+G1 X125.024 Y157.848 F3000
+G1 X124.325 Y157.409 F3000
+G1 X123.681 Y156.899 F3000
+G1 X123.101 Y156.319 F3000
+G1 X122.591 Y155.675 F3000
+G1 X122.152 Y154.976 F3000
+G1 X121.785 Y154.231 F3000
+G1 X121.488 Y153.450 F3000
+G1 X121.255 Y152.643 F3000
+G1 X121.078 Y151.823 F3000
+G1 X120.947 Y151.000 F3000
+G1 X120.851 Y150.182 F3000
+G1 X120.775 Y149.377 F3000
+G1 X120.707 Y148.590 F3000
+G1 X120.636 Y147.824 F3000
+G1 X120.547 Y147.080 F3000
+G1 X120.434 Y146.358 F3000
+G1 X120.286 Y145.653 F3000
+G1 X120.101 Y144.961 F3000
+G1 X119.876 Y144.277 F3000
+G1 X119.614 Y143.595 F3000
+G1 X119.318 Y142.907 F3000
+G1 X118.997 Y142.207 F3000
+G1 X118.662 Y141.492 F3000
+G1 X118.325 Y140.757 F3000
+G1 X118.000 Y140.000 F3000
+G1 X117.702 Y139.221 F3000
+G1 X117.445 Y138.423 F3000
+G1 X117.244 Y137.608 F3000
+G1 X117.110 Y136.783 F3000
+G1 X117.055 Y135.954 F3000
+G1 X117.085 Y135.129 F3000
+G1 X117.206 Y134.317 F3000
+G1 X117.418 Y133.525 F3000
+G1 X117.720 Y132.761 F3000
+G1 X118.106 Y132.031 F3000
+G1 X118.568 Y131.341 F3000
+G1 X119.097 Y130.693 F3000
+G1 X119.678 Y130.088 F3000
+G1 X120.300 Y129.525 F3000
+G1 X120.947 Y129.000 F3000
+G1 X121.607 Y128.507 F3000
+G1 X122.267 Y128.039 F3000
+G1 X122.915 Y127.587 F3000
+G1 X123.542 Y127.142 F3000
+G1 X124.142 Y126.694 F3000
+G1 X124.711 Y126.234 F3000
+G1 X125.248 Y125.754 F3000
+G1 X125.754 Y125.248 F3000
+G1 X126.234 Y124.711 F3000
+G1 X126.694 Y124.142 F3000
+G1 X127.142 Y123.542 F3000
+G1 X127.587 Y122.915 F3000
+G1 X128.039 Y122.267 F3000
+G1 X128.507 Y121.607 F3000
+G1 X129.000 Y120.947 F3000
+G1 X129.525 Y120.300 F3000
+G1 X130.088 Y119.678 F3000
+G1 X130.693 Y119.097 F3000
+G1 X131.341 Y118.568 F3000
+G1 X132.031 Y118.106 F3000
+G1 X132.761 Y117.720 F3000
+G1 X133.525 Y117.418 F3000
+G1 X134.317 Y117.206 F3000
+G1 X135.129 Y117.085 F3000
+G1 X135.954 Y117.055 F3000
+G1 X136.783 Y117.110 F3000
+G1 X137.608 Y117.244 F3000
+G1 X138.423 Y117.445 F3000
+G1 X139.221 Y117.702 F3000
+G1 X140.000 Y118.000 F3000
+G1 X140.757 Y118.325 F3000
+G1 X141.492 Y118.662 F3000
+G1 X142.207 Y118.997 F3000
+G1 X142.907 Y119.318 F3000
+G1 X143.595 Y119.614 F3000
+G1 X144.277 Y119.876 F3000
+G1 X144.961 Y120.101 F3000
+G1 X145.653 Y120.286 F3000
+G1 X146.358 Y120.434 F3000
+G1 X147.080 Y120.547 F3000
+G1 X147.824 Y120.636 F3000
+G1 X148.590 Y120.707 F3000
+G1 X149.377 Y120.775 F3000
+G1 X150.182 Y120.851 F3000
+G1 X151.000 Y120.947 F3000
+G1 X151.823 Y121.078 F3000
+G1 X152.643 Y121.255 F3000
+G1 X153.450 Y121.488 F3000
+G1 X154.231 Y121.785 F3000
+G1 X154.976 Y122.152 F3000
+G1 X155.675 Y122.591 F3000
+G1 X156.319 Y123.101 F3000
+G1 X156.899 Y123.681 F3000
+G1 X157.409 Y124.325 F3000
+G1 X157.848 Y125.024 F3000
+G1 X158.215 Y125.769 F3000
+G1 X158.512 Y126.550 F3000
+G1 X158.745 Y127.357 F3000
+G1 X158.922 Y128.177 F3000
+G1 X159.053 Y129.000 F3000
+G1 X159.149 Y129.818 F3000
+G1 X159.225 Y130.623 F3000
+G1 X159.293 Y131.410 F3000
+G1 X159.364 Y132.176 F3000
+G1 X159.453 Y132.920 F3000
+G1 X159.566 Y133.642 F3000
+G1 X159.714 Y134.347 F3000
+G1 X159.899 Y135.039 F3000
+G1 X160.124 Y135.723 F3000
+G1 X160.386 Y136.405 F3000
+G1 X160.682 Y137.093 F3000
+G1 X161.003 Y137.793 F3000
+G1 X161.338 Y138.508 F3000
+G1 X161.675 Y139.243 F3000
+G1 X162.000 Y140.000 F3000
+M235
+M5
+G0 Z5
+G0 X0 Y0
+M2
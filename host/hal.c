@@ -0,0 +1,103 @@
+/**
+ *  hal.c - Mocked hardware for the host build
+ *  Replaces eeprom.c, serial.c and the Arduino core functions used by ports.c.
+ * */
+
+#include <stdio.h>
+#include "grbl.h"
+#include "hal.h"
+
+#define R(name) volatile uint8_t name;
+HOST_REGISTERS_8
+#undef R
+#define R(name) volatile uint16_t name;
+HOST_REGISTERS_16
+#undef R
+
+static uint8_t hal_eeprom[HAL_EEPROM_SIZE];
+
+
+static uint8_t hal_default_serial_read() { return(SERIAL_NO_DATA); }
+static uint8_t hal_default_serial_available() { return(0); }
+static void hal_default_serial_write(uint8_t data) { putchar(data); }
+static void hal_default_delay(double us) { }
+
+uint8_t (*hal_serial_read)() = hal_default_serial_read;
+uint8_t (*hal_serial_available)() = hal_default_serial_available;
+void (*hal_serial_write)(uint8_t data) = hal_default_serial_write;
+void (*hal_delay)(double us) = hal_default_delay;
+
+
+void hal_init()
+{
+  // Inputs idle high, as with the pull-ups enabled. Active low control and limit pins are released.
+  PINA = PINB = PINC = PIND = PINE = PINF = PING = PINH = PINJ = PINK = PINL = 0xFF;
+  memset(hal_eeprom, 0xFF, sizeof(hal_eeprom));
+}
+
+
+void _delay_us(double us) { hal_delay(us); }
+void _delay_ms(double ms) { hal_delay(ms*1000.0); }
+
+
+// EEPROM. Same checksum as eeprom.c, so stored settings are validated the same way.
+unsigned char eeprom_get_char(unsigned int addr) { return(hal_eeprom[addr % HAL_EEPROM_SIZE]); }
+void eeprom_put_char(unsigned int addr, unsigned char new_value) { hal_eeprom[addr % HAL_EEPROM_SIZE] = new_value; }
+
+void memcpy_to_eeprom_with_checksum(unsigned int destination, char *source, unsigned int size)
+{
+  unsigned char checksum = 0;
+  for(; size > 0; size--) {
+    checksum = (checksum << 1) || (checksum >> 7);
+    checksum += *source;
+    eeprom_put_char(destination++, *(source++));
+  }
+  eeprom_put_char(destination, checksum);
+}
+
+int memcpy_from_eeprom_with_checksum(char *destination, unsigned int source, unsigned int size)
+{
+  unsigned char data, checksum = 0;
+  for(; size > 0; size--) {
+    data = eeprom_get_char(source++);
+    checksum = (checksum << 1) || (checksum >> 7);
+    checksum += data;
+    *(destination++) = data;
+  }
+  return(checksum == eeprom_get_char(source));
+}
+
+
+// Serial port. Buffers belong to the host program, which always has room.
+void serial_init() { }
+void serial_set_baud_rate(uint32_t baud_rate) { }
+uint8_t serial_check_baud_rate(uint32_t baud_rate) { return(baud_rate == BAUD_RATE); }
+uint16_t serial_get_rx_error_count() { return(0); }
+void serial_reset_rx_error_count() { }
+void serial_write(uint8_t data) { hal_serial_write(data); }
+uint8_t serial_read() { return(hal_serial_read()); }
+void serial_reset_read_buffer() { }
+uint8_t serial_get_rx_buffer_available() { return(RX_BUFFER_SIZE); }
+uint8_t serial_get_rx_buffer_count() { return(hal_serial_available()); }
+uint8_t serial_get_tx_buffer_count() { return(0); }
+uint8_t serial_get_tx_buffer_available() { return(TX_BUFFER_SIZE); }
+uint32_t serial_get_tx_stall_ticks() { return(0); }
+
+#ifdef ENABLE_BINARY_FRAMING
+  void serial_rx_frame_begin() { }
+  uint8_t serial_rx_frame_is_short(uint16_t n) { return(false); } // Frames always fit.
+#endif
+
+#ifdef ENABLE_TELEMETRY_PORT
+  void telemetry_init() { }
+  uint8_t telemetry_begin_frame(uint8_t n) { return(true); }
+  void telemetry_write(uint8_t data) { }
+  void telemetry_end_frame() { }
+  uint16_t telemetry_get_drop_count() { return(0); }
+#endif
+
+
+// Arduino core functions used by ports.c. Inputs read high, as the pins idle.
+int digitalRead(uint8_t pin) { return(1); }
+void pinMode(uint8_t pin, uint8_t mode) { }
+void digitalWrite(uint8_t pin, uint8_t value) { }
@@ -0,0 +1,27 @@
+/**
+ *  hal.h - Mocked hardware for the host build
+ *  Registers are plain memory, the EEPROM is a RAM array, and the serial port and busy waits call
+ *  back into the host program. See host/avr/io.h.
+ * */
+
+#ifndef hal_h
+#define hal_h
+
+        #define HAL_EEPROM_SIZE 4096
+
+        // Host program callbacks. The defaults print serial output to stdout, never receive serial
+        // data, and return from busy waits at once. The RX buffer count is only polled by the binary
+        // frame reader. See ENABLE_BINARY_FRAMING in config.h.
+        extern uint8_t (*hal_serial_read)();           // Next received byte, or SERIAL_NO_DATA
+        extern uint8_t (*hal_serial_available)();      // Received bytes waiting to be read
+        extern void (*hal_serial_write)(uint8_t data); // Byte sent by Grbl
+        extern void (*hal_delay)(double us);           // Busy wait of the main program
+
+        void hal_init(); // Idle pin levels and an erased EEPROM. Call before anything else.
+
+        // Interrupt handlers called by the host programs. Named after their vectors by avr/interrupt.h.
+        void TIMER1_COMPA_vect();
+        void TIMER2_OVF_vect();
+        void ADC_vect();
+
+#endif
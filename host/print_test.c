@@ -0,0 +1,248 @@
+/**
+ *  print_test.c - Number formatting of print.c against the original routines
+ *  Checks that print_uint32_base10() prints every uint32 value, and printFloat() a sweep of float
+ *  values at every decimal place count used by the N_DECIMAL_* settings, byte for byte the same as
+ *  the division based routines of Grbl 1.1, copied below. Then times both on the host, and estimates
+ *  the AVR cycles of their digit generation.
+ *
+ *  print_test [-q] skips the full uint32 range and checks every 997th value instead.
+ * */
+
+#include <stdio.h>
+#include <time.h>
+#include <math.h>
+#include "grbl.h"
+#include "hal.h"
+
+#define FLOAT_MAX_DECIMALS 4 // N_DECIMAL_COORDVALUE_INCH, the most of the N_DECIMAL_* settings
+
+// Estimated AVR cycles of the digit generation. The host has fast division, so its times don't
+// carry over. A 32-bit division and modulo is one libgcc __udivmodsi4 call of 32 shift-subtract
+// steps. A power of ten step is a 4-byte pgm_read_dword(), and each compare-subtract a 4-byte
+// compare, subtract, digit increment and branch.
+#define AVR_CYCLES_UDIVMODSI4 600
+#define AVR_CYCLES_POWER_LOAD 16
+#define AVR_CYCLES_SUBTRACT 12
+
+static char output[32];
+static uint8_t output_length;
+static char expected[32];
+static uint8_t expected_length;
+static uint32_t failures;
+
+
+static void test_output(uint8_t data) { output[output_length++] = data; }
+static void expected_output(uint8_t data) { expected[expected_length++] = data; }
+
+// Output of the original routines. Called through a pointer, like serial_write() of hal.c, so the
+// host times compare the formatting alone.
+static void (*expected_sink)(uint8_t data) = expected_output;
+static void __attribute__((noinline)) expected_write(uint8_t data) { expected_sink(data); }
+
+
+// print_uint32_base10() of Grbl 1.1, printing with expected_write().
+static void old_print_uint32_base10(uint32_t n)
+{
+  if (n == 0) {
+    expected_write('0');
+    return;
+  }
+
+  unsigned char buf[10];
+  uint8_t i = 0;
+
+  while (n > 0) {
+    buf[i++] = n % 10;
+    n /= 10;
+  }
+
+  for (; i > 0; i--)
+    expected_write('0' + buf[i-1]);
+}
+
+
+// printFloat() of Grbl 1.1, printing with expected_write().
+static void old_printFloat(float n, uint8_t decimal_places)
+{
+  if (n < 0) {
+    expected_write('-');
+    n = -n;
+  }
+
+  uint8_t decimals = decimal_places;
+  while (decimals >= 2) { // Quickly convert values expected to be E0 to E-4.
+    n *= 100;
+    decimals -= 2;
+  }
+  if (decimals) { n *= 10; }
+  n += 0.5; // Add rounding factor. Ensures carryover through entire value.
+
+  // Generate digits backwards and store in string.
+  unsigned char buf[13];
+  uint8_t i = 0;
+  uint32_t a = (long)n;
+  while(a > 0) {
+    buf[i++] = (a % 10) + '0'; // Get digit
+    a /= 10;
+  }
+  while (i < decimal_places) {
+     buf[i++] = '0'; // Fill in zeros to decimal point for (n < 1)
+  }
+  if (i == decimal_places) { // Fill in leading zero, if needed.
+    buf[i++] = '0';
+  }
+
+  // Print the generated string.
+  for (; i > 0; i--) {
+    if (i == decimal_places) { expected_write('.'); } // Insert decimal point in right place.
+    expected_write(buf[i-1]);
+  }
+}
+
+
+static void compare(const char *value)
+{
+  if ((output_length == expected_length) && !memcmp(output, expected, output_length)) { return; }
+  if (failures++ < 10) {
+    printf("print_test: %s printed \"%.*s\", expected \"%.*s\"\n", value, output_length, output,
+           expected_length, expected);
+  }
+}
+
+
+static void check_uint32(uint32_t n)
+{
+  output_length = expected_length = 0;
+  print_uint32_base10(n);
+  old_print_uint32_base10(n);
+  if ((output_length != expected_length) || memcmp(output, expected, output_length)) {
+    char value[16];
+    sprintf(value, "%u", n);
+    compare(value);
+  }
+}
+
+
+static void check_float(float n, uint8_t decimal_places)
+{
+  output_length = expected_length = 0;
+  printFloat(n, decimal_places);
+  old_printFloat(n, decimal_places);
+  if ((output_length != expected_length) || memcmp(output, expected, output_length)) {
+    char value[48];
+    sprintf(value, "%.9g (%u decimals)", n, decimal_places);
+    compare(value);
+  }
+}
+
+
+// Estimated AVR cycles of the old and the new digit generation of n. See AVR_CYCLES_*.
+static void avr_cycles(uint32_t n, uint64_t *old_cycles, uint64_t *new_cycles)
+{
+  uint32_t a;
+  for (a = n; a > 0; a /= 10) { *old_cycles += AVR_CYCLES_UDIVMODSI4; }
+  uint32_t power = 1000000000;
+  uint8_t idx;
+  for (idx = 0; idx < 9; idx++, power /= 10) {
+    // The digit value is the number of compare-subtracts, and one more compare ends the loop.
+    *new_cycles += AVR_CYCLES_POWER_LOAD + AVR_CYCLES_SUBTRACT*((n/power) % 10 + 1);
+  }
+}
+
+
+static double seconds()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return(now.tv_sec + now.tv_nsec*1e-9);
+}
+
+
+// Floats stepped through by their bit patterns, both signs, from zero up to 1e6. Beyond that, the
+// scaled values of 4 decimals no longer fit the long conversion of printFloat().
+static float float_sweep(uint32_t idx)
+{
+  union { float value; uint32_t bits; } n;
+  n.bits = (idx >> 1)*61;
+  if (idx & 1) { n.value = -n.value; }
+  return(n.value);
+}
+#define FLOAT_SWEEP_COUNT (2*(0x49742400/61)) // 0x49742400 is 1e6.
+
+
+int main(int argc, char *argv[])
+{
+  uint8_t is_quick = (argc > 1) && !strcmp(argv[1], "-q");
+  hal_init();
+  hal_serial_write = test_output;
+
+  // Every uint32, or every 997th and the last one.
+  uint32_t n = 0;
+  uint32_t step = is_quick ? 997 : 1;
+  uint64_t count = 0;
+  do {
+    check_uint32(n);
+    count++;
+    if (n > 0xFFFFFFFF - step) { n = 0xFFFFFFFF; check_uint32(n); count++; break; }
+    n += step;
+  } while (n);
+  printf("print_uint32_base10  %llu values\n", (unsigned long long)count);
+
+  // Float sweep, and the values at each rounding point of each decimal place count.
+  uint8_t decimal_places;
+  uint32_t idx;
+  count = 0;
+  for (decimal_places = 0; decimal_places <= FLOAT_MAX_DECIMALS; decimal_places++) {
+    for (idx = 0; idx < FLOAT_SWEEP_COUNT; idx += (is_quick ? 97 : 1)) {
+      check_float(float_sweep(idx), decimal_places);
+      count++;
+    }
+    float scale = 1.0;
+    uint8_t i;
+    for (i = 0; i < decimal_places; i++) { scale *= 10; }
+    for (idx = 0; idx < 100000; idx++) {
+      float rounding = (idx + 0.5)/scale;
+      check_float(rounding, decimal_places);
+      check_float(nextafterf(rounding, 0.0), decimal_places);
+      check_float(nextafterf(rounding, 1e9), decimal_places);
+      check_float(-rounding, decimal_places);
+      count += 4;
+    }
+  }
+  printf("printFloat           %llu values at 0 to %u decimals\n", (unsigned long long)count, FLOAT_MAX_DECIMALS);
+
+  // Host times of typical report values: positions within +-1000 mm of 3 decimals, and uint32 counters.
+  double start, old_time, new_time;
+  uint32_t repeat = 2000000;
+  uint64_t old_cycles = 0, new_cycles = 0;
+  for (idx = 0; idx < repeat; idx++) {
+    avr_cycles(lroundf(fabsf(0.001f*((int32_t)(idx*7919 % 2000000) - 1000000))*1000), &old_cycles, &new_cycles);
+  }
+  printf("printFloat AVR       %.0f cycles new, %.0f cycles old, estimated digit generation\n",
+         (double)new_cycles/repeat, (double)old_cycles/repeat);
+  old_cycles = new_cycles = 0;
+  for (idx = 0; idx < repeat; idx++) { avr_cycles(idx*2654435761u, &old_cycles, &new_cycles); }
+  printf("print_uint32 AVR     %.0f cycles new, %.0f cycles old, estimated digit generation\n",
+         (double)new_cycles/repeat, (double)old_cycles/repeat);
+  start = seconds();
+  for (idx = 0; idx < repeat; idx++) { output_length = 0; printFloat(0.001f*((int32_t)(idx*7919 % 2000000) - 1000000), 3); }
+  new_time = seconds() - start;
+  start = seconds();
+  for (idx = 0; idx < repeat; idx++) { expected_length = 0; old_printFloat(0.001f*((int32_t)(idx*7919 % 2000000) - 1000000), 3); }
+  old_time = seconds() - start;
+  printf("printFloat host      %.1f ns new, %.1f ns old\n", 1e9*new_time/repeat, 1e9*old_time/repeat);
+  start = seconds();
+  for (idx = 0; idx < repeat; idx++) { output_length = 0; print_uint32_base10(idx*2654435761u); }
+  new_time = seconds() - start;
+  start = seconds();
+  for (idx = 0; idx < repeat; idx++) { expected_length = 0; old_print_uint32_base10(idx*2654435761u); }
+  old_time = seconds() - start;
+  printf("print_uint32 host    %.1f ns new, %.1f ns old\n", 1e9*new_time/repeat, 1e9*old_time/repeat);
+
+  if (failures) {
+    printf("print_test: %u values differ\n", failures);
+    return(1);
+  }
+  printf("print_test: all identical\n");
+  return(0);
+}
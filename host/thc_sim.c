@@ -0,0 +1,172 @@
+/**
+ *  thc_sim.c - Torch height controller against a simulated arc voltage plant
+ *  Runs the unmodified ADC filters and THC controllers of adc.c and thc.c, built against the mocked
+ *  HAL, in simulated time. The THC updates Timer2 requests are run by the main program at once. The arc voltage rises linearly with the torch to plate gap, with noise and
+ *  arc spikes, and is converted by the ADC at its free running rate. The THC Z steps move the torch
+ *  at once. See the stepper wrappers below.
+ *
+ *  The torch starts 1 mm above the cut height, as after a pierce, and the plate then rises 1 mm over
+ *  a second, as on a warped sheet. Reports the settle time and the overshoot of the start, and the
+ *  RMS gap error while following the plate, for the hysteresis band controller ($40=0) and the PID
+ *  controller with the given gains, by default those of defaults.h.
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "grbl.h"
+#include "hal.h"
+
+#define SIM_ADC_PERIOD (13*128/(double)F_CPU) // Free running conversion time (s)
+#define SIM_TICK (TIMER_TICK_US*1e-6)         // Timer2 tick (s)
+#define SIM_SET_COUNTS 400                    // Arc voltage set point (ADC counts)
+#define SIM_COUNTS_PER_MM 30.0                // Arc voltage rise with the gap (ADC counts per mm)
+#define SIM_CUT_HEIGHT 1.5                    // Gap at the set point (mm)
+#define SIM_SETTLE_BAND 0.1                   // Gap error counted as settled (mm)
+#define SIM_RAMP_START 1.5                    // Plate rise (s)
+#define SIM_RAMP_TIME 1.0
+#define SIM_RAMP_HEIGHT 1.0                   // (mm)
+#define SIM_DURATION 4.0                      // (s)
+
+// Torch Z in steps above the cut height at a flat plate
+static int32_t torch_steps;
+
+static float noise = 2.0;         // Arc voltage noise deviation (ADC counts)
+static float spike_rate = 5.0;    // Arc voltage spikes per second
+static float spike_size = 80.0;   // (ADC counts)
+
+
+// The THC steps move the torch at once. The stepper ISR outputs them within a tick.
+void __wrap_st_thc_request_z_step(bool up) { torch_steps += up ? 1 : -1; }
+
+
+// Never a corner slowdown.
+uint8_t __wrap_st_get_thc_flags() { return(0); }
+
+
+static void sim_output(uint8_t data) { }
+
+
+static double gaussian()
+{
+  double u = (rand() + 1.0)/(RAND_MAX + 2.0);
+  double v = (rand() + 1.0)/(RAND_MAX + 2.0);
+  return(sqrt(-2.0*log(u))*cos(2*M_PI*v));
+}
+
+
+static double plate_height(double t)
+{
+  if (t < SIM_RAMP_START) { return(0.0); }
+  if (t < SIM_RAMP_START + SIM_RAMP_TIME) { return(SIM_RAMP_HEIGHT*(t - SIM_RAMP_START)/SIM_RAMP_TIME); }
+  return(SIM_RAMP_HEIGHT);
+}
+
+
+// Runs one cut with the current settings and prints its results.
+static void sim_run(const char *name)
+{
+  srand(1);
+  torch_steps = lround(1.0*settings.steps_per_mm[Z_AXIS]);
+  thcWorking = false;
+  thc_update(); // Resets the controller.
+  thcWorking = true;
+  sys.state = STATE_CYCLE; // Timer2 only queues THC steps in a cycle.
+  analogSetVal = SIM_SET_COUNTS;
+
+  double t = 0.0;
+  double adc_time = 0.0;
+  double settle_time = -1.0;
+  double overshoot = 0.0;
+  double error_sum = 0.0;
+  uint32_t error_count = 0;
+  while (t < SIM_DURATION) {
+    double gap_error = torch_steps/settings.steps_per_mm[Z_AXIS] - plate_height(t);
+
+    // ADC conversions of this tick. Spikes last a single conversion.
+    while (adc_time < t + SIM_TICK) {
+      double counts = SIM_SET_COUNTS + SIM_COUNTS_PER_MM*gap_error + noise*gaussian();
+      if (rand() < RAND_MAX*(spike_rate*SIM_ADC_PERIOD)) { counts += spike_size; }
+      uint16_t sample = (counts < 0.0) ? 0 : ((counts > 1023.0) ? 1023 : lround(counts));
+      ADCL = sample & 0xFF;
+      ADCH = sample >> 8;
+      ADC_vect();
+      adc_time += SIM_ADC_PERIOD;
+    }
+
+    // Timer2 tick, and the THC update it requests from the main program right away.
+    TIMER2_OVF_vect();
+    protocol_exec_rt_system();
+
+    if (t < SIM_RAMP_START) {
+      if (fabs(gap_error) > SIM_SETTLE_BAND) { settle_time = -1.0; }
+      else if (settle_time < 0.0) { settle_time = t; }
+      if (-gap_error > overshoot) { overshoot = -gap_error; }
+    } else {
+      error_sum += gap_error*gap_error;
+      error_count++;
+    }
+    t += SIM_TICK;
+  }
+
+  printf("%-10s ", name);
+  if (settle_time < 0.0) { printf("  not settled"); }
+  else { printf("%8.0f ms  ", settle_time*1000); }
+  printf("%8.3f mm  %8.3f mm\n", overshoot, sqrt(error_sum/error_count));
+}
+
+
+static void usage()
+{
+  fprintf(stderr, "usage: thc_sim [-p kp] [-i ki] [-d kd] [-v velocity] [-a acceleration] [-f filter] [-n noise] [-s spikes/s]\n"
+                  "  kp, ki and kd as $40-$42, velocity and acceleration as $43-$44, filter as $45. noise is the\n"
+                  "  deviation in ADC counts.\n");
+  exit(1);
+}
+
+
+int main(int argc, char *argv[])
+{
+  float kp = DEFAULT_THC_KP, ki = DEFAULT_THC_KI, kd = DEFAULT_THC_KD;
+  float velocity = DEFAULT_THC_MAX_VELOCITY, acceleration = DEFAULT_THC_ACCELERATION;
+  int8_t filter = -1;
+  int idx;
+  for (idx=1; idx<argc; idx++) {
+    if (idx+1 == argc) { usage(); }
+    char *value = argv[++idx];
+    if (!strcmp(argv[idx-1], "-p")) { kp = atof(value); }
+    else if (!strcmp(argv[idx-1], "-i")) { ki = atof(value); }
+    else if (!strcmp(argv[idx-1], "-d")) { kd = atof(value); }
+    else if (!strcmp(argv[idx-1], "-v")) { velocity = atof(value); }
+    else if (!strcmp(argv[idx-1], "-a")) { acceleration = atof(value); }
+    else if (!strcmp(argv[idx-1], "-f")) { filter = atoi(value); }
+    else if (!strcmp(argv[idx-1], "-n")) { noise = atof(value); }
+    else if (!strcmp(argv[idx-1], "-s")) { spike_rate = atof(value); }
+    else { usage(); }
+  }
+
+  hal_init();
+  hal_serial_write = sim_output;
+  settings_init();
+  adc_setup();
+  thc_initialize();
+  if (filter >= 0) { settings_store_global_setting(45, filter); }
+  settings_store_global_setting(43, velocity);
+  settings_store_global_setting(44, acceleration);
+
+  printf("Gap %.1f mm at %d counts, %.0f counts/mm, noise %.1f counts, %.0f spikes/s of %.0f counts, filter $45=%u\n",
+         SIM_CUT_HEIGHT, SIM_SET_COUNTS, SIM_COUNTS_PER_MM, noise, spike_rate, spike_size, settings.adc_filter);
+  printf("THC %.0f mm/min, %.0f mm/s^2, Z %.0f steps/mm\n", min(settings.thc_max_velocity, settings.max_rate[Z_AXIS]),
+         min(settings.thc_acceleration, settings.acceleration[Z_AXIS]/3600), settings.steps_per_mm[Z_AXIS]);
+  printf("controller settle (%.1f mm)  overshoot  RMS error (plate rise)\n", SIM_SETTLE_BAND);
+
+  settings_store_global_setting(40, 0.0);
+  sim_run("band");
+  settings_store_global_setting(40, kp);
+  settings_store_global_setting(41, ki);
+  settings_store_global_setting(42, kd);
+  sim_run("PID");
+  printf("PID gains $40=%g $41=%g $42=%g\n", kp, ki, kd);
+  return(0);
+}
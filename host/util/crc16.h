@@ -0,0 +1,17 @@
+/**
+ *  util/crc16.h - CRC-CCITT for the host build. Same result as the avr-libc routine.
+ * */
+
+#ifndef host_util_crc16_h
+#define host_util_crc16_h
+
+#include <stdint.h>
+
+static inline uint16_t _crc_ccitt_update(uint16_t crc, uint8_t data)
+{
+  data ^= (uint8_t)crc;
+  data ^= data << 4;
+  return((((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4) ^ ((uint16_t)data << 3));
+}
+
+#endif
@@ -0,0 +1,12 @@
+/**
+ *  util/delay.h - Busy waits for the host build
+ *  Implemented in hal.c, which passes the time to the host program instead of waiting.
+ * */
+
+#ifndef host_util_delay_h
+#define host_util_delay_h
+
+void _delay_us(double us);
+void _delay_ms(double ms);
+
+#endif
@@ -33,6 +33,20 @@ volatile uint8_t sys_rt_exec_motion_override; // Global realtime executor bitfla
 volatile uint8_t sys_rt_exec_accessory_override; // Global realtime executor bitflag variable for spindle/coolant overrides.
 #ifdef DEBUG
   volatile uint8_t sys_rt_exec_debug;
+  uint16_t sys_debug_line_latency;
+  uint16_t sys_debug_line_latency_max;
+  uint32_t sys_debug_plan_count;
+  uint32_t sys_debug_plan_ticks;
+  uint32_t sys_debug_segment_count;
+  uint32_t sys_debug_prep_ticks;
+  volatile uint16_t sys_debug_starve_count;
+  uint32_t sys_debug_replan_blocks;
+  uint16_t sys_debug_replan_max;
+  volatile uint16_t sys_debug_step_isr_max;
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    float sys_debug_scurve_accel_max;
+    float sys_debug_scurve_jerk_max;
+  #endif
 #endif
 
 
@@ -54,7 +68,14 @@ int main(void)
 
   // Initialize system upon power-up.
   serial_init();   // Setup serial baud rate and interrupts
+  #ifdef ENABLE_TELEMETRY_PORT
+    telemetry_init();
+  #endif
   settings_init(); // Load Grbl settings from EEPROM
+  if ((settings.baud_rate != BAUD_RATE) && serial_check_baud_rate(settings.baud_rate)) {
+    serial_set_baud_rate(settings.baud_rate); // Switch to baud rate confirmed by `$B=` handshake.
+  }
+  timer_set_report_interval(settings.status_report_interval);
   stepper_init();  // Configure stepper pins and interrupt timers
   system_init();   // Configure pinout pins and pin-change interrupt
 
@@ -100,6 +121,9 @@ int main(void)
 
     // Reset Grbl primary systems.
     serial_reset_read_buffer(); // Clear serial read buffer
+    #ifdef ENABLE_SD_CARD
+      sd_job_stop(); // A reset ends any SD card job.
+    #endif
     gc_init(); // Set g-code parser to default state
     spindle_init();
     coolant_init();
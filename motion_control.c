@@ -39,7 +39,12 @@ void mc_line(float *target, plan_line_data_t *pl_data)
   }
 
   // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
-  if (sys.state == STATE_CHECK_MODE) { return; }
+  if (sys.state == STATE_CHECK_MODE) {
+    #ifdef ENABLE_RUN_TIME_ESTIMATOR
+      estimator_buffer_line(target, pl_data); // Planned and timed only. Never executed.
+    #endif
+    return;
+  }
 
   // NOTE: Backlash compensation may be installed here. It will need direction info to track when
   // to insert a backlash line motion(s) before the intended line motion and will require its own
@@ -65,7 +70,15 @@ void mc_line(float *target, plan_line_data_t *pl_data)
   } while (1);
 
   // Plan and queue motion into planner buffer
-  if (plan_buffer_line(target, pl_data) == PLAN_EMPTY_BLOCK) {
+  #ifdef DEBUG
+    uint16_t plan_ticks = timer_get_ticks();
+    uint8_t plan_status = plan_buffer_line(target, pl_data);
+    sys_debug_plan_ticks += (uint16_t)(timer_get_ticks()-plan_ticks);
+    sys_debug_plan_count++;
+  #else
+    uint8_t plan_status = plan_buffer_line(target, pl_data);
+  #endif
+  if (plan_status == PLAN_EMPTY_BLOCK) {
     if (bit_istrue(settings.flags,BITFLAG_LASER_MODE)) {
       // Correctly set spindle state, if there is a coincident position passed. Forces a buffer
       // sync while in M3 laser mode only.
@@ -77,6 +90,54 @@ void mc_line(float *target, plan_line_data_t *pl_data)
 }
 
 
+#ifdef ENABLE_PLANNER_ARCS
+// Queues the arc as a single planner arc block. Soft limits are checked at the arc end and at the
+// arc extremes in the plane, where the arc crosses the plane axes directions through its center.
+static void mc_buffer_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+  float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear)
+{
+  if (bit_istrue(settings.flags,BITFLAG_SOFT_LIMIT_ENABLE)) {
+    float extreme[N_AXIS];
+    memcpy(extreme, target, sizeof(extreme));
+    float start_angle = atan2(-offset[axis_1], -offset[axis_0]);
+    uint8_t quadrant;
+    for (quadrant=0; quadrant<4; quadrant++) {
+      // Arc angle from the start to the extreme in the direction of travel.
+      float travel = quadrant*(0.5*M_PI) - start_angle;
+      if (angular_travel > 0.0) { while (travel < 0.0) { travel += 2*M_PI; } }
+      else { while (travel > 0.0) { travel -= 2*M_PI; } }
+      if (fabs(travel) < fabs(angular_travel)) {
+        extreme[axis_0] = position[axis_0] + offset[axis_0];
+        extreme[axis_1] = position[axis_1] + offset[axis_1];
+        if (quadrant & 0x01) { extreme[axis_1] += (quadrant == 1) ? radius : -radius; }
+        else { extreme[axis_0] += (quadrant == 0) ? radius : -radius; }
+        limits_soft_check(extreme);
+      }
+    }
+    limits_soft_check(target);
+  }
+
+  // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
+  if (sys.state == STATE_CHECK_MODE) {
+    #ifdef ENABLE_RUN_TIME_ESTIMATOR
+      estimator_buffer_arc(target, pl_data, position, offset, radius, angular_travel, axis_0, axis_1, axis_linear);
+    #endif
+    return;
+  }
+
+  // Remain in this loop until there is room in both the block and the arc buffers.
+  do {
+    protocol_execute_realtime(); // Check for any run-time commands
+    if (sys.abort) { return; } // Bail, if system abort.
+    if ( plan_check_full_buffer() || plan_check_full_arc_buffer() ) { protocol_auto_cycle_start(); } // Auto-cycle start when buffer is full.
+    else { break; }
+  } while (1);
+
+  plan_buffer_arc(target, pl_data, position, offset, radius, angular_travel, axis_0, axis_1, axis_linear);
+}
+#endif
+
+
 // Execute an arc in offset mode format. position == current xyz, target == target xyz,
 // offset == offset from current xyz, axis_X defines circle plane in tool space, axis_linear is
 // the direction of helical travel, radius == circle radius, isclockwise boolean. Used
@@ -109,6 +170,14 @@ void mc_arc(float *target, plan_line_data_t *pl_data, float *position, float *of
   uint16_t segments = floor(fabs(0.5*angular_travel*radius)/
                           sqrt(settings.arc_tolerance*(2*radius - settings.arc_tolerance)) );
 
+  #ifdef ENABLE_PLANNER_ARCS
+    // Arcs that need more than one segment are queued as a single planner arc block.
+    if (segments > 1) {
+      mc_buffer_arc(target, pl_data, position, offset, radius, angular_travel, axis_0, axis_1, axis_linear);
+      return;
+    }
+  #endif
+
   if (segments) {
     // Multiply inverse feed_rate to compensate for the fact that this movement is approximated
     // by a number of discrete segments. The inverse feed_rate should be correct for the sum of
@@ -194,7 +263,12 @@ void mc_arc(float *target, plan_line_data_t *pl_data, float *position, float *of
 // Execute dwell in seconds.
 void mc_dwell(float seconds)
 {
-  if (sys.state == STATE_CHECK_MODE) { return; }
+  if (sys.state == STATE_CHECK_MODE) {
+    #ifdef ENABLE_RUN_TIME_ESTIMATOR
+      estimator_dwell(seconds);
+    #endif
+    return;
+  }
   protocol_buffer_synchronize();
   delay_sec(seconds, DELAY_MODE_DWELL);
 }
@@ -256,7 +330,12 @@ void mc_homing_cycle(uint8_t cycle_mask)
 uint8_t mc_probe_cycle(float *target, plan_line_data_t *pl_data, uint8_t parser_flags)
 {
   // TODO: Need to update this cycle so it obeys a non-auto cycle start.
-  if (sys.state == STATE_CHECK_MODE) { return(GC_PROBE_CHECK_MODE); }
+  if (sys.state == STATE_CHECK_MODE) {
+    #ifdef ENABLE_RUN_TIME_ESTIMATOR
+      estimator_sync();
+    #endif
+    return(GC_PROBE_CHECK_MODE);
+  }
 
   // Finish all queued commands and empty planner buffer before starting probe cycle.
   protocol_buffer_synchronize();
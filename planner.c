@@ -29,6 +29,12 @@ static uint8_t block_buffer_head;     // Index of the next block to be pushed
 static uint8_t next_buffer_head;      // Index of the next buffer head
 static uint8_t block_buffer_planned;  // Index of the optimally planned block
 
+#ifdef ENABLE_PLANNER_ARCS
+  static plan_arc_t arc_buffer[PLAN_ARC_BUFFER_SIZE]; // A ring buffer for the arc block geometry
+  static uint8_t arc_buffer_tail;     // Index of the arc of the first arc block in the block buffer
+  static uint8_t arc_buffer_head;     // Index of the next arc to be pushed
+#endif
+
 // Define planner variables
 typedef struct {
   int32_t position[N_AXIS];          // The planner position of the tool in absolute steps. Kept separate
@@ -36,6 +42,14 @@ typedef struct {
                                      // i.e. arcs, canned cycles, and backlash compensation.
   float previous_unit_vec[N_AXIS];   // Unit vector of previous path line segment
   float previous_nominal_speed;  // Nominal speed of previous path line segment
+  uint8_t previous_condition;    // Run conditions of previous path line segment
+  #ifdef ENABLE_SEGMENT_MERGING
+    int32_t merge_start_steps[N_AXIS]; // Start of the last queued block in absolute steps
+    float merge_start_mm[N_AXIS];      // Start of the last queued block in machine position (mm)
+    float previous_target_mm[N_AXIS];  // Target of the previous line in machine position (mm)
+    float merge_deviation;             // Accumulated path deviation of the last queued block (mm)
+    uint32_t merge_count;              // Number of lines merged into queued blocks since reset
+  #endif
 } planner_t;
 static planner_t pl;
 
@@ -98,6 +112,13 @@ static uint8_t plan_prev_block_index(uint8_t block_index)
   used feed holds or feedrate overrides, the stop-compute pointers will be reset and the entire plan is
   recomputed as stated in the general guidelines.
 
+  When streaming, the reverse pass also stops at the first block whose entry speed does not change, and
+  the forward pass resumes from there. For a run of blocks capped at their junction speeds, this makes
+  each insert touch only the last couple of blocks. The worst case, a decelerating plan that must be
+  raised all the way back to the planned pointer, is still one pass over the buffer each way, so an
+  insert never touches more than 2*(BLOCK_BUFFER_SIZE-1) blocks. The DEBUG report RPL field shows the
+  blocks touched in total and by the worst single insert.
+
   Planner buffer index mapping:
   - block_buffer_tail: Points to the beginning of the planner buffer. First to be executed or being executed.
   - block_buffer_head: Points to the buffer block after the last block in the buffer. Used to indicate whether
@@ -123,7 +144,117 @@ static uint8_t plan_prev_block_index(uint8_t block_index)
   ARM versions should have enough memory and speed for look-ahead blocks numbering up to a hundred or more.
 
 */
-static void planner_recalculate()
+#ifdef ENABLE_FIXED_POINT_PLANNER
+// Converts a squared speed to the fixed-point planner representation. Truncates and saturates.
+plan_speed_sqr_t plan_speed_sqr_from_float(float speed_sqr)
+{
+  if (speed_sqr >= (float)PLAN_SPEED_SQR_MAX) { return(PLAN_SPEED_SQR_MAX); }
+  return((plan_speed_sqr_t)speed_sqr);
+}
+#endif
+
+
+#ifndef ENABLE_S_CURVE_ACCELERATION
+// Returns the squared speed change over the remaining block distance at the block acceleration.
+// NOTE: With the fixed-point planner, this is precomputed for queued blocks. Only the executing block
+// is recomputed, since the stepper module shortens its distance as it runs.
+static plan_speed_sqr_t plan_compute_delta_speed_sqr(plan_block_t *block)
+{
+  #ifdef ENABLE_FIXED_POINT_PLANNER
+    if (block != &block_buffer[block_buffer_tail]) { return(block->delta_speed_sqr); }
+    return(plan_speed_sqr_from_float(2*block->acceleration*block->millimeters));
+  #else
+    return(2*block->acceleration*block->millimeters);
+  #endif
+}
+#endif
+
+
+#ifdef ENABLE_S_CURVE_ACCELERATION
+/* Jerk-limited ramps. The acceleration rises at the block jerk to at most the block acceleration,
+   holds, and falls back to zero at the same jerk. A ramp of speed change dv takes
+     T = dv/accel + accel/jerk,  if dv >= accel^2/jerk (peak at the block acceleration)
+     T = 2*sqrt(dv/jerk),        otherwise (triangular acceleration below the block acceleration)
+   and, being symmetric, runs at the mean of its start and end speeds. Every ramp is longer than
+   the constant acceleration ramp between the same speeds, most of all for small speed changes.
+*/
+float plan_scurve_ramp_time(plan_block_t *block, float speed_a, float speed_b)
+{
+  float delta_speed = fabs(speed_b-speed_a);
+  if (delta_speed*block->jerk >= block->acceleration*block->acceleration) {
+    return(delta_speed/block->acceleration + block->acceleration/block->jerk);
+  }
+  return(2.0*sqrt(delta_speed/block->jerk));
+}
+
+
+float plan_scurve_ramp_distance(plan_block_t *block, float speed_a, float speed_b)
+{
+  return(0.5*(speed_a+speed_b)*plan_scurve_ramp_time(block, speed_a, speed_b));
+}
+
+
+// Returns the highest speed a jerk-limited ramp reaches from speed, or decelerates down to speed
+// from, over distance. With k = accel^2/jerk, ramps longer than k solve to the closed form
+// (v+k/2)^2 = (speed-k/2)^2 + 2*accel*distance. Shorter ramps solve the cubic s^3 + 2*speed*s =
+// distance*sqrt(jerk) for s = sqrt(v-speed), by Newton iterations from above.
+static float plan_scurve_ramp_speed(plan_block_t *block, float speed, float distance)
+{
+  float accel_speed = block->acceleration*block->acceleration/block->jerk; // k
+  if (distance*block->jerk >= (2*speed+accel_speed)*block->acceleration) {
+    float shifted_speed = speed-0.5*accel_speed;
+    return(sqrt(shifted_speed*shifted_speed + 2*block->acceleration*distance) - 0.5*accel_speed);
+  }
+  float p = 2*speed;
+  float q = distance*sqrt(block->jerk);
+  if (q <= 0.0) { return(speed); }
+  float s = cbrt(q); // Root with speed zero. Above the root, as is q/p.
+  if (p*s > q) { s = q/p; }
+  uint8_t idx;
+  for (idx=0; idx<3; idx++) { s -= (s*s*s + p*s - q)/(3*s*s + p); }
+  return(speed + s*s);
+}
+
+
+// Returns the peak speed of a block profile with jerk-limited ramps from entry_speed and down to
+// exit_speed, limited to nominal_speed. Found by bisection, since the ramp distances have no common
+// inverse. Returns the higher of the entry and exit speeds, if the block has no room to go above it.
+float plan_scurve_peak_speed(plan_block_t *block, float entry_speed, float exit_speed, float nominal_speed)
+{
+  float low = max(entry_speed, exit_speed);
+  float high = nominal_speed;
+  uint8_t idx;
+  for (idx=0; idx<PLAN_SCURVE_PEAK_ITERATIONS; idx++) {
+    float speed = 0.5*(low+high);
+    if (plan_scurve_ramp_distance(block, entry_speed, speed) + plan_scurve_ramp_distance(block, exit_speed, speed) > block->millimeters) {
+      high = speed;
+    } else {
+      low = speed;
+    }
+  }
+  return(low);
+}
+#endif
+
+
+// Returns the highest squared speed reachable over the remaining block distance, accelerating from
+// speed_sqr, or decelerating down to it. Constant acceleration ramps add the squared speed change of
+// the block. Jerk-limited ramps are longer and gain less.
+static plan_speed_sqr_t plan_compute_ramp_speed_sqr(plan_block_t *block, plan_speed_sqr_t speed_sqr)
+{
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    float speed = plan_scurve_ramp_speed(block, sqrt(plan_speed_sqr_to_float(speed_sqr)), block->millimeters);
+    return(plan_speed_sqr_from_float(speed*speed));
+  #else
+    return(speed_sqr + plan_compute_delta_speed_sqr(block));
+  #endif
+}
+
+
+// Recomputes the buffer plan after a block is added or the plan conditions change. With full_replan
+// false, the passes stop as soon as entry speeds stop changing. Only valid when streaming new blocks,
+// since everything before the stop point is then known to be unchanged since the last call.
+static void planner_recalculate(uint8_t full_replan)
 {
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = plan_prev_block_index(block_buffer_head);
@@ -134,12 +265,20 @@ static void planner_recalculate()
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
   // NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
-  float entry_speed_sqr;
+  plan_speed_sqr_t entry_speed_sqr;
   plan_block_t *next;
   plan_block_t *current = &block_buffer[block_index];
 
   // Calculate maximum entry speed for last block in buffer, where the exit speed is always zero.
-  current->entry_speed_sqr = min( current->max_entry_speed_sqr, 2*current->acceleration*current->millimeters);
+  current->entry_speed_sqr = min( current->max_entry_speed_sqr, plan_compute_ramp_speed_sqr(current, 0));
+  #ifdef DEBUG
+    uint16_t blocks_touched = 1;
+  #endif
+
+  // Index of the block the forward pass starts from. Normally the planned pointer, but moved up when
+  // the reverse pass stops early, since nothing at or before an unchanged block needs replanning.
+  uint8_t forward_index = block_buffer_planned;
+  uint8_t reverse_blocks = 1;
 
   block_index = plan_prev_block_index(block_index);
   if (block_index == block_buffer_planned) { // Only two plannable blocks in buffer. Reverse pass complete.
@@ -149,36 +288,58 @@ static void planner_recalculate()
     while (block_index != block_buffer_planned) {
       next = current;
       current = &block_buffer[block_index];
-      block_index = plan_prev_block_index(block_index);
-
-      // Check if next block is the tail block(=planned block). If so, update current stepper parameters.
-      if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); }
 
       // Compute maximum entry speed decelerating over the current block from its exit speed.
-      if (current->entry_speed_sqr != current->max_entry_speed_sqr) {
-        entry_speed_sqr = next->entry_speed_sqr + 2*current->acceleration*current->millimeters;
-        if (entry_speed_sqr < current->max_entry_speed_sqr) {
-          current->entry_speed_sqr = entry_speed_sqr;
-        } else {
-          current->entry_speed_sqr = current->max_entry_speed_sqr;
-        }
+      entry_speed_sqr = plan_compute_ramp_speed_sqr(current, next->entry_speed_sqr);
+      if (entry_speed_sqr > current->max_entry_speed_sqr) { entry_speed_sqr = current->max_entry_speed_sqr; }
+
+      // Stop when the entry speed no longer changes. Every block between the planned pointer and here
+      // still holds its value from the last reverse pass, which depends only on this entry speed and
+      // the block's own constants, so walking further back would rewrite the same values. This keeps
+      // streaming runs of equal-speed blocks, capped at their junction speeds, at a constant cost.
+      // NOTE: Compares the stored and recomputed values exactly, which is valid for both the float
+      // and fixed-point planner, since the same inputs always produce the same result.
+      if (!full_replan && (entry_speed_sqr == current->entry_speed_sqr)) {
+        forward_index = block_index;
+        break;
       }
+
+      // Stop after PLANNER_REPLAN_MAX_BLOCKS blocks, so that the work per insert doesn't grow with the
+      // buffer size. The blocks before keep their entry speeds from earlier passes, which were planned
+      // to lower or equal exit speeds, so they can still decelerate to the raised ones and stay safe.
+      // They only miss the speed the blocks beyond the cap would have allowed.
+      if (!full_replan && (reverse_blocks == PLANNER_REPLAN_MAX_BLOCKS)) {
+        forward_index = block_index;
+        break;
+      }
+      reverse_blocks++;
+      current->entry_speed_sqr = entry_speed_sqr;
+      #ifdef DEBUG
+        blocks_touched++;
+      #endif
+
+      // Check if next block is the tail block(=planned block). If so, update current stepper parameters.
+      block_index = plan_prev_block_index(block_index);
+      if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); }
     }
   }
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
-  next = &block_buffer[block_buffer_planned]; // Begin at buffer planned pointer
-  block_index = plan_next_block_index(block_buffer_planned);
+  next = &block_buffer[forward_index]; // Begin at buffer planned pointer or reverse pass stop block
+  block_index = plan_next_block_index(forward_index);
   while (block_index != block_buffer_head) {
     current = next;
     next = &block_buffer[block_index];
+    #ifdef DEBUG
+      blocks_touched++;
+    #endif
 
     // Any acceleration detected in the forward pass automatically moves the optimal planned
     // pointer forward, since everything before this is all optimal. In other words, nothing
     // can improve the plan from the buffer tail to the planned pointer by logic.
     if (current->entry_speed_sqr < next->entry_speed_sqr) {
-      entry_speed_sqr = current->entry_speed_sqr + 2*current->acceleration*current->millimeters;
+      entry_speed_sqr = plan_compute_ramp_speed_sqr(current, current->entry_speed_sqr);
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (entry_speed_sqr < next->entry_speed_sqr) {
         next->entry_speed_sqr = entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
@@ -193,6 +354,11 @@ static void planner_recalculate()
     if (next->entry_speed_sqr == next->max_entry_speed_sqr) { block_buffer_planned = block_index; }
     block_index = plan_next_block_index( block_index );
   }
+
+  #ifdef DEBUG
+    sys_debug_replan_blocks += blocks_touched;
+    if (blocks_touched > sys_debug_replan_max) { sys_debug_replan_max = blocks_touched; }
+  #endif
 }
 
 
@@ -209,6 +375,10 @@ void plan_reset_buffer()
   block_buffer_head = 0; // Empty = tail
   next_buffer_head = 1; // plan_next_block_index(block_buffer_head)
   block_buffer_planned = 0; // = block_buffer_tail;
+  #ifdef ENABLE_PLANNER_ARCS
+    arc_buffer_tail = 0;
+    arc_buffer_head = 0;
+  #endif
 }
 
 
@@ -218,6 +388,11 @@ void plan_discard_current_block()
     uint8_t block_index = plan_next_block_index( block_buffer_tail );
     // Push block_buffer_planned pointer, if encountered.
     if (block_buffer_tail == block_buffer_planned) { block_buffer_planned = block_index; }
+    #ifdef ENABLE_PLANNER_ARCS
+      if (block_buffer[block_buffer_tail].is_arc) {
+        if (++arc_buffer_tail == PLAN_ARC_BUFFER_SIZE) { arc_buffer_tail = 0; }
+      }
+    #endif
     block_buffer_tail = block_index;
   }
 }
@@ -242,7 +417,7 @@ float plan_get_exec_block_exit_speed_sqr()
 {
   uint8_t block_index = plan_next_block_index(block_buffer_tail);
   if (block_index == block_buffer_head) { return( 0.0 ); }
-  return( block_buffer[block_index].entry_speed_sqr );
+  return( plan_speed_sqr_to_float(block_buffer[block_index].entry_speed_sqr) );
 }
 
 
@@ -254,6 +429,24 @@ uint8_t plan_check_full_buffer()
 }
 
 
+#ifdef ENABLE_PLANNER_ARCS
+// Returns the availability status of the arc ring buffer. True, if full.
+uint8_t plan_check_full_arc_buffer()
+{
+  uint8_t next_arc_head = arc_buffer_head+1;
+  if (next_arc_head == PLAN_ARC_BUFFER_SIZE) { next_arc_head = 0; }
+  if (arc_buffer_tail == next_arc_head) { return(true); }
+  return(false);
+}
+
+
+plan_arc_t *plan_get_current_arc()
+{
+  return(&arc_buffer[arc_buffer_tail]);
+}
+#endif
+
+
 // Computes and returns block nominal speed based on running condition and override values.
 // NOTE: All system motion commands, such as homing/parking, are not subject to overrides.
 float plan_compute_profile_nominal_speed(plan_block_t *block)
@@ -274,8 +467,8 @@ float plan_compute_profile_nominal_speed(plan_block_t *block)
 static void plan_compute_profile_parameters(plan_block_t *block, float nominal_speed, float prev_nominal_speed)
 {
   // Compute the junction maximum entry based on the minimum of the junction speed and neighboring nominal speeds.
-  if (nominal_speed > prev_nominal_speed) { block->max_entry_speed_sqr = prev_nominal_speed*prev_nominal_speed; }
-  else { block->max_entry_speed_sqr = nominal_speed*nominal_speed; }
+  if (nominal_speed > prev_nominal_speed) { block->max_entry_speed_sqr = plan_speed_sqr_from_float(prev_nominal_speed*prev_nominal_speed); }
+  else { block->max_entry_speed_sqr = plan_speed_sqr_from_float(nominal_speed*nominal_speed); }
   if (block->max_entry_speed_sqr > block->max_junction_speed_sqr) { block->max_entry_speed_sqr = block->max_junction_speed_sqr; }
 }
 
@@ -298,6 +491,258 @@ void plan_update_velocity_profile_parameters()
 }
 
 
+// Computes the step counts, direction bits, and the unit vector numerator of the block line
+// from position_steps to target_steps. Returns the step event count of the line.
+static uint32_t planner_compute_line_steps(plan_block_t *block, int32_t *position_steps, int32_t *target_steps, float *unit_vec)
+{
+  uint32_t step_event_count = 0;
+  float delta_mm;
+  uint8_t idx;
+
+  block->direction_bits = 0;
+
+  #ifdef COREXY
+    block->steps[A_MOTOR] = labs((target_steps[X_AXIS]-position_steps[X_AXIS]) + (target_steps[Y_AXIS]-position_steps[Y_AXIS]));
+    block->steps[B_MOTOR] = labs((target_steps[X_AXIS]-position_steps[X_AXIS]) - (target_steps[Y_AXIS]-position_steps[Y_AXIS]));
+  #endif
+
+  for (idx=0; idx<N_AXIS; idx++) {
+    // Calculate number of steps for each axis, and determine max step events.
+    // Also, compute individual axes distance for move and prep unit vector calculations.
+    // NOTE: Computes true distance from converted step values.
+    #ifdef COREXY
+      if ( !(idx == A_MOTOR) && !(idx == B_MOTOR) ) {
+        block->steps[idx] = labs(target_steps[idx]-position_steps[idx]);
+      }
+      step_event_count = max(step_event_count, block->steps[idx]);
+      if (idx == A_MOTOR) {
+        delta_mm = (target_steps[X_AXIS]-position_steps[X_AXIS] + target_steps[Y_AXIS]-position_steps[Y_AXIS])*settings_derived.mm_per_step[idx];
+      } else if (idx == B_MOTOR) {
+        delta_mm = (target_steps[X_AXIS]-position_steps[X_AXIS] - target_steps[Y_AXIS]+position_steps[Y_AXIS])*settings_derived.mm_per_step[idx];
+      } else {
+        delta_mm = (target_steps[idx] - position_steps[idx])*settings_derived.mm_per_step[idx];
+      }
+    #else
+      block->steps[idx] = labs(target_steps[idx]-position_steps[idx]);
+      step_event_count = max(step_event_count, block->steps[idx]);
+      delta_mm = (target_steps[idx] - position_steps[idx])*settings_derived.mm_per_step[idx];
+	  #endif
+    unit_vec[idx] = delta_mm; // Store unit vector numerator
+
+    // Set direction bits. Bit enabled always means direction is negative.
+    #ifdef DEFAULTS_RAMPS_BOARD
+      if (delta_mm < 0.0 ) { block->direction_bits |= bit(idx); }
+    #else
+      if (delta_mm < 0.0 ) { block->direction_bits |= get_direction_pin_mask(idx); }
+    #endif // DEFAULTS_RAMPS_BOARD
+  }
+  return(step_event_count);
+}
+
+
+// Converts the unit vector numerator to the unit vector and computes the block distance, the
+// axis-limited acceleration and rates, and the programmed rate.
+static void planner_compute_line_limits(plan_block_t *block, float *unit_vec, float feed_rate)
+{
+  block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
+  block->acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    block->jerk = limit_value_by_axis_maximum(settings.jerk, unit_vec);
+  #endif
+  block->rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+  #ifdef ENABLE_FIXED_POINT_PLANNER
+    block->delta_speed_sqr = plan_speed_sqr_from_float(2*block->acceleration*block->millimeters);
+  #endif
+
+  // Store programmed rate.
+  if (block->condition & PL_COND_FLAG_RAPID_MOTION) { block->programmed_rate = block->rapid_rate; }
+  else { 
+    block->programmed_rate = feed_rate;
+    if (block->condition & PL_COND_FLAG_INVERSE_TIME) { block->programmed_rate *= block->millimeters; }
+  }
+}
+
+
+// Computes the maximum junction entry speed of the block from the previous path direction and the
+// block entry direction unit_vec.
+static void planner_compute_junction_speed(plan_block_t *block, float *unit_vec)
+{
+  // Compute maximum allowable entry speed at junction by centripetal acceleration approximation.
+  // Let a circle be tangent to both previous and current path line segments, where the junction
+  // deviation is defined as the distance from the junction to the closest edge of the circle,
+  // colinear with the circle center. The circular segment joining the two paths represents the
+  // path of centripetal acceleration. Solve for max velocity based on max acceleration about the
+  // radius of the circle, defined indirectly by junction deviation. This may be also viewed as
+  // path width or max_jerk in the previous Grbl version. This approach does not actually deviate
+  // from path, but used as a robust way to compute cornering speeds, as it takes into account the
+  // nonlinearities of both the junction angle and junction velocity.
+  //
+  // NOTE: If the junction deviation value is finite, Grbl executes the motions in an exact path
+  // mode (G61). If the junction deviation value is zero, Grbl will execute the motion in an exact
+  // stop mode (G61.1) manner. In the future, if continuous mode (G64) is desired, the math here
+  // is exactly the same. Instead of motioning all the way to junction point, the machine will
+  // just follow the arc circle defined here. The Arduino doesn't have the CPU cycles to perform
+  // a continuous mode path, but ARM-based microcontrollers most certainly do.
+  //
+  // NOTE: The max junction speed is a fixed value, since machine acceleration limits cannot be
+  // changed dynamically during operation nor can the line move geometry. This must be kept in
+  // memory in the event of a feedrate override changing the nominal speeds of blocks, which can
+  // change the overall maximum entry speed conditions of all blocks.
+
+  float junction_unit_vec[N_AXIS];
+  float junction_cos_theta = 0.0;
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    junction_cos_theta -= pl.previous_unit_vec[idx]*unit_vec[idx];
+    junction_unit_vec[idx] = unit_vec[idx]-pl.previous_unit_vec[idx];
+  }
+
+  // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
+  if (junction_cos_theta > 0.999999) {
+    //  For a 0 degree acute junction, just set minimum junction speed.
+    block->max_junction_speed_sqr = plan_speed_sqr_from_float(MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED);
+  } else {
+    if (junction_cos_theta < -0.999999) {
+      // Junction is a straight line or 180 degrees. Junction speed is infinite.
+      block->max_junction_speed_sqr = plan_speed_sqr_from_float(SOME_LARGE_VALUE);
+    } else {
+      convert_delta_vector_to_unit_vector(junction_unit_vec);
+      float junction_acceleration = limit_value_by_axis_maximum(settings.acceleration, junction_unit_vec);
+      float sin_theta_d2 = sqrt(0.5*(1.0-junction_cos_theta)); // Trig half angle identity. Always positive.
+      // Junctions of motions with the torch off on both sides only move the torch between pierces
+      // and may round the corner more. Cut junctions keep the tighter cornering tolerance.
+      float junction_deviation = settings.junction_deviation;
+      if (!((block->condition | pl.previous_condition) & PL_COND_SPINDLE_MASK)) {
+        junction_deviation = settings.rapid_junction_deviation;
+      }
+      block->max_junction_speed_sqr = plan_speed_sqr_from_float( max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
+                     (junction_acceleration * junction_deviation * sin_theta_d2)/(1.0-sin_theta_d2) ));
+    }
+  }
+}
+
+
+// Completes the profile data of the block, adds it to the buffer, and recalculates the plan. The
+// block is planned from position_steps to target (mm) and target_steps. exit_unit_vec is the path
+// direction at the block end, used for the next junction.
+static void planner_queue_block(plan_block_t *block, float *exit_unit_vec, float *target, int32_t *position_steps, int32_t *target_steps)
+{
+  float nominal_speed = plan_compute_profile_nominal_speed(block);
+  plan_compute_profile_parameters(block, nominal_speed, pl.previous_nominal_speed);
+
+  // Flag corners that slow the cut well below the nominal speeds of the blocks on both sides, along
+  // with the block decelerating into the corner. The THC holds the torch height through them.
+  if (block_buffer_head != block_buffer_tail) {
+    float corner_speed = CORNER_SLOWDOWN_RATIO*min(nominal_speed, pl.previous_nominal_speed);
+    if (plan_speed_sqr_to_float(block->max_junction_speed_sqr) < corner_speed*corner_speed) {
+      block->thc_flags |= PL_THC_FLAG_CORNER_SLOWDOWN;
+      block_buffer[plan_prev_block_index(block_buffer_head)].thc_flags |= PL_THC_FLAG_CORNER_SLOWDOWN;
+    }
+  }
+  pl.previous_nominal_speed = nominal_speed;
+  pl.previous_condition = block->condition;
+
+  // Update previous path unit_vector and planner position.
+  memcpy(pl.previous_unit_vec, exit_unit_vec, sizeof(pl.previous_unit_vec)); // pl.previous_unit_vec[] = exit_unit_vec[]
+  memcpy(pl.position, target_steps, sizeof(pl.position)); // pl.position[] = target_steps[]
+  #ifdef ENABLE_SEGMENT_MERGING
+    // The new block starts a merge run. Following collinear lines extend it from here.
+    memcpy(pl.merge_start_steps, position_steps, sizeof(pl.merge_start_steps));
+    memcpy(pl.merge_start_mm, pl.previous_target_mm, sizeof(pl.previous_target_mm));
+    memcpy(pl.previous_target_mm, target, sizeof(pl.previous_target_mm));
+    pl.merge_deviation = 0.0;
+  #endif
+
+  // New block is all set. Update buffer head and next buffer head indices.
+  block_buffer_head = next_buffer_head;
+  next_buffer_head = plan_next_block_index(block_buffer_head);
+
+  // Finish up by recalculating the plan with the new block.
+  planner_recalculate(false);
+}
+
+
+#ifdef ENABLE_SEGMENT_MERGING
+/* Extends the last queued block to the new target, when the new line continues it within the
+   SEGMENT_MERGE_TOLERANCE path deviation. CAM polylines with many short collinear or gently
+   curving segments are then planned as fewer and longer blocks, which extends the distance the
+   planner can look ahead over with the same buffer. The deviation of every merged line end from
+   the final chord is bounded by accumulating the distance of each previous end from the new
+   chord. Only lines with the same run conditions, feed rate and spindle speed are merged, and
+   never into the block the stepper is executing. Returns true, if the line was merged.
+   NOTE: Uses the head block as scratch space. The new block is rebuilt by the caller on failure. */
+static uint8_t planner_merge_line(plan_block_t *block, float *target, int32_t *target_steps, plan_line_data_t *pl_data)
+{
+  if (block->condition & (PL_COND_FLAG_SYSTEM_MOTION|PL_COND_FLAG_INVERSE_TIME)) { return(false); }
+  if (block_buffer_head == block_buffer_tail) { return(false); } // Buffer empty
+  uint8_t block_index = plan_prev_block_index(block_buffer_head);
+  if (block_index == block_buffer_tail) { return(false); } // Last block may be executing.
+  plan_block_t *last = &block_buffer[block_index];
+  #ifdef ENABLE_PLANNER_ARCS
+    if (last->is_arc) { return(false); }
+  #endif
+  if ((last->condition != block->condition) || (last->spindle_speed != block->spindle_speed)) { return(false); }
+  if ((last->thc_flags ^ block->thc_flags) & PL_THC_FLAG_ENABLE) { return(false); }
+  if (!(block->condition & PL_COND_FLAG_RAPID_MOTION) && (last->programmed_rate != pl_data->feed_rate)) { return(false); }
+
+  // Compute the distance of the previous line end from the chord of the merged block. Both
+  // vectors are taken from the merged block start. The new line must continue forward.
+  float end_vec[N_AXIS], chord_vec[N_AXIS];
+  float end_dot_chord = 0.0, chord_sqr = 0.0, end_sqr = 0.0;
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    end_vec[idx] = pl.previous_target_mm[idx]-pl.merge_start_mm[idx];
+    chord_vec[idx] = target[idx]-pl.merge_start_mm[idx];
+    end_dot_chord += end_vec[idx]*chord_vec[idx];
+    chord_sqr += chord_vec[idx]*chord_vec[idx];
+    end_sqr += end_vec[idx]*end_vec[idx];
+  }
+  if (end_dot_chord <= end_sqr) { return(false); } // Reversal or no progress past the previous end.
+  float scalar = end_dot_chord/chord_sqr;
+  float deviation = 0.0;
+  for (idx=0; idx<N_AXIS; idx++) {
+    end_vec[idx] -= scalar*chord_vec[idx];
+    deviation += end_vec[idx]*end_vec[idx];
+  }
+  deviation = pl.merge_deviation + sqrt(deviation);
+  if (deviation > SEGMENT_MERGE_TOLERANCE) { return(false); }
+
+  // Build the merged line in the head block and check that it does not lower the nominal speed
+  // already used for the junction limits of the last block.
+  float unit_vec[N_AXIS];
+  planner_compute_line_steps(block, pl.merge_start_steps, target_steps, unit_vec);
+  planner_compute_line_limits(block, unit_vec, pl_data->feed_rate);
+  float nominal_speed = plan_compute_profile_nominal_speed(block);
+  if (nominal_speed < pl.previous_nominal_speed) { return(false); }
+
+  // Extend the last block. Its entry junction and entry speed limits are kept.
+  memcpy(last->steps, block->steps, sizeof(block->steps));
+  last->direction_bits = block->direction_bits;
+  last->line_number = block->line_number;
+  last->millimeters = block->millimeters;
+  last->acceleration = block->acceleration;
+  #ifdef ENABLE_FIXED_POINT_PLANNER
+    last->delta_speed_sqr = block->delta_speed_sqr;
+  #endif
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    last->jerk = block->jerk;
+  #endif
+  last->rapid_rate = block->rapid_rate;
+  last->programmed_rate = block->programmed_rate;
+
+  memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec));
+  memcpy(pl.position, target_steps, sizeof(pl.position));
+  memcpy(pl.previous_target_mm, target, sizeof(pl.previous_target_mm));
+  pl.merge_deviation = deviation;
+  pl.merge_count++;
+
+  // Longer block only raises the plan. Recalculate from the extended last block.
+  planner_recalculate(false);
+  return(true);
+}
+#endif
+
+
 /* Add a new linear movement to the buffer. target[N_AXIS] is the signed, absolute target position
    in millimeters. Feed rate specifies the speed of the motion. If feed rate is inverted, the feed
    rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
@@ -318,12 +763,13 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
   plan_block_t *block = &block_buffer[block_buffer_head];
   memset(block,0,sizeof(plan_block_t)); // Zero all block values.
   block->condition = pl_data->condition;
+  block->thc_flags = pl_data->thc_flags & PL_THC_FLAG_ENABLE;
   block->spindle_speed = pl_data->spindle_speed;
   block->line_number = pl_data->line_number;
 
   // Compute and store initial move distance data.
   int32_t target_steps[N_AXIS], position_steps[N_AXIS];
-  float unit_vec[N_AXIS], delta_mm;
+  float unit_vec[N_AXIS];
   uint8_t idx;
 
   // Copy position data based on type of motion being planned.
@@ -337,63 +783,20 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
     #endif
   } else { memcpy(position_steps, pl.position, sizeof(pl.position)); }
 
-  #ifdef COREXY
-    target_steps[A_MOTOR] = lround(target[A_MOTOR]*settings.steps_per_mm[A_MOTOR]);
-    target_steps[B_MOTOR] = lround(target[B_MOTOR]*settings.steps_per_mm[B_MOTOR]);
-    block->steps[A_MOTOR] = labs((target_steps[X_AXIS]-position_steps[X_AXIS]) + (target_steps[Y_AXIS]-position_steps[Y_AXIS]));
-    block->steps[B_MOTOR] = labs((target_steps[X_AXIS]-position_steps[X_AXIS]) - (target_steps[Y_AXIS]-position_steps[Y_AXIS]));
-  #endif
-
-  for (idx=0; idx<N_AXIS; idx++) {
-    // Calculate target position in absolute steps, number of steps for each axis, and determine max step events.
-    // Also, compute individual axes distance for move and prep unit vector calculations.
-    // NOTE: Computes true distance from converted step values.
-    #ifdef COREXY
-      if ( !(idx == A_MOTOR) && !(idx == B_MOTOR) ) {
-        target_steps[idx] = lround(target[idx]*settings.steps_per_mm[idx]);
-        block->steps[idx] = labs(target_steps[idx]-position_steps[idx]);
-      }
-      block->step_event_count = max(block->step_event_count, block->steps[idx]);
-      if (idx == A_MOTOR) {
-        delta_mm = (target_steps[X_AXIS]-position_steps[X_AXIS] + target_steps[Y_AXIS]-position_steps[Y_AXIS])/settings.steps_per_mm[idx];
-      } else if (idx == B_MOTOR) {
-        delta_mm = (target_steps[X_AXIS]-position_steps[X_AXIS] - target_steps[Y_AXIS]+position_steps[Y_AXIS])/settings.steps_per_mm[idx];
-      } else {
-        delta_mm = (target_steps[idx] - position_steps[idx])/settings.steps_per_mm[idx];
-      }
-    #else
-      target_steps[idx] = lround(target[idx]*settings.steps_per_mm[idx]);
-      block->steps[idx] = labs(target_steps[idx]-position_steps[idx]);
-      block->step_event_count = max(block->step_event_count, block->steps[idx]);
-      delta_mm = (target_steps[idx] - position_steps[idx])/settings.steps_per_mm[idx];
-	  #endif
-    unit_vec[idx] = delta_mm; // Store unit vector numerator
-
-    // Set direction bits. Bit enabled always means direction is negative.
-    #ifdef DEFAULTS_RAMPS_BOARD
-      if (delta_mm < 0.0 ) { block->direction_bits[idx] |= get_direction_pin_mask(idx); }
-    #else
-      if (delta_mm < 0.0 ) { block->direction_bits |= get_direction_pin_mask(idx); }
-    #endif // DEFAULTS_RAMPS_BOARD
-  }
+  // Calculate target position in absolute steps.
+  for (idx=0; idx<N_AXIS; idx++) { target_steps[idx] = lround(target[idx]*settings.steps_per_mm[idx]); }
 
+  #ifdef ENABLE_SEGMENT_MERGING
+    if (planner_merge_line(block, target, target_steps, pl_data)) { return(PLAN_OK); }
+  #endif
   // Bail if this is a zero-length block. Highly unlikely to occur.
-  if (block->step_event_count == 0) { return(PLAN_EMPTY_BLOCK); }
+  if (planner_compute_line_steps(block, position_steps, target_steps, unit_vec) == 0) { return(PLAN_EMPTY_BLOCK); }
 
   // Calculate the unit vector of the line move and the block maximum feed rate and acceleration scaled
   // down such that no individual axes maximum values are exceeded with respect to the line direction.
   // NOTE: This calculation assumes all axes are orthogonal (Cartesian) and works with ABC-axes,
   // if they are also orthogonal/independent. Operates on the absolute value of the unit vector.
-  block->millimeters = convert_delta_vector_to_unit_vector(unit_vec);
-  block->acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
-  block->rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
-
-  // Store programmed rate.
-  if (block->condition & PL_COND_FLAG_RAPID_MOTION) { block->programmed_rate = block->rapid_rate; }
-  else { 
-    block->programmed_rate = pl_data->feed_rate;
-    if (block->condition & PL_COND_FLAG_INVERSE_TIME) { block->programmed_rate *= block->millimeters; }
-  }
+  planner_compute_line_limits(block, unit_vec, pl_data->feed_rate);
 
   // TODO: Need to check this method handling zero junction speeds when starting from rest.
   if ((block_buffer_head == block_buffer_tail) || (block->condition & PL_COND_FLAG_SYSTEM_MOTION)) {
@@ -404,72 +807,135 @@ uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data)
     block->max_junction_speed_sqr = 0.0; // Starting from rest. Enforce start from zero velocity.
 
   } else {
-    // Compute maximum allowable entry speed at junction by centripetal acceleration approximation.
-    // Let a circle be tangent to both previous and current path line segments, where the junction
-    // deviation is defined as the distance from the junction to the closest edge of the circle,
-    // colinear with the circle center. The circular segment joining the two paths represents the
-    // path of centripetal acceleration. Solve for max velocity based on max acceleration about the
-    // radius of the circle, defined indirectly by junction deviation. This may be also viewed as
-    // path width or max_jerk in the previous Grbl version. This approach does not actually deviate
-    // from path, but used as a robust way to compute cornering speeds, as it takes into account the
-    // nonlinearities of both the junction angle and junction velocity.
-    //
-    // NOTE: If the junction deviation value is finite, Grbl executes the motions in an exact path
-    // mode (G61). If the junction deviation value is zero, Grbl will execute the motion in an exact
-    // stop mode (G61.1) manner. In the future, if continuous mode (G64) is desired, the math here
-    // is exactly the same. Instead of motioning all the way to junction point, the machine will
-    // just follow the arc circle defined here. The Arduino doesn't have the CPU cycles to perform
-    // a continuous mode path, but ARM-based microcontrollers most certainly do.
-    //
-    // NOTE: The max junction speed is a fixed value, since machine acceleration limits cannot be
-    // changed dynamically during operation nor can the line move geometry. This must be kept in
-    // memory in the event of a feedrate override changing the nominal speeds of blocks, which can
-    // change the overall maximum entry speed conditions of all blocks.
-
-    float junction_unit_vec[N_AXIS];
-    float junction_cos_theta = 0.0;
-    for (idx=0; idx<N_AXIS; idx++) {
-      junction_cos_theta -= pl.previous_unit_vec[idx]*unit_vec[idx];
-      junction_unit_vec[idx] = unit_vec[idx]-pl.previous_unit_vec[idx];
-    }
-
-    // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
-    if (junction_cos_theta > 0.999999) {
-      //  For a 0 degree acute junction, just set minimum junction speed.
-      block->max_junction_speed_sqr = MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED;
-    } else {
-      if (junction_cos_theta < -0.999999) {
-        // Junction is a straight line or 180 degrees. Junction speed is infinite.
-        block->max_junction_speed_sqr = SOME_LARGE_VALUE;
-      } else {
-        convert_delta_vector_to_unit_vector(junction_unit_vec);
-        float junction_acceleration = limit_value_by_axis_maximum(settings.acceleration, junction_unit_vec);
-        float sin_theta_d2 = sqrt(0.5*(1.0-junction_cos_theta)); // Trig half angle identity. Always positive.
-        block->max_junction_speed_sqr = max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
-                       (junction_acceleration * settings.junction_deviation * sin_theta_d2)/(1.0-sin_theta_d2) );
-      }
-    }
+    planner_compute_junction_speed(block, unit_vec);
   }
 
   // Block system motion from updating this data to ensure next g-code motion is computed correctly.
   if (!(block->condition & PL_COND_FLAG_SYSTEM_MOTION)) {
-    float nominal_speed = plan_compute_profile_nominal_speed(block);
-    plan_compute_profile_parameters(block, nominal_speed, pl.previous_nominal_speed);
-    pl.previous_nominal_speed = nominal_speed;
+    planner_queue_block(block, unit_vec, target, position_steps, target_steps);
+  }
+  return(PLAN_OK);
+}
 
-    // Update previous path unit_vector and planner position.
-    memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
-    memcpy(pl.position, target_steps, sizeof(target_steps)); // pl.position[] = target_steps[]
 
-    // New block is all set. Update buffer head and next buffer head indices.
-    block_buffer_head = next_buffer_head;
-    next_buffer_head = plan_next_block_index(block_buffer_head);
+#ifdef ENABLE_PLANNER_ARCS
+// Returns the largest absolute cosine of the angles swept from start_angle through angular_travel.
+// One, if the sweep crosses a multiple of pi. Otherwise, at either end of the sweep.
+static float plan_arc_max_cos(float start_angle, float angular_travel)
+{
+  float end_angle = start_angle+angular_travel;
+  if (floor(start_angle/M_PI) != floor(end_angle/M_PI)) { return(1.0); }
+  return(max(fabs(cos(start_angle)), fabs(cos(end_angle))));
+}
+
 
-    // Finish up by recalculating the plan with the new block.
-    planner_recalculate();
+/* Add a new arc to the buffer as a single block, instead of a line block per arc segment. The block
+   distance is the helical arc length. The acceleration and rates are limited, so that no axis limit
+   is exceeded for any direction the path takes over the arc. The nominal speed is also limited, so
+   that the centripetal acceleration stays within the plane axes acceleration. The junctions
+   with the previous and next blocks use the arc tangents at the start and end. The step segment
+   generator traces the arc with a chord per segment. See stepper.c. */
+uint8_t plan_buffer_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+  float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear)
+{
+  // Prepare and initialize new block and its arc. Copy relevant pl_data for block execution.
+  plan_block_t *block = &block_buffer[block_buffer_head];
+  memset(block,0,sizeof(plan_block_t)); // Zero all block values.
+  block->condition = pl_data->condition;
+  block->thc_flags = pl_data->thc_flags & PL_THC_FLAG_ENABLE;
+  block->spindle_speed = pl_data->spindle_speed;
+  block->line_number = pl_data->line_number;
+  block->is_arc = true;
+
+  plan_arc_t *arc = &arc_buffer[arc_buffer_head];
+  arc->axis_0 = axis_0;
+  arc->axis_1 = axis_1;
+  arc->axis_linear = axis_linear;
+  arc->center[0] = position[axis_0] + offset[axis_0];
+  arc->center[1] = position[axis_1] + offset[axis_1];
+  arc->radius_vec[0] = -offset[axis_0];
+  arc->radius_vec[1] = -offset[axis_1];
+  arc->angular_travel = angular_travel;
+  arc->linear_start = position[axis_linear];
+  arc->linear_travel = target[axis_linear] - position[axis_linear];
+  memcpy(arc->start_steps, pl.position, sizeof(pl.position));
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) { arc->target_steps[idx] = lround(target[idx]*settings.steps_per_mm[idx]); }
+
+  float plane_mm = fabs(angular_travel)*radius;
+  arc->millimeters = block->millimeters = hypot(plane_mm, arc->linear_travel);
+  if (block->millimeters == 0.0) { return(PLAN_EMPTY_BLOCK); }
+
+  // Limit the block acceleration and rates by the worst case path direction over the arc. The plane
+  // axis components of the tangent are the largest sines and cosines of the swept radius angles,
+  // while the helical component is constant.
+  float plane_scalar = plane_mm/block->millimeters;
+  float start_angle = atan2(arc->radius_vec[1], arc->radius_vec[0]);
+  float max_cos = plan_arc_max_cos(start_angle, angular_travel);
+  float max_sin = plan_arc_max_cos(start_angle-0.5*M_PI, angular_travel);
+  float unit_vec[N_AXIS], exit_unit_vec[N_AXIS];
+  unit_vec[axis_0] = plane_scalar*max_sin;
+  unit_vec[axis_1] = plane_scalar*max_cos;
+  unit_vec[axis_linear] = arc->linear_travel/block->millimeters;
+  block->acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    block->jerk = limit_value_by_axis_maximum(settings.jerk, unit_vec);
+  #endif
+  block->rapid_rate = limit_value_by_axis_maximum(settings.max_rate, unit_vec);
+
+  // Limit the arc speed by the centripetal acceleration v^2/r of the plane speed, along the radius.
+  // Its plane axis components are the largest cosines and sines of the swept radius angles. Each is
+  // held to the full axis acceleration. The tangential acceleration of the ramps is limited by the
+  // block acceleration above, like the ramps of line blocks, which also don't reserve any for the
+  // centripetal acceleration of their junctions.
+  unit_vec[axis_0] = max_cos;
+  unit_vec[axis_1] = max_sin;
+  unit_vec[axis_linear] = 0.0;
+  float centripetal_acceleration = limit_value_by_axis_maximum(settings.acceleration, unit_vec);
+  float centripetal_speed_sqr = centripetal_acceleration*radius;
+  #ifdef ARC_SPEED_AS_LINE_SEGMENTS
+    // Raise the limit to the junction speed of the line segments mc_arc() would queue in place of
+    // the arc, from the same junction speed formula as planner_compute_junction_speed().
+    uint16_t segments = floor(fabs(0.5*angular_travel*radius)/
+                              sqrt(settings.arc_tolerance*(2*radius - settings.arc_tolerance)) );
+    if (segments > 1) {
+      float junction_deviation = settings.junction_deviation;
+      if (!(block->condition & PL_COND_SPINDLE_MASK)) { junction_deviation = settings.rapid_junction_deviation; }
+      float sin_theta_d2 = cos(0.5*angular_travel/segments);
+      float junction_speed_sqr = centripetal_acceleration*junction_deviation*sin_theta_d2/(1.0-sin_theta_d2);
+      if (junction_speed_sqr > centripetal_speed_sqr) { centripetal_speed_sqr = junction_speed_sqr; }
+    }
+  #endif
+  float centripetal_speed = sqrt(centripetal_speed_sqr)/plane_scalar;
+  if (block->rapid_rate > centripetal_speed) { block->rapid_rate = centripetal_speed; }
+  #ifdef ENABLE_FIXED_POINT_PLANNER
+    block->delta_speed_sqr = plan_speed_sqr_from_float(2*block->acceleration*block->millimeters);
+  #endif
+  block->programmed_rate = pl_data->feed_rate;
+  if (block->condition & PL_COND_FLAG_INVERSE_TIME) { block->programmed_rate *= block->millimeters; }
+
+  // Path directions at the arc start and end. The plane tangent is the radius vector rotated by 90
+  // degrees in the direction of travel.
+  float tangent_scalar = unit_vec[axis_0]/radius;
+  if (angular_travel < 0.0) { tangent_scalar = -tangent_scalar; }
+  exit_unit_vec[axis_linear] = unit_vec[axis_linear];
+  unit_vec[axis_0] = -tangent_scalar*arc->radius_vec[1];
+  unit_vec[axis_1] = tangent_scalar*arc->radius_vec[0];
+  exit_unit_vec[axis_0] = -tangent_scalar*(target[axis_1]-arc->center[1]);
+  exit_unit_vec[axis_1] = tangent_scalar*(target[axis_0]-arc->center[0]);
+
+  if (block_buffer_head == block_buffer_tail) {
+    block->entry_speed_sqr = 0.0;
+    block->max_junction_speed_sqr = 0.0; // Starting from rest. Enforce start from zero velocity.
+  } else {
+    planner_compute_junction_speed(block, unit_vec);
   }
+
+  if (++arc_buffer_head == PLAN_ARC_BUFFER_SIZE) { arc_buffer_head = 0; }
+  planner_queue_block(block, exit_unit_vec, target, arc->start_steps, arc->target_steps);
   return(PLAN_OK);
 }
+#endif
 
 
 // Reset the planner position vectors. Called by the system abort/initialization routine.
@@ -490,8 +956,32 @@ void plan_sync_position()
     #else
       pl.position[idx] = sys_position[idx];
     #endif
+    #ifdef ENABLE_SEGMENT_MERGING
+      pl.previous_target_mm[idx] = pl.position[idx]*settings_derived.mm_per_step[idx];
+    #endif
+  }
+}
+
+
+#ifdef ENABLE_SEGMENT_MERGING
+// Returns the number of lines merged into queued blocks since the last reset.
+uint32_t plan_get_merge_count() { return(pl.merge_count); }
+#endif
+
+
+#ifdef DEBUG
+// Returns the total distance of the motions queued in the planner buffer in (mm).
+float plan_get_buffer_millimeters()
+{
+  float millimeters = 0.0;
+  uint8_t block_index = block_buffer_tail;
+  while (block_index != block_buffer_head) {
+    millimeters += block_buffer[block_index].millimeters;
+    block_index = plan_next_block_index(block_index);
   }
+  return(millimeters);
 }
+#endif
 
 
 // Returns the number of available blocks are in the planner buffer.
@@ -518,5 +1008,5 @@ void plan_cycle_reinitialize()
   // Re-plan from a complete stop. Reset planner entry speeds and buffer planned pointer.
   st_update_plan_block_parameters();
   block_buffer_planned = block_buffer_tail;
-  planner_recalculate();
+  planner_recalculate(true);
 }
@@ -23,11 +23,50 @@
 #define planner_h
 
 
-// The number of linear motions that can be in the plan at any give time
+// The number of linear motions that can be in the plan at any give time. The Mega fits 64 blocks
+// with the packed plan_block_t below.
+// NOTE: Planner block RAM map in bytes, without ENABLE_S_CURVE_ACCELERATION (adds 4 bytes per block).
+//   Field                           Unpacked  Packed
+//   steps[N_AXIS]                      12        9    uint32_t to 24-bit step counts
+//   step_event_count                    4        0    Recomputed from steps[] when the stepper loads it
+//   direction_bits (RAMPS)              3        1    Per-axis port masks to one axis bitmask
+//   condition, thc_flags                2        2
+//   line_number                         4        4
+//   Speed, acceleration, rate floats   32       32    Float planner math is kept as is
+//   Block size                         57       48
+//   Buffer of 36 blocks              2052     1728
+//   Buffer of 64 blocks              3648     3072
+// ENABLE_FIXED_POINT_PLANNER also adds 4 bytes per block. ENABLE_PLANNER_ARCS adds 1 byte per block and
+// the arc buffer below.
 #ifndef BLOCK_BUFFER_SIZE
-  #define BLOCK_BUFFER_SIZE 36
+  #ifdef DEFAULTS_RAMPS_BOARD
+    #define BLOCK_BUFFER_SIZE 64
+  #else
+    #define BLOCK_BUFFER_SIZE 36
+  #endif
+#endif
+
+// The number of arcs that can be in the plan at any given time, less one. Arc blocks hold their arc
+// geometry in this separate buffer, so that line blocks don't pay for it. 51 bytes per arc.
+#if defined(ENABLE_PLANNER_ARCS) && !defined(PLAN_ARC_BUFFER_SIZE)
+  #define PLAN_ARC_BUFFER_SIZE 8
 #endif
 
+// Squared speed type of the planner block junction and entry speeds. With the fixed-point planner, in
+// whole (mm/min)^2 truncated towards zero and saturated at PLAN_SPEED_SQR_MAX, so that the sum of two
+// values never overflows. This caps planned junction speeds at 46340 mm/min.
+#ifdef ENABLE_FIXED_POINT_PLANNER
+  typedef uint32_t plan_speed_sqr_t;
+  #define PLAN_SPEED_SQR_MAX 0x7FFFFFFF
+#else
+  typedef float plan_speed_sqr_t;
+#endif
+
+// Packed step count type of planner blocks. 24-bit integers are native to avr-gcc. Limits a single
+// line motion to 16,777,215 steps per axis, well beyond the float precision limits of the step
+// segment generator. See stepper.c.
+typedef __uint24 plan_steps_t;
+
 // Returned status message from planner.
 #define PLAN_OK true
 #define PLAN_EMPTY_BLOCK false
@@ -45,48 +84,80 @@
 #define PL_COND_SPINDLE_MASK   (PL_COND_FLAG_SPINDLE_CW|PL_COND_FLAG_SPINDLE_CCW)
 #define PL_COND_ACCESSORY_MASK (PL_COND_FLAG_SPINDLE_CW|PL_COND_FLAG_SPINDLE_CCW|PL_COND_FLAG_COOLANT_FLOOD|PL_COND_FLAG_COOLANT_MIST)
 
+// Define planner block THC flags. Set by the planner and read by the THC through the stepper module.
+#define PL_THC_FLAG_CORNER_SLOWDOWN    bit(0) // Block slows down into or out of a corner. See CORNER_SLOWDOWN_RATIO.
+#define PL_THC_FLAG_ENABLE             bit(1) // THC runs through the block. Set by M234, cleared by M235.
+
 
 // This struct stores a linear movement of a g-code block motion with its critical "nominal" values
 // are as specified in the source g-code.
 typedef struct {
   // Fields used by the bresenham algorithm for tracing the line
   // NOTE: Used by stepper algorithm to execute the block correctly. Do not alter these values.
-  uint32_t steps[N_AXIS];    // Step count along each axis
-  uint32_t step_event_count; // The maximum step axis count and number of steps required to complete this block.
-  #ifdef DEFAULTS_RAMPS_BOARD
-    uint8_t direction_bits[N_AXIS];    // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-  #else
-    uint8_t direction_bits;    // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-  #endif // DEFAULTS_RAMPS_BOARD
+  // NOTE: The step event count is the maximum of the axis step counts. Computed by the stepper module.
+  plan_steps_t steps[N_AXIS]; // Step count along each axis
+  uint8_t direction_bits;     // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+                              //   On the RAMPS board, an axis bitmask expanded to port masks by the stepper.
   // Block condition data to ensure correct execution depending on states and overrides.
   uint8_t condition;      // Block bitflag variable defining block run conditions. Copied from pl_line_data.
+  uint8_t thc_flags;      // Block bitflag variable for the THC. See PL_THC_FLAG_* above.
   int32_t line_number;  // Block line number for real-time reporting. Copied from pl_line_data.
 
   // Fields used by the motion planner to manage acceleration. Some of these values may be updated
   // by the stepper module during execution of special motion cases for replanning purposes.
-  float entry_speed_sqr;     // The current planned entry speed at block junction in (mm/min)^2
-  float max_entry_speed_sqr; // Maximum allowable entry speed based on the minimum of junction limit and
-                             //   neighboring nominal speeds with overrides in (mm/min)^2
+  plan_speed_sqr_t entry_speed_sqr;     // The current planned entry speed at block junction in (mm/min)^2
+  plan_speed_sqr_t max_entry_speed_sqr; // Maximum allowable entry speed based on the minimum of junction limit and
+                                        //   neighboring nominal speeds with overrides in (mm/min)^2
+  #ifdef ENABLE_FIXED_POINT_PLANNER
+    plan_speed_sqr_t delta_speed_sqr;   // Squared speed change over the full block at its acceleration in (mm/min)^2
+  #endif
   float acceleration;        // Axis-limit adjusted line acceleration in (mm/min^2). Does not change.
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    float jerk;              // Axis-limit adjusted line jerk in (mm/min^3). Does not change.
+  #endif
   float millimeters;         // The remaining distance for this block to be executed in (mm).
                              // NOTE: This value may be altered by stepper algorithm during execution.
 
   // Stored rate limiting data used by planner when changes occur.
-  float max_junction_speed_sqr; // Junction entry speed limit based on direction vectors in (mm/min)^2
+  plan_speed_sqr_t max_junction_speed_sqr; // Junction entry speed limit based on direction vectors in (mm/min)^2
   float rapid_rate;             // Axis-limit adjusted maximum rate for this block direction in (mm/min)
   float programmed_rate;        // Programmed rate of this block (mm/min).
 
   // Stored spindle speed data used by spindle overrides and resuming methods.
   float spindle_speed;    // Block spindle speed. Copied from pl_line_data.
+
+  #ifdef ENABLE_PLANNER_ARCS
+    uint8_t is_arc;       // Block traces an arc. Its geometry is the next arc in the arc buffer. Steps unused.
+  #endif
 } plan_block_t;
 
 
+#ifdef ENABLE_PLANNER_ARCS
+  // Geometry of an arc block. Traced by the step segment generator with a chord per step segment.
+  // NOTE: Arcs are queued and discarded in the same order as their blocks.
+  typedef struct {
+    float center[2];              // Arc center in the plane axes (mm)
+    float radius_vec[2];          // Radius vector from the center to the arc start in the plane axes (mm)
+    float angular_travel;         // Signed arc angle. Positive is counter-clockwise. (rad)
+    float linear_start;           // Helical axis start position (mm)
+    float linear_travel;          // Helical axis travel (mm)
+    float millimeters;            // Total arc length. The block holds the remaining distance. (mm)
+    int32_t start_steps[N_AXIS];  // Arc start and end in absolute steps. The traced arc starts and
+    int32_t target_steps[N_AXIS]; //   ends exactly at the planner positions.
+    uint8_t axis_0;               // Plane and helical axes
+    uint8_t axis_1;
+    uint8_t axis_linear;
+  } plan_arc_t;
+#endif
+
+
 // Planner data prototype. Must be used when passing new motions to the planner.
 typedef struct {
   float feed_rate;          // Desired feed rate for line motion. Value is ignored, if rapid motion.
   float spindle_speed;      // Desired spindle speed through line motion.
   int32_t line_number;    // Desired line number to report when executing.
   uint8_t condition;        // Bitflag variable to indicate planner conditions. See defines above.
+  uint8_t thc_flags;        // THC bitflag variable. Only PL_THC_FLAG_ENABLE is taken from here.
 } plan_line_data_t;
 
 
@@ -99,6 +170,20 @@ void plan_reset_buffer(); // Reset buffer only.
 // rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
 uint8_t plan_buffer_line(float *target, plan_line_data_t *pl_data);
 
+#ifdef ENABLE_PLANNER_ARCS
+  // Add a new arc to the buffer as a single block. position, target, and offset are as passed to
+  // mc_arc(). angular_travel is the signed arc angle, positive for counter-clockwise arcs.
+  // NOTE: Assumes both the block and the arc buffers have room. See plan_check_full_arc_buffer().
+  uint8_t plan_buffer_arc(float *target, plan_line_data_t *pl_data, float *position, float *offset,
+    float radius, float angular_travel, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear);
+
+  // Gets the arc of the current block. Only valid, if the current block is an arc.
+  plan_arc_t *plan_get_current_arc();
+
+  // Returns the status of the arc ring buffer. True, if buffer is full.
+  uint8_t plan_check_full_arc_buffer();
+#endif
+
 // Called when the current block is no longer needed. Discards the block and makes the memory
 // availible for new blocks.
 void plan_discard_current_block();
@@ -115,9 +200,30 @@ uint8_t plan_next_block_index(uint8_t block_index);
 // Called by step segment buffer when computing executing block velocity profile.
 float plan_get_exec_block_exit_speed_sqr();
 
+// Converts squared speeds between float and the planner block representation.
+#ifdef ENABLE_FIXED_POINT_PLANNER
+  plan_speed_sqr_t plan_speed_sqr_from_float(float speed_sqr);
+  #define plan_speed_sqr_to_float(speed_sqr) ((float)(speed_sqr))
+#else
+  #define plan_speed_sqr_from_float(speed_sqr) (speed_sqr)
+  #define plan_speed_sqr_to_float(speed_sqr) (speed_sqr)
+#endif
+
 // Called by main program during planner calculations and step segment buffer during initialization.
 float plan_compute_profile_nominal_speed(plan_block_t *block);
 
+#ifdef ENABLE_S_CURVE_ACCELERATION
+  // Bisection steps of plan_scurve_peak_speed(). Resolves the peak to 1/65536 of the nominal speed.
+  #define PLAN_SCURVE_PEAK_ITERATIONS 16
+
+  // Time (min) and distance (mm) of a jerk-limited ramp between two speeds at the block limits.
+  float plan_scurve_ramp_time(plan_block_t *block, float speed_a, float speed_b);
+  float plan_scurve_ramp_distance(plan_block_t *block, float speed_a, float speed_b);
+
+  // Peak speed of a block profile with jerk-limited ramps over the remaining block distance.
+  float plan_scurve_peak_speed(plan_block_t *block, float entry_speed, float exit_speed, float nominal_speed);
+#endif
+
 // Re-calculates buffered motions profile parameters upon a motion-based override change.
 void plan_update_velocity_profile_parameters();
 
@@ -139,5 +245,15 @@ uint8_t plan_check_full_buffer();
 
 void plan_get_planner_mpos(float *target);
 
+#ifdef ENABLE_SEGMENT_MERGING
+  // Returns the number of lines merged into queued blocks since the last reset.
+  uint32_t plan_get_merge_count();
+#endif
+
+#ifdef DEBUG
+  // Returns the total distance of the motions queued in the planner buffer (mm). Lookahead distance.
+  float plan_get_buffer_millimeters();
+#endif
+
 
 #endif
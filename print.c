@@ -94,6 +94,33 @@ void print_uint8_base2_ndigit(uint8_t n, uint8_t digits) {
 }
 
 
+// Powers of ten used to convert 32-bit values to decimal digits by repeated subtraction.
+static const uint32_t print_powers_of_10[9] PROGMEM = {
+  1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10 };
+
+
+// Converts an uint32 to ASCII decimal digits, most significant first, without leading zeros, and
+// returns the number of digits. Zero returns no digits. Subtracts powers of ten instead of dividing,
+// since each 32-bit division and modulo by 10 is an expensive library call on the AVR. This takes
+// no more than nine compare-subtracts per digit and is considerably faster for typical values.
+static uint8_t print_uint32_digits(uint32_t n, unsigned char *buf)
+{
+  uint8_t i = 0;
+  uint8_t idx;
+  for (idx = 0; idx < 9; idx++) {
+    uint32_t power = pgm_read_dword(&print_powers_of_10[idx]);
+    unsigned char digit = '0';
+    while (n >= power) {
+      n -= power;
+      digit++;
+    }
+    if (i || (digit != '0')) { buf[i++] = digit; }
+  }
+  if (i || n) { buf[i++] = '0' + n; } // Ones digit is the remainder.
+  return(i);
+}
+
+
 void print_uint32_base10(uint32_t n)
 {
   if (n == 0) {
@@ -102,15 +129,10 @@ void print_uint32_base10(uint32_t n)
   }
 
   unsigned char buf[10];
-  uint8_t i = 0;
-
-  while (n > 0) {
-    buf[i++] = n % 10;
-    n /= 10;
-  }
-
-  for (; i > 0; i--)
-    serial_write('0' + buf[i-1]);
+  uint8_t n_digits = print_uint32_digits(n, buf);
+  uint8_t i;
+  for (i = 0; i < n_digits; i++)
+    serial_write(buf[i]);
 }
 
 
@@ -128,8 +150,7 @@ void printInteger(long n)
 // Convert float to string by immediately converting to a long integer, which contains
 // more digits than a float. Number of decimal places, which are tracked by a counter,
 // may be set by the user. The integer is then efficiently converted to a string.
-// NOTE: AVR '%' and '/' integer operations are very efficient. Bitshifting speed-up
-// techniques are actually just slightly slower. Found this out the hard way.
+// NOTE: The integer digits are generated by subtracting powers of ten. See print_uint32_digits().
 void printFloat(float n, uint8_t decimal_places)
 {
   if (n < 0) {
@@ -145,25 +166,19 @@ void printFloat(float n, uint8_t decimal_places)
   if (decimals) { n *= 10; }
   n += 0.5; // Add rounding factor. Ensures carryover through entire value.
 
-  // Generate digits backwards and store in string.
-  unsigned char buf[13];
-  uint8_t i = 0;
-  uint32_t a = (long)n;
-  while(a > 0) {
-    buf[i++] = (a % 10) + '0'; // Get digit
-    a /= 10;
-  }
-  while (i < decimal_places) {
-     buf[i++] = '0'; // Fill in zeros to decimal point for (n < 1)
-  }
-  if (i == decimal_places) { // Fill in leading zero, if needed.
-    buf[i++] = '0';
-  }
+  // Generate digits, most significant first.
+  unsigned char buf[10];
+  uint8_t n_digits = print_uint32_digits((long)n, buf);
 
-  // Print the generated string.
+  // Print the generated string. Fill in zeros to the decimal point for (n < 1), including a
+  // leading zero, as needed. i counts the characters left to print.
+  uint8_t i = decimal_places+1;
+  if (n_digits > decimal_places) { i = n_digits; }
+  uint8_t idx = 0;
   for (; i > 0; i--) {
     if (i == decimal_places) { serial_write('.'); } // Insert decimal point in right place.
-    serial_write(buf[i-1]);
+    if (i > n_digits) { serial_write('0'); }
+    else { serial_write(buf[idx++]); }
   }
 }
 
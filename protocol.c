@@ -29,7 +29,42 @@
 
 static char line[LINE_BUFFER_SIZE]; // Line to be executed. Zero-terminated.
 
+#ifdef ENABLE_INCREMENTAL_TOKENIZER
+  // Tokens of the incoming line are built in the upper half of the line buffer.
+  #define LINE_TOKEN_OFFSET (LINE_BUFFER_SIZE/2)
+  static uint8_t protocol_tokenize_word(uint8_t word_idx, uint8_t end_idx, uint8_t *token_counter);
+#endif
+
 static void protocol_exec_rt_suspend();
+static uint8_t protocol_rt_depth = 0; // Nesting of realtime command execution
+#ifdef ENABLE_BINARY_FRAMING
+  static uint8_t protocol_read_binary_frame();
+#endif
+#ifdef ENABLE_SD_CARD
+  static uint8_t protocol_line_from_sd = false; // Line being read is an SD card job line.
+#endif
+
+
+// Fetches the next character of the line being read. While an SD card job is running, a new line
+// is read from the card only when no serial data is waiting, so '$' commands may still be sent
+// during the job. A line is always read whole from the source it started from.
+static uint8_t protocol_read(uint8_t line_started)
+{
+  #ifdef ENABLE_SD_CARD
+    if (line_started) {
+      if (protocol_line_from_sd) { return(sd_job_read()); }
+    } else {
+      uint8_t c = serial_read();
+      protocol_line_from_sd = false;
+      if ((c == SERIAL_NO_DATA) && (sd_job.state == SD_JOB_RUNNING)) {
+        protocol_line_from_sd = true;
+        c = sd_job_read();
+      }
+      return(c);
+    }
+  #endif
+  return(serial_read());
+}
 
 
 /*
@@ -70,46 +105,114 @@ void protocol_main_loop()
 
   uint8_t line_flags = 0;
   uint8_t char_counter = 0;
+  uint8_t line_started = false; // Set by the first character of a line, including spaces and comments.
   uint8_t c;
+  #ifdef ENABLE_INCREMENTAL_TOKENIZER
+    uint8_t token_counter = 0; // Next token byte. Zero when the line is not being tokenized.
+    uint8_t word_idx = 0; // Line index of the current word letter.
+  #endif
+  #ifdef DEBUG
+    uint16_t eol_ticks;
+  #endif
   for (;;) {
 
     // Process one line of incoming serial data, as the data becomes available. Performs an
     // initial filtering by removing spaces and comments and capitalizing all letters.
-    while((c = serial_read()) != SERIAL_NO_DATA) {
+    while((c = protocol_read(line_started)) != SERIAL_NO_DATA) {
+      #ifdef ENABLE_BINARY_FRAMING
+        if (c == CMD_BINARY_FRAME) {
+          // Binary framed block. Decode the pre-tokenized words directly into the line buffer and
+          // execute them, bypassing the character filtering below. Any partial ASCII line is dropped.
+          uint8_t status = protocol_read_binary_frame();
+          protocol_execute_realtime(); // Runtime command check point.
+          if (sys.abort) { return; } // Bail to calling function upon system abort
+
+          if (status == STATUS_OK) {
+            if (sys.state & (STATE_ALARM | STATE_JOG)) { status = STATUS_SYSTEM_GC_LOCK; }
+            else { status = gc_execute_line(line); }
+          }
+          report_status_message(status);
+
+          // Reset tracking data for next line.
+          line_flags = 0;
+          char_counter = 0;
+          line_started = false;
+          continue;
+        }
+      #endif
       if ((c == '\n') || (c == '\r')) { // End of line reached
 
+        #ifdef DEBUG
+          eol_ticks = timer_get_ticks();
+        #endif
         protocol_execute_realtime(); // Runtime command check point.
         if (sys.abort) { return; } // Bail to calling function upon system abort
 
         line[char_counter] = 0; // Set string termination character.
+        #ifdef ENABLE_INCREMENTAL_TOKENIZER
+          // Tokenize the last word and terminate the tokenized block.
+          if (token_counter && !(line_flags & LINE_FLAG_OVERFLOW) &&
+              protocol_tokenize_word(word_idx, char_counter, &token_counter)) {
+            line[LINE_TOKEN_OFFSET] = GC_TOKENIZED_BLOCK_MARKER;
+            line[LINE_TOKEN_OFFSET+token_counter] = 0;
+          } else {
+            token_counter = 0;
+          }
+        #endif
         #ifdef REPORT_ECHO_LINE_RECEIVED
           report_echo_line_received(line);
         #endif
 
         // Direct and execute one line of formatted input, and report status of execution.
+        uint8_t status;
         if (line_flags & LINE_FLAG_OVERFLOW) {
           // Report line overflow error.
-          report_status_message(STATUS_OVERFLOW);
+          status = STATUS_OVERFLOW;
         } else if (line[0] == 0) {
           // Empty or comment line. For syncing purposes.
-          report_status_message(STATUS_OK);
+          status = STATUS_OK;
         } else if (line[0] == '$') {
           // Grbl '$' system command
-          report_status_message(system_execute_line(line));
+          status = system_execute_line(line);
         } else if (sys.state & (STATE_ALARM | STATE_JOG)) {
           // Everything else is gcode. Block if in alarm or jog mode.
-          report_status_message(STATUS_SYSTEM_GC_LOCK);
+          status = STATUS_SYSTEM_GC_LOCK;
+        #ifdef ENABLE_SD_CARD
+          } else if (!protocol_line_from_sd && (sd_job.state != SD_JOB_IDLE)) {
+            // Block serial g-code during an SD card job.
+            status = STATUS_SD_JOB_ACTIVE;
+        #endif
         } else {
           // Parse and execute g-code block.
-          report_status_message(gc_execute_line(line));
+          #ifdef ENABLE_INCREMENTAL_TOKENIZER
+            if (token_counter) { status = gc_execute_line(&line[LINE_TOKEN_OFFSET]); }
+            else
+          #endif
+          status = gc_execute_line(line);
         }
+        #ifdef ENABLE_SD_CARD
+          // SD card job lines are not acknowledged. Errors stop the job.
+          if (protocol_line_from_sd) { sd_job_line_done(status); }
+          else
+        #endif
+        report_status_message(status);
+        #ifdef DEBUG
+          // NOTE: Includes any wait for room in a full planner buffer.
+          sys_debug_line_latency = timer_get_ticks()-eol_ticks;
+          if (sys_debug_line_latency > sys_debug_line_latency_max) { sys_debug_line_latency_max = sys_debug_line_latency; }
+        #endif
 
         // Reset tracking data for next line.
         line_flags = 0;
         char_counter = 0;
+        line_started = false;
+        #ifdef ENABLE_INCREMENTAL_TOKENIZER
+          token_counter = 0;
+        #endif
 
       } else {
 
+        line_started = true;
         if (line_flags) {
           // Throw away all (except EOL) comment characters and overflow characters.
           if (c == ')') {
@@ -141,10 +244,27 @@ void protocol_main_loop()
           } else if (char_counter >= (LINE_BUFFER_SIZE-1)) {
             // Detect line buffer overflow and set flag.
             line_flags |= LINE_FLAG_OVERFLOW;
-          } else if (c >= 'a' && c <= 'z') { // Upcase lowercase
-            line[char_counter++] = c-'a'+'A';
           } else {
+            if (c >= 'a' && c <= 'z') { c -= 'a'-'A'; } // Upcase lowercase
             line[char_counter++] = c;
+
+            #ifdef ENABLE_INCREMENTAL_TOKENIZER
+              if (char_counter == 1) {
+                // Only tokenize g-code blocks. System commands start with '$'.
+                if (c >= 'A' && c <= 'Z') {
+                  token_counter = 1; // Leave room for the block marker.
+                  word_idx = 0;
+                }
+              } else if (token_counter) {
+                if (char_counter >= LINE_TOKEN_OFFSET) {
+                  token_counter = 0; // Text has reached the token area. Execute from text.
+                } else if (c >= 'A' && c <= 'Z') {
+                  // New word letter terminates the previous word. Tokenize it now.
+                  if (protocol_tokenize_word(word_idx, char_counter-1, &token_counter)) { word_idx = char_counter-1; }
+                  else { token_counter = 0; }
+                }
+              }
+            #endif
           }
         }
 
@@ -169,10 +289,108 @@ void protocol_main_loop()
 }
 
 
+#ifdef ENABLE_INCREMENTAL_TOKENIZER
+  // Parses the g-code word starting with the letter at line[word_idx], which has been terminated at
+  // line[end_idx] by the next letter or the end of line, and appends it to the line tokens. Returns
+  // false, if the word can't be tokenized. The line is then executed from text, so the g-code
+  // parser reports any errors as usual.
+  static uint8_t protocol_tokenize_word(uint8_t word_idx, uint8_t end_idx, uint8_t *token_counter)
+  {
+    float value;
+    uint8_t char_counter = word_idx+1;
+    if (!read_float(line, &char_counter, &value) || (char_counter != end_idx)) { return(false); }
+    // Leave room for the word and the block terminator.
+    if ((*token_counter + GC_TOKENIZED_WORD_SIZE) >= (LINE_BUFFER_SIZE-LINE_TOKEN_OFFSET)) { return(false); }
+
+    char letter = line[word_idx];
+    if (letter == 'M') {
+      // The stepper and pin M-commands re-parse the text line. See gc_execute_line().
+      uint8_t int_value = trunc(value);
+      if ((int_value == 17) || (int_value == 18) || (int_value == 42) ||
+          (int_value == 219) || (int_value == 226) || (int_value == 227)) { return(false); }
+    }
+
+    char *token = &line[LINE_TOKEN_OFFSET + *token_counter];
+    token[0] = letter;
+    memcpy(&token[1], &value, sizeof(float));
+    *token_counter += GC_TOKENIZED_WORD_SIZE;
+    return(true);
+  }
+#endif
+
+
+#ifdef ENABLE_BINARY_FRAMING
+  static uint16_t protocol_frame_bytes; // Bytes of the frame being read, CMD_BINARY_FRAME included.
+
+  // Waits for and fetches the next byte of a binary frame. Keeps the realtime system and step
+  // segment buffer serviced while waiting. Returns false upon a system abort, or when the frame is
+  // short, since the RX ISR dropped its remaining bytes on a full buffer.
+  static uint8_t protocol_read_frame_byte(uint8_t *data)
+  {
+    // NOTE: Frame data may contain SERIAL_NO_DATA, so check the buffer count instead.
+    for (;;) {
+      if (serial_rx_frame_is_short(protocol_frame_bytes)) { return(false); }
+      if (serial_get_rx_buffer_count()) { break; }
+      protocol_execute_realtime();
+      if (sys.abort) { return(false); }
+    }
+    *data = serial_read();
+    protocol_frame_bytes++;
+    return(true);
+  }
+
+
+  // Reads the remainder of a binary frame, after the CMD_BINARY_FRAME character, and decodes it
+  // into the line buffer as a pre-tokenized block. See ENABLE_BINARY_FRAMING in config.h.
+  // NOTE: The entire frame is always consumed, even when invalid, to stay in sync with the stream.
+  // A short frame is consumed up to its last byte in the buffer. Upon a system abort, the returned
+  // status is not reported.
+  static uint8_t protocol_read_binary_frame()
+  {
+    uint8_t len, data, idx;
+    uint16_t crc = 0xFFFF;
+    uint8_t status = STATUS_OK;
+
+    serial_rx_frame_begin();
+    protocol_frame_bytes = 1;
+    if (!protocol_read_frame_byte(&len)) { return(STATUS_BINARY_FRAME_ERROR); }
+    crc = _crc_ccitt_update(crc, len);
+    if ((len == 0) || (len % GC_TOKENIZED_WORD_SIZE) || (len > (LINE_BUFFER_SIZE-2))) { status = STATUS_BINARY_FRAME_ERROR; }
+
+    line[0] = GC_TOKENIZED_BLOCK_MARKER;
+    for (idx=0; idx<len; idx++) {
+      if (!protocol_read_frame_byte(&data)) { return(STATUS_BINARY_FRAME_ERROR); }
+      crc = _crc_ccitt_update(crc, data);
+      if (status == STATUS_OK) {
+        // Word letters must be valid, since a zero letter terminates the block early.
+        if ((idx % GC_TOKENIZED_WORD_SIZE == 0) && ((data < 'A') || (data > 'Z'))) { status = STATUS_BINARY_FRAME_ERROR; }
+        line[idx+1] = data;
+      }
+    }
+
+    if (!protocol_read_frame_byte(&data)) { return(STATUS_BINARY_FRAME_ERROR); }
+    crc ^= data; // Low byte first
+    if (!protocol_read_frame_byte(&data)) { return(STATUS_BINARY_FRAME_ERROR); }
+    crc ^= ((uint16_t)data << 8);
+    if (crc) { status = STATUS_BINARY_FRAME_ERROR; }
+
+    if (status == STATUS_OK) { line[len+1] = 0; }
+    return(status);
+  }
+#endif
+
+
 // Block until all buffered steps are executed or in a cycle state. Works with feed hold
 // during a synchronize call, if it should happen. Also, waits for clean cycle end.
 void protocol_buffer_synchronize()
 {
+  #ifdef ENABLE_RUN_TIME_ESTIMATOR
+    // Check mode motions are never executed. Time them out of the planner instead.
+    if (sys.state == STATE_CHECK_MODE) {
+      estimator_sync();
+      return;
+    }
+  #endif
   // If system is queued, ensure cycle resumes if the auto start flag is present.
   protocol_auto_cycle_start();
   do {
@@ -209,16 +427,24 @@ void protocol_auto_cycle_start()
 // limit switches, or the main program.
 void protocol_execute_realtime()
 {
+  protocol_rt_depth++;
   protocol_exec_rt_system();
   if (sys.suspend) { protocol_exec_rt_suspend(); }
+  protocol_rt_depth--;
 }
 
 
+// Returns true while realtime commands are being executed. Output printed by them may not wait
+// on realtime commands in turn. See report_wait_tx_line().
+uint8_t protocol_is_executing_realtime() { return(protocol_rt_depth != 0); }
+
+
 // Executes run-time commands, when required. This function primarily operates as Grbl's state
 // machine and controls the various real-time features Grbl has to offer.
 // NOTE: Do not alter this unless you know exactly what you are doing!
 void protocol_exec_rt_system()
 {
+  protocol_rt_depth++;
   uint8_t rt_exec; // Temp variable to avoid calling volatile multiple times.
   rt_exec = sys_rt_exec_alarm; // Copy volatile sys_rt_exec_alarm.
   if (rt_exec) { // Enter only if any bit flag is true
@@ -243,12 +469,35 @@ void protocol_exec_rt_system()
     system_clear_exec_alarm(); // Clear alarm
   }
 
+  // Print any feedback message raised at an interrupt level, i.e. by the alarm input pins.
+  report_deferred_feedback_message();
+
+  // Run the THC update requested by Timer2, and the THC telemetry frame that follows it.
+  if (thc_update_pending) {
+    thc_update_pending = false;
+    thc_update();
+    #ifdef ENABLE_TELEMETRY_PORT
+      if (telemetry_thc_pending) {
+        telemetry_thc_pending = false;
+        report_telemetry_thc();
+      }
+    #endif
+  }
+
+  #ifdef ENABLE_TELEMETRY_PORT
+    if (telemetry_status_pending) {
+      telemetry_status_pending = false;
+      report_telemetry_status();
+    }
+  #endif
+
   rt_exec = sys_rt_exec_state; // Copy volatile sys_rt_exec_state.
   if (rt_exec) {
 
     // Execute system abort.
     if (rt_exec & EXEC_RESET) {
       sys.abort = true;  // Only place this is set true.
+      protocol_rt_depth--;
       return; // Nothing else to do but exit.
     }
 
@@ -502,7 +751,13 @@ void protocol_exec_rt_system()
 
   // Reload step segment buffer
   if (sys.state & (STATE_CYCLE | STATE_HOLD | STATE_SAFETY_DOOR | STATE_HOMING | STATE_SLEEP| STATE_JOG)) {
-    st_prep_buffer();
+    #ifdef DEBUG
+      uint16_t prep_ticks = timer_get_ticks();
+      st_prep_buffer();
+      sys_debug_prep_ticks += (uint16_t)(timer_get_ticks()-prep_ticks);
+    #else
+      st_prep_buffer();
+    #endif
   }
 
 }
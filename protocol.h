@@ -34,6 +34,7 @@ void protocol_main_loop();
 // Checks and executes a realtime command at various stop points in main program
 void protocol_execute_realtime();
 void protocol_exec_rt_system();
+uint8_t protocol_is_executing_realtime();
 
 // Executes the auto cycle feature, if enabled.
 void protocol_auto_cycle_start();
@@ -30,7 +30,7 @@
 
 
 // Internal report utilities to reduce flash with repetitive tasks turned into functions.
-void report_util_setting_prefix(uint8_t n) { serial_write('$'); print_uint8_base10(n); serial_write('='); }
+void report_util_setting_prefix(uint8_t n) { report_wait_tx_line(); serial_write('$'); print_uint8_base10(n); serial_write('='); }
 static void report_util_line_feed() { printPgmString(PSTR("\r\n")); }
 static void report_util_feedback_line_feed() { serial_write(']'); report_util_line_feed(); }
 static void report_util_gcode_modes_G() { printPgmString(PSTR(" G")); }
@@ -60,6 +60,7 @@ static void report_util_setting_string(uint8_t n) {
     case 11: printPgmString(PSTR("jnc dev")); break;
     case 12: printPgmString(PSTR("arc tol")); break;
     case 13: printPgmString(PSTR("rpt inch")); break;
+    case 15: printPgmString(PSTR("rpd jnc dev")); break;
     case 20: printPgmString(PSTR("sft lim")); break;
     case 21: printPgmString(PSTR("hrd lim")); break;
     case 22: printPgmString(PSTR("hm cyc")); break;
@@ -71,6 +72,12 @@ static void report_util_setting_string(uint8_t n) {
     case 30: printPgmString(PSTR("rpm max")); break;
     case 31: printPgmString(PSTR("rpm min")); break;
     case 32: printPgmString(PSTR("laser")); break;
+    case 40: printPgmString(PSTR("thc kp")); break;
+    case 41: printPgmString(PSTR("thc ki")); break;
+    case 42: printPgmString(PSTR("thc kd")); break;
+    case 43: printPgmString(PSTR("thc max vel")); break;
+    case 44: printPgmString(PSTR("thc accel")); break;
+    case 45: printPgmString(PSTR("adc filter")); break;
     default:
       n -= AXIS_SETTINGS_START_VAL;
       uint8_t idx = 0;
@@ -84,6 +91,7 @@ static void report_util_setting_string(uint8_t n) {
         case 1: printPgmString(PSTR(":mm/min")); break;
         case 2: printPgmString(PSTR(":mm/s^2")); break;
         case 3: printPgmString(PSTR(":mm max")); break;
+        case 4: printPgmString(PSTR(":mm/s^3")); break;
       }
       break;
   }
@@ -103,6 +111,44 @@ static void report_util_float_setting(uint8_t n, float val, uint8_t n_decimal) {
 }
 
 
+// Waits until the TX buffer has room for a full line of non-critical output. Realtime commands are
+// executed and the step segment buffer is kept filled meanwhile, so a long dump to a host that isn't
+// reading can't hold off a feed hold, cycle start, or status report. Output printed by the realtime
+// commands waits without them, since they aren't reentrant.
+// NOTE: Only waits from the main program. Interrupts can't wait on the TX buffer.
+void report_wait_tx_line()
+{
+  if (!(SREG & (1<<SREG_I))) { return; }
+  while (serial_get_tx_buffer_available() < REPORT_TX_LINE_SIZE) {
+    if (sys_rt_exec_state & EXEC_RESET) { return; }
+    if (!protocol_is_executing_realtime()) {
+      protocol_execute_realtime(); // Fills the step segment buffer too.
+      if (sys.abort) { return; }
+    } else if (sys.state & (STATE_CYCLE | STATE_HOLD | STATE_SAFETY_DOOR | STATE_HOMING | STATE_SLEEP| STATE_JOG)) {
+      st_prep_buffer();
+    }
+  }
+}
+
+
+// Feedback messages raised at an interrupt level, i.e. the alarm input pins, to be printed later
+// by the main program, oldest first. Only interrupts write the head, and only the main program
+// the tail. Messages raised while the queue is full are dropped.
+#define REPORT_DEFERRED_QUEUE_SIZE 4 // Power of two
+static volatile uint8_t report_deferred_queue[REPORT_DEFERRED_QUEUE_SIZE];
+static volatile uint8_t report_deferred_head = 0;
+static volatile uint8_t report_deferred_tail = 0;
+
+void report_deferred_feedback_message()
+{
+  while (report_deferred_tail != report_deferred_head) {
+    uint8_t message_code = report_deferred_queue[report_deferred_tail];
+    report_deferred_tail = (report_deferred_tail+1) & (REPORT_DEFERRED_QUEUE_SIZE-1);
+    report_feedback_message(message_code);
+  }
+}
+
+
 // Handles the primary confirmation protocol response for streaming interfaces and human-feedback.
 // For every incoming line, this method responds with an 'ok' for a successful command or an
 // 'error:'  to indicate some error event with the line or some critical system error during
@@ -137,6 +183,16 @@ void report_alarm_message(uint8_t alarm_code)
 // is installed, the message number codes are less than zero.
 void report_feedback_message(uint8_t message_code)
 {
+  // Defer messages raised at an interrupt level to the main program. Never write from an ISR.
+  if (!(SREG & (1<<SREG_I))) {
+    uint8_t next_head = (report_deferred_head+1) & (REPORT_DEFERRED_QUEUE_SIZE-1);
+    if (next_head != report_deferred_tail) {
+      report_deferred_queue[report_deferred_head] = message_code;
+      report_deferred_head = next_head;
+    }
+    return;
+  }
+  report_wait_tx_line();
   printPgmString(PSTR("[MSG:"));
   switch(message_code) {
     case MESSAGE_CRITICAL_EVENT:
@@ -171,6 +227,10 @@ void report_feedback_message(uint8_t message_code)
       printPgmString(PSTR("Alarm Out Servo Y")); break; 
     case MESSAGE_ALARM_TOURCH_SIGNAL:
       printPgmString(PSTR("Alarm Tourch Signal")); break; 
+    case MESSAGE_SD_JOB_DONE:
+      printPgmString(PSTR("SD job done")); break;
+    case MESSAGE_THC_GAIN_LIMITED:
+      printPgmString(PSTR("THC gain limited")); break;
 
   }
   report_util_feedback_line_feed();
@@ -186,7 +246,8 @@ void report_init_message()
 
 // Grbl help message
 void report_grbl_help() {
-  printPgmString(PSTR("[HLP:$$ $# $G $I $N $x=val $Nx=line $J=line $SLP $C $X $H ~ ! ? ctrl-x]\r\n"));    
+  report_wait_tx_line();
+  printPgmString(PSTR("[HLP:$$ $# $G $I $N $x=val $Nx=line $J=line $SLP $C $X $H $B $F ~ ! ? ctrl-x]\r\n"));    
 }
 
 // Grbl global settings print out.
@@ -205,6 +266,8 @@ void report_grbl_settings() {
   report_util_float_setting(11,settings.junction_deviation,N_DECIMAL_SETTINGVALUE);
   report_util_float_setting(12,settings.arc_tolerance,N_DECIMAL_SETTINGVALUE);
   report_util_uint8_setting(13,bit_istrue(settings.flags,BITFLAG_REPORT_INCHES));
+  report_util_uint8_setting(14,settings.status_report_interval);
+  report_util_float_setting(15,settings.rapid_junction_deviation,N_DECIMAL_SETTINGVALUE);
   report_util_uint8_setting(20,bit_istrue(settings.flags,BITFLAG_SOFT_LIMIT_ENABLE));
   report_util_uint8_setting(21,bit_istrue(settings.flags,BITFLAG_HARD_LIMIT_ENABLE));
   report_util_uint8_setting(22,bit_istrue(settings.flags,BITFLAG_HOMING_ENABLE));
@@ -216,6 +279,12 @@ void report_grbl_settings() {
   report_util_float_setting(30,settings.rpm_max,N_DECIMAL_RPMVALUE);
   report_util_float_setting(31,settings.rpm_min,N_DECIMAL_RPMVALUE);
   report_util_uint8_setting(32,bit_istrue(settings.flags,BITFLAG_LASER_MODE));
+  report_util_float_setting(40,settings.thc_kp,N_DECIMAL_SETTINGVALUE);
+  report_util_float_setting(41,settings.thc_ki,N_DECIMAL_SETTINGVALUE);
+  report_util_float_setting(42,settings.thc_kd,N_DECIMAL_SETTINGVALUE);
+  report_util_float_setting(43,settings.thc_max_velocity,N_DECIMAL_SETTINGVALUE);
+  report_util_float_setting(44,settings.thc_acceleration,N_DECIMAL_SETTINGVALUE);
+  report_util_uint8_setting(45,settings.adc_filter);
   // Print axis settings
   uint8_t idx, set_idx;
   uint8_t val = AXIS_SETTINGS_START_VAL;
@@ -226,6 +295,7 @@ void report_grbl_settings() {
         case 1: report_util_float_setting(val+idx,settings.max_rate[idx],N_DECIMAL_SETTINGVALUE); break;
         case 2: report_util_float_setting(val+idx,settings.acceleration[idx]/(60*60),N_DECIMAL_SETTINGVALUE); break;
         case 3: report_util_float_setting(val+idx,-settings.max_travel[idx],N_DECIMAL_SETTINGVALUE); break;
+        case 4: report_util_float_setting(val+idx,settings.jerk[idx]/(60*60*60),N_DECIMAL_SETTINGVALUE); break;
       }
     }
     val += AXIS_SETTINGS_INCREMENT;
@@ -242,6 +312,7 @@ void report_grbl_settings() {
 void report_probe_parameters()
 {
   // Report in terms of machine position.
+  report_wait_tx_line();
   printPgmString(PSTR("[PRB:"));
   float print_position[N_AXIS];
   system_convert_array_steps_to_mpos(print_position,sys_probe_position);
@@ -262,6 +333,7 @@ void report_ngc_parameters()
       report_status_message(STATUS_SETTING_READ_FAIL);
       return;
     }
+    report_wait_tx_line();
     printPgmString(PSTR("[G"));
     switch (coord_select) {
       case 6: printPgmString(PSTR("28")); break;
@@ -272,9 +344,11 @@ void report_ngc_parameters()
     report_util_axis_values(coord_data);
     report_util_feedback_line_feed();
   }
+  report_wait_tx_line();
   printPgmString(PSTR("[G92:")); // Print G92,G92.1 which are not persistent in memory
   report_util_axis_values(gc_state.coord_offset);
   report_util_feedback_line_feed();
+  report_wait_tx_line();
   printPgmString(PSTR("[TLO:")); // Print tool length offset value
   printFloat_CoordValue(gc_state.tool_length_offset);
   report_util_feedback_line_feed();
@@ -285,6 +359,7 @@ void report_ngc_parameters()
 // Print current gcode parser mode state
 void report_gcode_modes()
 {
+  report_wait_tx_line();
   printPgmString(PSTR("[GC:G"));
   if (gc_state.modal.motion >= MOTION_MODE_PROBE_TOWARD) {
     printPgmString(PSTR("38."));
@@ -355,6 +430,7 @@ void report_gcode_modes()
 // Prints specified startup line
 void report_startup_line(uint8_t n, char *line)
 {
+  report_wait_tx_line();
   printPgmString(PSTR("$N"));
   print_uint8_base10(n);
   serial_write('=');
@@ -373,9 +449,11 @@ void report_execute_startup_message(char *line, uint8_t status_code)
 // Prints build info line
 void report_build_info(char *line)
 {
+  report_wait_tx_line();
   printPgmString(PSTR("[VER:" GRBL_VERSION "." GRBL_VERSION_BUILD ":"));
   printString(line);
   report_util_feedback_line_feed();
+  report_wait_tx_line();
   printPgmString(PSTR("[OPT:")); // Generate compile-time build option list
   serial_write('V'); // Variable spindle standard.
   serial_write('N'); // Line number reporting standard.
@@ -432,6 +510,9 @@ void report_build_info(char *line)
   #ifndef FORCE_BUFFER_SYNC_DURING_WCO_CHANGE // NOTE: Shown when disabled.
     serial_write('W');
   #endif
+  #ifdef ENABLE_BINARY_FRAMING
+    serial_write('B');
+  #endif
   // NOTE: Compiled values, like override increments/max/min values, may be added at some point later.
   serial_write(',');
   print_uint8_base10(BLOCK_BUFFER_SIZE-1);
@@ -442,6 +523,85 @@ void report_build_info(char *line)
 }
 
 
+// Prints the serial baud rate, the number of receive errors, and the total
+// msec the main program has stalled on a full TX buffer. Used by `$B` and to acknowledge a baud
+// rate change before switching.
+void report_baud_rate(uint32_t baud_rate)
+{
+  printPgmString(PSTR("[BAUD:"));
+  print_uint32_base10(baud_rate);
+  serial_write(',');
+  print_uint32_base10(serial_get_rx_error_count());
+  serial_write(',');
+  // Ticks to msec in integer math, split to keep the product within 32 bits.
+  uint32_t stall_ticks = serial_get_tx_stall_ticks();
+  print_uint32_base10((stall_ticks/1000)*TIMER_TICK_US + ((stall_ticks%1000)*TIMER_TICK_US)/1000);
+  report_util_feedback_line_feed();
+}
+
+
+#ifdef ENABLE_SD_CARD
+  void report_sd_file(char *name, uint32_t size)
+  {
+    report_wait_tx_line();
+    printPgmString(PSTR("[FILE:"));
+    printString(name);
+    serial_write(',');
+    print_uint32_base10(size);
+    report_util_feedback_line_feed();
+  }
+
+
+  void report_sd_job_status()
+  {
+    report_wait_tx_line();
+    printPgmString(PSTR("[SD:"));
+    switch (sd_job.state) {
+      case SD_JOB_IDLE: printPgmString(PSTR("Idle")); break;
+      case SD_JOB_PAUSED: printPgmString(PSTR("Pause")); break;
+      default: printPgmString(PSTR("Run"));
+    }
+    serial_write(',');
+    print_uint32_base10(sd_job.file.position);
+    serial_write(',');
+    print_uint32_base10(sd_job.file.size);
+    serial_write(',');
+    print_uint32_base10(sd_job.line_count);
+    serial_write(',');
+    printString(sd_job.name);
+    report_util_feedback_line_feed();
+  }
+#endif
+
+
+#ifdef ENABLE_RUN_TIME_ESTIMATOR
+  void report_run_time_estimate()
+  {
+    report_wait_tx_line();
+    printPgmString(PSTR("[EST:"));
+    printFloat(estimator_get_seconds(&estimator.total), N_DECIMAL_SECONDS);
+    serial_write(',');
+    printFloat(estimator_get_seconds(&estimator.cut), N_DECIMAL_SECONDS);
+    serial_write(',');
+    printFloat(estimator_get_seconds(&estimator.rapid), N_DECIMAL_SECONDS);
+    serial_write(',');
+    printFloat(estimator_get_seconds(&estimator.dwell), N_DECIMAL_SECONDS);
+    report_util_feedback_line_feed();
+  }
+
+
+  void report_line_time_estimate(int32_t line_number, float seconds)
+  {
+    report_wait_tx_line();
+    printPgmString(PSTR("[ESTL:"));
+    print_uint32_base10(line_number);
+    serial_write(',');
+    printFloat(seconds, N_DECIMAL_SECONDS);
+    report_util_feedback_line_feed();
+  }
+#endif
+
+
 // Prints the character string line Grbl has received from the user, which has been pre-parsed,
 // and has been sent into protocol_execute_line() routine to be executed by Grbl.
 void report_echo_line_received(char *line)
@@ -451,6 +611,99 @@ void report_echo_line_received(char *line)
 }
 
 
+// Writes one byte of a binary frame to the serial port or the telemetry port.
+static void report_util_binary_write_byte(uint8_t data, uint8_t port)
+{
+  #ifdef ENABLE_TELEMETRY_PORT
+    if (port == REPORT_PORT_TELEMETRY) {
+      telemetry_write(data);
+      return;
+    }
+  #endif
+  serial_write(data);
+}
+
+
+// Writes bytes of a binary frame and updates its CRC.
+static void report_util_binary_write(void *data, uint8_t n, uint16_t *crc, uint8_t port)
+{
+  uint8_t *ptr = (uint8_t*)data;
+  while (n--) {
+    *crc = _crc_ccitt_update(*crc, *ptr);
+    report_util_binary_write_byte(*ptr++, port);
+  }
+}
+
+
+// Sends the compact binary status frame. See report.h for the layout. Avoids all of the float
+// conversion and formatting of the ASCII report, for high rate position and arc voltage logging.
+static void report_realtime_status_binary(uint8_t port)
+{
+  uint16_t crc = 0xFFFF;
+  int32_t current_position[N_AXIS]; // Copy current state of the system position variable
+  memcpy(current_position,sys_position,sizeof(sys_position));
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t arc_voltage = analogVal;
+  SREG = sreg;
+  uint8_t blocks_available = plan_get_block_buffer_available();
+  float feed_rate = st_get_realtime_rate();
+  int32_t ln = 0;
+  plan_block_t * cur_block = plan_get_current_block();
+  if (cur_block != NULL) { ln = cur_block->line_number; }
+  uint8_t data = REPORT_BINARY_STATUS_LENGTH;
+
+  report_util_binary_write_byte(REPORT_BINARY_STATUS_START, port);
+  report_util_binary_write(&data, 1, &crc, port);
+  report_util_binary_write(current_position, sizeof(current_position), &crc, port);
+  report_util_binary_write(&sys.state, 1, &crc, port);
+  report_util_binary_write(&arc_voltage, 2, &crc, port);
+  report_util_binary_write(&blocks_available, 1, &crc, port);
+  report_util_binary_write(&feed_rate, 4, &crc, port);
+  report_util_binary_write(&sys.f_override, 1, &crc, port);
+  report_util_binary_write(&sys.r_override, 1, &crc, port);
+  report_util_binary_write(&sys.spindle_speed_ovr, 1, &crc, port);
+  report_util_binary_write(&ln, 4, &crc, port);
+  report_util_binary_write_byte(crc & 0xFF, port);
+  report_util_binary_write_byte(crc >> 8, port);
+}
+
+
+#ifdef ENABLE_TELEMETRY_PORT
+  // Sends the binary status frame to the telemetry port. Dropped, if the port is backed up.
+  void report_telemetry_status()
+  {
+    if (telemetry_begin_frame(REPORT_BINARY_STATUS_LENGTH+4)) {
+      report_realtime_status_binary(REPORT_PORT_TELEMETRY);
+      telemetry_end_frame();
+    }
+  }
+
+
+  // Sends a THC frame to the telemetry port. See report.h for the layout. Called right after a THC
+  // update by protocol_exec_rt_system(), so the sample and the correction always match.
+  void report_telemetry_thc()
+  {
+    if (!telemetry_begin_frame(REPORT_TELEMETRY_THC_LENGTH+4)) { return; }
+    uint16_t crc = 0xFFFF;
+    uint8_t data = REPORT_TELEMETRY_THC_LENGTH;
+    int16_t correction = thc_get_rate()/(THC_RATE_ONE/REPORT_TELEMETRY_THC_RATE_ONE);
+    uint16_t arc_voltage = analogVal;
+    uint16_t set_voltage = analogSetVal;
+    int32_t z_position = st_get_z_position();
+    telemetry_write(REPORT_TELEMETRY_THC_START);
+    report_util_binary_write(&data, 1, &crc, REPORT_PORT_TELEMETRY);
+    report_util_binary_write(&arc_voltage, 2, &crc, REPORT_PORT_TELEMETRY);
+    report_util_binary_write(&set_voltage, 2, &crc, REPORT_PORT_TELEMETRY);
+    report_util_binary_write(&correction, 2, &crc, REPORT_PORT_TELEMETRY);
+    report_util_binary_write(&z_position, 4, &crc, REPORT_PORT_TELEMETRY);
+    telemetry_write(crc & 0xFF);
+    telemetry_write(crc >> 8);
+    telemetry_end_frame();
+  }
+#endif
+
+
  // Prints real-time data. This function grabs a real-time snapshot of the stepper subprogram
  // and the actual location of the CNC machine. Users may change the following function to their
  // specific needs, but the desired real-time data report must be as short as possible. This is
@@ -458,6 +711,13 @@ void report_echo_line_received(char *line)
  // especially during g-code programs with fast, short line segments and high frequency reports (5-20Hz).
 void report_realtime_status()
 {
+  #ifndef ENABLE_XONXOFF // Binary status frames are rejected by $10. Ignores a bit stored before.
+    if (bit_istrue(settings.status_report_mask,BITFLAG_RT_STATUS_BINARY)) {
+      report_realtime_status_binary(REPORT_PORT_SERIAL);
+      return;
+    }
+  #endif
+
   uint8_t idx;
   int32_t current_position[N_AXIS]; // Copy current state of the system position variable
   memcpy(current_position,sys_position,sizeof(sys_position));
@@ -610,12 +870,25 @@ void report_realtime_status()
     }
   #endif
 
-  //THC report
+  #ifdef ENABLE_SD_CARD
+    // SD card job progress in percent of the file read.
+    if (sd_job.state != SD_JOB_IDLE) {
+      printPgmString(PSTR("|SD:"));
+      if (sd_job.file.size) { print_uint8_base10((100.0*sd_job.file.position)/sd_job.file.size); }
+      else { serial_write('0'); }
+    }
+  #endif
+
+  //THC report: set point, arc voltage and torch state (U=raising, D=lowering, H=holding)
   if(thcWorking){
      printPgmString(PSTR("|THC:"));
   print_uint32_base10((uint16_t)analogSetVal);
   serial_write(',');
    print_uint32_base10((uint16_t)analogVal);
+  serial_write(',');
+  if (jog_z_up) { serial_write('U'); }
+  else if (jog_z_down) { serial_write('D'); }
+  else { serial_write('H'); }
   }
  
   serial_write('>');
@@ -627,6 +900,39 @@ void report_realtime_status()
 #ifdef DEBUG
   void report_realtime_debug()
   {
-
+    printPgmString(PSTR("{LAT:"));
+    print_uint32_base10(sys_debug_line_latency);
+    serial_write(',');
+    print_uint32_base10(sys_debug_line_latency_max);
+    printPgmString(PSTR("|PLN:"));
+    print_uint32_base10(sys_debug_plan_count);
+    serial_write(',');
+    print_uint32_base10(sys_debug_plan_ticks);
+    serial_write(',');
+    print_uint8_base10(plan_get_block_buffer_count());
+    serial_write(',');
+    printFloat_CoordValue(plan_get_buffer_millimeters());
+    printPgmString(PSTR("|SEG:"));
+    print_uint32_base10(sys_debug_segment_count);
+    serial_write(',');
+    print_uint32_base10(sys_debug_prep_ticks);
+    printPgmString(PSTR("|RPL:"));
+    print_uint32_base10(sys_debug_replan_blocks);
+    serial_write(',');
+    print_uint32_base10(sys_debug_replan_max);
+    printPgmString(PSTR("|STV:"));
+    print_uint32_base10(sys_debug_starve_count);
+    printPgmString(PSTR("|ISR:"));
+    print_uint32_base10(sys_debug_step_isr_max);
+    #ifdef ENABLE_TELEMETRY_PORT
+      printPgmString(PSTR("|TLM:"));
+      print_uint32_base10(telemetry_get_drop_count());
+    #endif
+    #ifdef ENABLE_SEGMENT_MERGING
+      printPgmString(PSTR("|MRG:"));
+      print_uint32_base10(plan_get_merge_count());
+    #endif
+    serial_write('}');
+    report_util_line_feed();
   }
 #endif
@@ -39,6 +39,8 @@
 #define STATUS_TRAVEL_EXCEEDED 15
 #define STATUS_INVALID_JOG_COMMAND 16
 #define STATUS_SETTING_DISABLED_LASER 17
+#define STATUS_BINARY_FRAME_ERROR 18
+#define STATUS_BAUD_RATE_NOT_CONFIRMED 19
 
 #define STATUS_GCODE_UNSUPPORTED_COMMAND 20
 #define STATUS_GCODE_MODAL_GROUP_VIOLATION 21
@@ -60,6 +62,10 @@
 #define STATUS_GCODE_G43_DYNAMIC_AXIS_ERROR 37
 #define STATUS_GCODE_MAX_VALUE_EXCEEDED 38
 #define STATUS_GCODE_PIN_LOCKED 60              // For command M42 use
+#define STATUS_SD_CARD_FAILED 61
+#define STATUS_SD_FILE_NOT_FOUND 62
+#define STATUS_SD_JOB_ACTIVE 63
+#define STATUS_SD_READ_ERROR 64
 
 // Define Grbl alarm codes. Valid values (1-255). 0 is reserved.
 #define ALARM_HARD_LIMIT_ERROR      EXEC_ALARM_HARD_LIMIT
@@ -90,10 +96,25 @@
 #define MESSAGE_ALARM_OUT_SERVO_X2 17
 #define MESSAGE_ALARM_OUT_SERVO_Y 18
 #define MESSAGE_ALARM_TOURCH_SIGNAL 19
+#define MESSAGE_SD_JOB_DONE 20
+#define MESSAGE_THC_GAIN_LIMITED 21
 
 
 
 
+// Non-critical output, such as feedback messages, settings, and parameter dumps, waits for room in
+// the TX buffer for a full line before each line, while keeping the step segment buffer filled.
+// Status reports and 'ok'/'error' responses are written directly and always sent.
+// The longest such line is the [VER:] line with a full EEPROM build info string, 107 bytes.
+// [HLP:] and the $N startup lines are up to 86 bytes and [GC:] about 80 bytes.
+#ifndef REPORT_TX_LINE_SIZE
+  #define REPORT_TX_LINE_SIZE (EEPROM_LINE_SIZE+28) // Bytes. Must fit the longest non-critical line.
+#endif
+void report_wait_tx_line();
+
+// Prints the feedback messages deferred from interrupts. Called by the main program only.
+void report_deferred_feedback_message();
+
 // Prints system status messages.
 void report_status_message(uint8_t status_code);
 
@@ -118,6 +139,54 @@ void report_echo_line_received(char *line);
 // Prints realtime status report
 void report_realtime_status();
 
+// Compact binary status frame, sent instead of the ASCII status report when bit 2 of the $10 status
+// report mask is set. Layout, all multi-byte values little-endian:
+//   [START][LEN][payload, LEN bytes][CRC16 low][CRC16 high]
+// Payload: int32 sys_position[N_AXIS] in steps, uint8 sys.state, uint16 analogVal (arc voltage),
+//   uint8 planner blocks available, float feed rate (mm/min), uint8 feed, rapid, and spindle
+//   overrides (%), int32 executing line number (0 if none).
+// The CRC is the same CRC-16/CCITT, seeded with 0xFFFF, over LEN and the payload, as used by the
+// binary command frames. Step to position conversion is left to the host, using $100-$102.
+#define REPORT_BINARY_STATUS_START 0xA5
+#define REPORT_BINARY_STATUS_LENGTH (4*N_AXIS+15)
+
+// Destination port of a binary frame.
+#define REPORT_PORT_SERIAL 0
+#define REPORT_PORT_TELEMETRY 1
+
+#ifdef ENABLE_TELEMETRY_PORT
+  // Telemetry port THC frame. Same framing and CRC as the binary status frame. Payload: uint16
+  // analogVal (arc voltage sample), uint16 analogSetVal (voltage setpoint), int16 torch correction
+  // velocity, int32 sys_position[Z_AXIS] in steps. The velocity is in Z steps per Timer2 tick,
+  // scaled by REPORT_TELEMETRY_THC_RATE_ONE, positive raising the torch. One step per tick is the
+  // fastest correction. In mm/min, it is velocity*60e6/(REPORT_TELEMETRY_THC_RATE_ONE*TIMER_TICK_US*$102).
+  #define REPORT_TELEMETRY_THC_START 0xA6
+  #define REPORT_TELEMETRY_THC_LENGTH 10
+  #define REPORT_TELEMETRY_THC_RATE_ONE (THC_RATE_ONE/4) // Keeps one step per tick within int16
+
+  // Sends the binary status frame to the telemetry port. See ENABLE_TELEMETRY_PORT in config.h.
+  void report_telemetry_status();
+
+  // Sends a THC frame to the telemetry port. Called after each THC update while a frame is due.
+  void report_telemetry_thc();
+#endif
+
+#ifdef ENABLE_SD_CARD
+  // Prints an SD card file name and size. Used by `$F`.
+  void report_sd_file(char *name, uint32_t size);
+
+  // Prints the SD card job state, bytes read, file size, lines executed, and file name.
+  void report_sd_job_status();
+#endif
+
+#ifdef ENABLE_RUN_TIME_ESTIMATOR
+  // Prints the check mode run time estimate totals. See ENABLE_RUN_TIME_ESTIMATOR in config.h.
+  void report_run_time_estimate();
+
+  // Prints the estimated time of a line's motions.
+  void report_line_time_estimate(int32_t line_number, float seconds);
+#endif
+
 // Prints recorded probe position
 void report_probe_parameters();
 
@@ -134,6 +203,9 @@ void report_execute_startup_message(char *line, uint8_t status_code);
 // Prints build info and user info
 void report_build_info(char *line);
 
+// Prints serial baud rate, receive error count, and TX stall time
+void report_baud_rate(uint32_t baud_rate);
+
 #ifdef DEBUG
   void report_realtime_debug();
 #endif
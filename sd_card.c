@@ -0,0 +1,256 @@
+/**
+ *  sd_card.c - SD card block device over the SPI port (Mega pins 50-53)
+ *  Implements the SPI mode card initialization and single block reads. The card is read only.
+ *  One block is read ahead into a second buffer. Its read command is sent at once, and its data
+ *  is taken by sd_card_poll() as soon as the card has it, while the main program runs. Waits on the
+ *  card keep the step segment buffer filled and execute realtime commands.
+ * */
+
+#include "grbl.h"
+
+#ifdef ENABLE_SD_CARD
+
+// Card commands
+#define SD_CMD0   0  // GO_IDLE_STATE
+#define SD_CMD8   8  // SEND_IF_COND
+#define SD_CMD16  16 // SET_BLOCKLEN
+#define SD_CMD17  17 // READ_SINGLE_BLOCK
+#define SD_CMD55  55 // APP_CMD
+#define SD_CMD58  58 // READ_OCR
+#define SD_ACMD41 41 // SD_SEND_OP_COND
+
+// Card responses
+#define SD_R1_READY 0x00
+#define SD_R1_IDLE 0x01
+#define SD_DATA_START_TOKEN 0xFE
+
+#define SD_TIMEOUT_TICKS(ms) ((ms*1000UL)/TIMER_TICK_US)
+
+// Read-ahead states
+#define SD_AHEAD_NONE 0
+#define SD_AHEAD_PENDING 1 // Read command sent, card selected. Waiting on the data.
+#define SD_AHEAD_READY 2   // Block data in the read-ahead buffer.
+
+static uint8_t sd_card_block_addressing; // High capacity cards are addressed by block, not by byte.
+
+static uint8_t sd_card_ahead_buffer[SD_CARD_BLOCK_SIZE];
+static uint32_t sd_card_ahead_block;
+static uint8_t sd_card_ahead_state;
+static uint16_t sd_card_ahead_ticks; // Timer2 ticks at the read-ahead command
+
+
+static uint8_t sd_spi_transfer(uint8_t data)
+{
+  SPDR = data;
+  while (!(SPSR & (1<<SPIF))) {}
+  return(SPDR);
+}
+
+
+static void sd_card_select() { SD_SPI_PORT &= ~(1<<SD_CS_BIT); }
+
+
+static void sd_card_deselect()
+{
+  SD_SPI_PORT |= (1<<SD_CS_BIT);
+  sd_spi_transfer(0xFF); // Extra clocks for the card to release MISO.
+}
+
+
+static uint8_t sd_card_timed_out(uint16_t start_ticks, uint16_t timeout_ticks)
+{
+  return((uint16_t)(timer_get_ticks()-start_ticks) > timeout_ticks);
+}
+
+
+// Sends a command and returns its R1 response. Bit 7 is set, if the card didn't respond.
+static uint8_t sd_card_command(uint8_t cmd, uint32_t arg)
+{
+  sd_spi_transfer(0xFF);
+  sd_spi_transfer(0x40 | cmd);
+  sd_spi_transfer(arg >> 24);
+  sd_spi_transfer(arg >> 16);
+  sd_spi_transfer(arg >> 8);
+  sd_spi_transfer(arg);
+  // The CRC is only checked for CMD0 and CMD8 in SPI mode. Both are sent with fixed arguments.
+  if (cmd == SD_CMD0) { sd_spi_transfer(0x95); }
+  else if (cmd == SD_CMD8) { sd_spi_transfer(0x87); }
+  else { sd_spi_transfer(0x01); }
+
+  uint8_t response;
+  uint8_t n = 10;
+  do {
+    response = sd_spi_transfer(0xFF);
+  } while ((response & 0x80) && --n);
+  return(response);
+}
+
+
+static uint8_t sd_card_app_command(uint8_t cmd, uint32_t arg)
+{
+  sd_card_command(SD_CMD55, 0);
+  return(sd_card_command(cmd, arg));
+}
+
+
+// Brings the card from power up into the data transfer state. Card must be selected.
+static uint8_t sd_card_start()
+{
+  uint16_t start_ticks = timer_get_ticks();
+  while (sd_card_command(SD_CMD0, 0) != SD_R1_IDLE) {
+    if (sd_card_timed_out(start_ticks, SD_TIMEOUT_TICKS(SD_CARD_INIT_TIMEOUT))) { return(false); }
+  }
+
+  uint32_t op_cond = 0;
+  if (sd_card_command(SD_CMD8, 0x1AA) == SD_R1_IDLE) {
+    // Version 2 card. Check the echoed voltage range and check pattern.
+    uint8_t r7[4];
+    uint8_t idx;
+    for (idx=0; idx<4; idx++) { r7[idx] = sd_spi_transfer(0xFF); }
+    if (((r7[2] & 0x0F) != 0x01) || (r7[3] != 0xAA)) { return(false); }
+    op_cond = 0x40000000; // Host supports high capacity cards.
+  }
+
+  while (sd_card_app_command(SD_ACMD41, op_cond) != SD_R1_READY) {
+    if (sd_card_timed_out(start_ticks, SD_TIMEOUT_TICKS(SD_CARD_INIT_TIMEOUT))) { return(false); }
+  }
+
+  sd_card_block_addressing = false;
+  if (op_cond) {
+    if (sd_card_command(SD_CMD58, 0) != SD_R1_READY) { return(false); }
+    if (sd_spi_transfer(0xFF) & 0x40) { sd_card_block_addressing = true; } // OCR CCS bit.
+    sd_spi_transfer(0xFF);
+    sd_spi_transfer(0xFF);
+    sd_spi_transfer(0xFF);
+  }
+  if (!sd_card_block_addressing) {
+    if (sd_card_command(SD_CMD16, SD_CARD_BLOCK_SIZE) != SD_R1_READY) { return(false); }
+  }
+  return(true);
+}
+
+
+uint8_t sd_card_init()
+{
+  sd_card_ahead_state = SD_AHEAD_NONE;
+  SD_SPI_DDR |= ((1<<SD_CS_BIT)|(1<<SD_SCK_BIT)|(1<<SD_MOSI_BIT));
+  SD_SPI_DDR &= ~(1<<SD_MISO_BIT);
+  SD_SPI_PORT |= ((1<<SD_CS_BIT)|(1<<SD_MISO_BIT)); // Deselect card. Pull-up on MISO.
+
+  // Cards must be initialized with a 100-400kHz clock. Set 125kHz (f/128), SPI mode 0.
+  SPCR = ((1<<SPE)|(1<<MSTR)|(1<<SPR1)|(1<<SPR0));
+  SPSR &= ~(1<<SPI2X);
+
+  uint8_t idx;
+  for (idx=0; idx<10; idx++) { sd_spi_transfer(0xFF); } // At least 74 clocks with the card deselected.
+
+  sd_card_select();
+  uint8_t status = sd_card_start();
+  sd_card_deselect();
+
+  // Full speed 8MHz (f/2) clock for data transfers.
+  SPCR = ((1<<SPE)|(1<<MSTR));
+  SPSR |= (1<<SPI2X);
+  return(status);
+}
+
+
+// Keeps the machine running while waiting on the card. Like report_wait_tx_line(), but the
+// suspend loop of protocol_execute_realtime() is not entered, so a feed hold can't hold up the card
+// past its timeout.
+static void sd_card_wait()
+{
+  if (!protocol_is_executing_realtime()) {
+    protocol_exec_rt_system(); // Fills the step segment buffer too.
+  } else if (sys.state & (STATE_CYCLE | STATE_HOLD | STATE_SAFETY_DOOR | STATE_HOMING | STATE_SLEEP| STATE_JOG)) {
+    st_prep_buffer();
+  }
+}
+
+
+// Sends the read command of a block and selects the card. Returns true, if the card accepted it.
+static uint8_t sd_card_read_command(uint32_t block)
+{
+  if (!sd_card_block_addressing) { block <<= 9; } // Byte address
+  sd_card_select();
+  if (sd_card_command(SD_CMD17, block) == SD_R1_READY) { return(true); }
+  sd_card_deselect();
+  return(false);
+}
+
+
+// Reads the block data of a read command into buf and deselects the card. With is_waiting false,
+// returns at once, if the card isn't ready. Returns the SD_DATA_START_TOKEN, if the data was read,
+// 0xFF, if the card isn't ready, or the error token.
+static uint8_t sd_card_read_data(uint8_t *buf, uint16_t start_ticks, uint8_t is_waiting)
+{
+  uint8_t token;
+  while ((token = sd_spi_transfer(0xFF)) == 0xFF) {
+    if (sd_card_timed_out(start_ticks, SD_TIMEOUT_TICKS(SD_CARD_READ_TIMEOUT))) { token = 0; break; }
+    if (!is_waiting) { return(0xFF); }
+    sd_card_wait();
+    if (sys.abort) { token = 0; break; }
+  }
+  if (token == SD_DATA_START_TOKEN) {
+    uint16_t idx;
+    for (idx=0; idx<SD_CARD_BLOCK_SIZE; idx++) { buf[idx] = sd_spi_transfer(0xFF); }
+    sd_spi_transfer(0xFF); // CRC not checked.
+    sd_spi_transfer(0xFF);
+  }
+  sd_card_deselect();
+  return(token);
+}
+
+
+void sd_card_poll()
+{
+  if (sd_card_ahead_state != SD_AHEAD_PENDING) { return; }
+  uint8_t token = sd_card_read_data(sd_card_ahead_buffer, sd_card_ahead_ticks, false);
+  if (token == SD_DATA_START_TOKEN) { sd_card_ahead_state = SD_AHEAD_READY; }
+  else if (token != 0xFF) { sd_card_ahead_state = SD_AHEAD_NONE; } // Read again on demand.
+}
+
+
+void sd_card_read_ahead(uint32_t block)
+{
+  if ((sd_card_ahead_state != SD_AHEAD_NONE) && (sd_card_ahead_block == block)) { return; }
+  if (sd_card_ahead_state == SD_AHEAD_PENDING) { return; } // One read at a time. Taken on demand.
+  sd_card_ahead_state = SD_AHEAD_NONE;
+  if (sd_card_read_command(block)) {
+    sd_card_ahead_block = block;
+    sd_card_ahead_ticks = timer_get_ticks();
+    sd_card_ahead_state = SD_AHEAD_PENDING;
+  }
+}
+
+
+uint8_t sd_card_read_block(uint32_t block, uint8_t *buf)
+{
+  // The card takes one command at a time. Finish a pending read-ahead first.
+  if (sd_card_ahead_state == SD_AHEAD_PENDING) {
+    if (sd_card_read_data(sd_card_ahead_buffer, sd_card_ahead_ticks, true) == SD_DATA_START_TOKEN) {
+      sd_card_ahead_state = SD_AHEAD_READY;
+    } else {
+      sd_card_ahead_state = SD_AHEAD_NONE;
+    }
+  }
+  if ((sd_card_ahead_state == SD_AHEAD_READY) && (sd_card_ahead_block == block)) {
+    memcpy(buf, sd_card_ahead_buffer, SD_CARD_BLOCK_SIZE);
+    sd_card_ahead_state = SD_AHEAD_NONE;
+    return(true);
+  }
+  if (!sd_card_read_command(block)) { return(false); }
+  return(sd_card_read_data(buf, timer_get_ticks(), true) == SD_DATA_START_TOKEN);
+}
+
+
+// Block device read for the FAT reader.
+uint8_t fat_block_read(uint32_t block, uint8_t *buf)
+{
+  return(sd_card_read_block(block, buf));
+}
+
+
+void fat_block_read_ahead(uint32_t block) { sd_card_read_ahead(block); }
+
+#endif
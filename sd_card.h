@@ -0,0 +1,19 @@
+/**
+ *  sd_card.h - SD card block device over the SPI port (Mega pins 50-53)
+ * */
+
+#ifndef sd_card_h
+#define sd_card_h
+
+        #define SD_CARD_BLOCK_SIZE 512
+
+        // Card timeouts in msec
+        #define SD_CARD_INIT_TIMEOUT 1000
+        #define SD_CARD_READ_TIMEOUT 100
+
+        uint8_t sd_card_init();                                 // Initialize card. Returns true on success.
+        uint8_t sd_card_read_block(uint32_t block, uint8_t *buf); // Read one 512 byte block. Returns true on success.
+        void sd_card_read_ahead(uint32_t block);                // Start reading a block into the read-ahead buffer
+        void sd_card_poll();                                    // Take the read-ahead block data, if the card has it
+
+#endif
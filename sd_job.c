@@ -0,0 +1,111 @@
+/**
+ *  sd_job.c - G-code job playback from the SD card
+ *  Job lines are fed into the protocol main loop in place of serial lines. They are executed like
+ *  streamed lines, but 'ok' is not sent for them. A line error stops the job.
+ * */
+
+#include "grbl.h"
+
+#ifdef ENABLE_SD_CARD
+
+sd_job_t sd_job;
+static uint8_t sd_job_cr; // Last character read was '\r'.
+
+
+static uint8_t sd_job_mount()
+{
+  if (!sd_card_init() || !fat_mount()) { return(STATUS_SD_CARD_FAILED); }
+  return(STATUS_OK);
+}
+
+
+uint8_t sd_job_list()
+{
+  // Remount only between jobs. The card may have been swapped.
+  if (sd_job.state == SD_JOB_IDLE) {
+    uint8_t status = sd_job_mount();
+    if (status) { return(status); }
+  }
+  char name[FAT_NAME_SIZE];
+  uint32_t size;
+  uint16_t index = 0;
+  while (fat_dir_next(&index, name, &size)) { report_sd_file(name, size); }
+  return(STATUS_OK);
+}
+
+
+uint8_t sd_job_start(char *name)
+{
+  if (sd_job.state != SD_JOB_IDLE) { return(STATUS_SD_JOB_ACTIVE); }
+  if (sys.state & ~STATE_CHECK_MODE) { return(STATUS_IDLE_ERROR); } // Idle or check mode only.
+  if (strlen(name) >= FAT_NAME_SIZE) { return(STATUS_SD_FILE_NOT_FOUND); }
+  uint8_t status = sd_job_mount();
+  if (status) { return(status); }
+  if (!fat_open(&sd_job.file, name)) { return(STATUS_SD_FILE_NOT_FOUND); }
+  strcpy(sd_job.name, name);
+  sd_job.line_count = 0;
+  sd_job.error = STATUS_OK;
+  sd_job_cr = false;
+  sd_job.state = SD_JOB_RUNNING;
+  return(STATUS_OK);
+}
+
+
+uint8_t sd_job_pause()
+{
+  if (sd_job.state != SD_JOB_RUNNING) { return(STATUS_INVALID_STATEMENT); }
+  sd_job.state = SD_JOB_PAUSED;
+  return(STATUS_OK);
+}
+
+
+uint8_t sd_job_resume()
+{
+  if (sd_job.state != SD_JOB_PAUSED) { return(STATUS_INVALID_STATEMENT); }
+  sd_job.state = SD_JOB_RUNNING;
+  return(STATUS_OK);
+}
+
+
+void sd_job_stop() { sd_job.state = SD_JOB_IDLE; }
+
+
+// NOTE: Called only for lines started while the job was running. A pause takes effect at the
+// next line, so a line is always read whole.
+uint8_t sd_job_read()
+{
+  if (sd_job.state == SD_JOB_END) { return('\n'); }
+  sd_card_poll(); // Takes the read-ahead block, once the card has it.
+  int16_t c = fat_read(&sd_job.file);
+  // The line already ended at the '\r' of a CRLF line end. Skip the '\n', so it doesn't read as
+  // another, empty line.
+  if ((c == '\n') && sd_job_cr) { c = fat_read(&sd_job.file); }
+  sd_job_cr = (c == '\r');
+  if (c < 0) {
+    // Terminate the last line, if the file doesn't end with one.
+    if (c == FAT_ERROR) { sd_job.error = STATUS_SD_READ_ERROR; }
+    sd_job.state = SD_JOB_END;
+    return('\n');
+  }
+  // Non-ASCII bytes are never valid g-code. Blank them, since SERIAL_NO_DATA would end the line
+  // read and CMD_BINARY_FRAME would start a binary frame.
+  if (c & 0x80) { return(' '); }
+  return(c);
+}
+
+
+void sd_job_line_done(uint8_t status)
+{
+  sd_job.line_count++;
+  if (status == STATUS_OK) { status = sd_job.error; }
+  if (status) {
+    sd_job.state = SD_JOB_IDLE;
+    report_status_message(status);
+    report_sd_job_status(); // Shows the failed line.
+  } else if (sd_job.state == SD_JOB_END) {
+    sd_job.state = SD_JOB_IDLE;
+    report_feedback_message(MESSAGE_SD_JOB_DONE);
+  }
+}
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ *  sd_job.h - G-code job playback from the SD card
+ * */
+
+#ifndef sd_job_h
+#define sd_job_h
+
+        // Job states
+        #define SD_JOB_IDLE 0
+        #define SD_JOB_RUNNING 1
+        #define SD_JOB_PAUSED 2
+        #define SD_JOB_END 3        // File read through. Last line executing.
+
+        typedef struct {
+          uint8_t state;
+          uint8_t error;            // Read error status, reported after the last line.
+          uint32_t line_count;      // Lines executed
+          char name[FAT_NAME_SIZE];
+          fat_file_t file;
+        } sd_job_t;
+        extern sd_job_t sd_job;
+
+        uint8_t sd_job_list();                   // List card files. ($F)
+        uint8_t sd_job_start(char *name);        // Start job from named file. ($F=name)
+        uint8_t sd_job_pause();                  // Stop feeding lines at the next line. ($FP)
+        uint8_t sd_job_resume();                 // Resume feeding lines. ($FR)
+        void sd_job_stop();                      // Abandon job. Called upon reset.
+        uint8_t sd_job_read();                   // Next job line character. Called by protocol main loop.
+        void sd_job_line_done(uint8_t status);   // Report job line result. Called by protocol main loop.
+
+#endif
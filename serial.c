@@ -32,6 +32,34 @@ uint8_t serial_tx_buffer[TX_RING_BUFFER];
 uint8_t serial_tx_buffer_head = 0;
 volatile uint8_t serial_tx_buffer_tail = 0;
 
+volatile uint16_t serial_rx_error_count = 0; // Framing errors, data overruns and dropped frame bytes. Saturates.
+uint32_t serial_tx_stall_ticks = 0; // Time blocked on a full TX buffer. Main program only.
+
+#ifdef SERIAL_RX_FLOW_CONTROL
+  static volatile uint8_t serial_rx_flow = SERIAL_FLOW_ON;
+#endif
+
+#ifdef ENABLE_TELEMETRY_PORT
+  #define TELEMETRY_RING_BUFFER (TELEMETRY_TX_BUFFER_SIZE+1)
+  uint8_t telemetry_tx_buffer[TELEMETRY_RING_BUFFER];
+  uint8_t telemetry_tx_buffer_head = 0;
+  volatile uint8_t telemetry_tx_buffer_tail = 0;
+  static volatile uint8_t telemetry_frame_busy = false; // Set while a frame is being written.
+  static volatile uint16_t telemetry_drop_count = 0; // Dropped frames. Saturates.
+#endif
+
+#ifdef ENABLE_BINARY_FRAMING
+  #define SERIAL_FRAME_LENGTH_PENDING 0xFFFF
+  static uint16_t serial_rx_frame_remaining = 0; // Binary frame bytes left to pass through. RX ISR only.
+  static uint16_t serial_rx_frame_stored;        // Bytes of the frame in the buffer. RX ISR only.
+  static uint8_t serial_rx_dropping = false;     // Dropping data after a short frame. RX ISR only.
+  static volatile uint8_t serial_rx_frame_count = 0; // Frames stored. Wraps.
+  static uint8_t serial_rx_frame_read_count = 0;     // Frames read. Main program only.
+  // The frame count and length in the buffer of the last frame stored short. Zero length when none.
+  static volatile uint8_t serial_rx_short_frame;
+  static volatile uint16_t serial_rx_short_frame_length = 0;
+#endif
+
 
 // Returns the number of bytes available in the RX serial buffer.
 uint8_t serial_get_rx_buffer_available()
@@ -62,18 +90,71 @@ uint8_t serial_get_tx_buffer_count()
 }
 
 
-void serial_init()
+// Returns the number of receive framing errors and data overruns since the last reset.
+uint16_t serial_get_rx_error_count()
+{
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t count = serial_rx_error_count;
+  SREG = sreg;
+  return(count);
+}
+
+
+void serial_reset_rx_error_count()
 {
-  // Set baud rate
-  #if BAUD_RATE < 57600
-    uint16_t UBRR0_value = ((F_CPU / (8L * BAUD_RATE)) - 1)/2 ;
+  uint8_t sreg = SREG;
+  cli();
+  serial_rx_error_count = 0;
+  SREG = sreg;
+}
+
+
+// Returns true, if the baud rate is one of the rates supported by the `$B=` command. These are within
+// about 2% at 16MHz. 230400 is 3.5% slow and is left out.
+uint8_t serial_check_baud_rate(uint32_t baud_rate)
+{
+  switch (baud_rate) {
+    case 115200: case 250000: case 500000: case 1000000: return(true);
+  }
+  return(false);
+}
+
+
+void serial_set_baud_rate(uint32_t baud_rate)
+{
+  uint16_t UBRR0_value;
+  if (baud_rate < 57600) {
+    UBRR0_value = ((F_CPU / (8L * baud_rate)) - 1)/2 ;
     UCSR0A &= ~(1 << U2X0); // baud doubler off  - Only needed on Uno XXX
-  #else
-    uint16_t UBRR0_value = ((F_CPU / (4L * BAUD_RATE)) - 1)/2;
+  } else {
+    UBRR0_value = ((F_CPU / (4L * baud_rate)) - 1)/2;
     UCSR0A |= (1 << U2X0);  // baud doubler on for high baud rates, i.e. 115200
-  #endif
+  }
   UBRR0H = UBRR0_value >> 8;
   UBRR0L = UBRR0_value;
+}
+
+
+// Returns the number of bytes available in the TX serial buffer.
+uint8_t serial_get_tx_buffer_available()
+{
+  return(TX_BUFFER_SIZE - serial_get_tx_buffer_count());
+}
+
+
+uint32_t serial_get_tx_stall_ticks() { return(serial_tx_stall_ticks); }
+
+
+void serial_init()
+{
+  // Set power-up baud rate. Switched to the stored rate, if any, once settings are loaded.
+  serial_set_baud_rate(BAUD_RATE);
+
+  #ifdef ENABLE_RTS_FLOW_CONTROL
+    SERIAL_RTS_PORT &= ~(1<<SERIAL_RTS_BIT); // Ready to receive.
+    SERIAL_RTS_DDR |= (1<<SERIAL_RTS_BIT);
+  #endif
 
   // enable rx, tx, and interrupt on complete reception of a byte
   UCSR0B |= (1<<RXEN0 | 1<<TXEN0 | 1<<RXCIE0);
@@ -82,6 +163,90 @@ void serial_init()
 }
 
 
+#ifdef ENABLE_TELEMETRY_PORT
+  void telemetry_init()
+  {
+    uint16_t UBRR_value;
+    if (TELEMETRY_BAUD_RATE < 57600) {
+      UBRR_value = ((F_CPU / (8L * TELEMETRY_BAUD_RATE)) - 1)/2 ;
+      TELEMETRY_UCSRA &= ~(1 << TELEMETRY_U2X);
+    } else {
+      UBRR_value = ((F_CPU / (4L * TELEMETRY_BAUD_RATE)) - 1)/2;
+      TELEMETRY_UCSRA |= (1 << TELEMETRY_U2X);
+    }
+    TELEMETRY_UBRRH = UBRR_value >> 8;
+    TELEMETRY_UBRRL = UBRR_value;
+
+    // Enable tx only. Defaults to 8-bit, no parity, 1 stop bit.
+    TELEMETRY_UCSRB |= (1<<TELEMETRY_TXEN);
+  }
+
+
+  // NOTE: Frames are written by the main program and by the Timer2 interrupt. The busy flag keeps
+  // an interrupt from writing into the middle of a main program frame. The interrupt can't be
+  // preempted by the main program, so its frames are always whole.
+  uint8_t telemetry_begin_frame(uint8_t n)
+  {
+    if (!telemetry_frame_busy) {
+      telemetry_frame_busy = true;
+      uint8_t ttail = telemetry_tx_buffer_tail; // Copy to limit multiple calls to volatile
+      uint8_t available;
+      if (telemetry_tx_buffer_head >= ttail) { available = TELEMETRY_TX_BUFFER_SIZE - (telemetry_tx_buffer_head-ttail); }
+      else { available = ttail-telemetry_tx_buffer_head-1; }
+      if (available >= n) { return(true); }
+      telemetry_frame_busy = false;
+    }
+    if (telemetry_drop_count < 0xFFFF) { telemetry_drop_count++; }
+    return(false);
+  }
+
+
+  void telemetry_write(uint8_t data)
+  {
+    uint8_t next_head = telemetry_tx_buffer_head + 1;
+    if (next_head == TELEMETRY_RING_BUFFER) { next_head = 0; }
+    telemetry_tx_buffer[telemetry_tx_buffer_head] = data;
+    telemetry_tx_buffer_head = next_head;
+  }
+
+
+  void telemetry_end_frame()
+  {
+    uint8_t sreg = SREG;
+    cli();
+    telemetry_frame_busy = false;
+    TELEMETRY_UCSRB |= (1 << TELEMETRY_UDRIE);
+    SREG = sreg;
+  }
+
+
+  uint16_t telemetry_get_drop_count()
+  {
+    uint8_t sreg = SREG;
+    cli();
+    uint16_t count = telemetry_drop_count;
+    SREG = sreg;
+    return(count);
+  }
+
+
+  // Telemetry Data Register Empty Interrupt handler
+  ISR(TELEMETRY_UDRE)
+  {
+    uint8_t tail = telemetry_tx_buffer_tail; // Temporary telemetry_tx_buffer_tail (to optimize for volatile)
+    if (tail == telemetry_tx_buffer_head) { // Already sent. Enabled again after the frame drained.
+      TELEMETRY_UCSRB &= ~(1 << TELEMETRY_UDRIE);
+      return;
+    }
+    TELEMETRY_UDR = telemetry_tx_buffer[tail];
+    tail++;
+    if (tail == TELEMETRY_RING_BUFFER) { tail = 0; }
+    telemetry_tx_buffer_tail = tail;
+    if (tail == telemetry_tx_buffer_head) { TELEMETRY_UCSRB &= ~(1 << TELEMETRY_UDRIE); }
+  }
+#endif
+
+
 // Writes one byte to the TX serial buffer. Called by main program.
 void serial_write(uint8_t data) {
   // Calculate next head
@@ -89,9 +254,15 @@ void serial_write(uint8_t data) {
   if (next_head == TX_RING_BUFFER) { next_head = 0; }
 
   // Wait until there is space in the buffer
-  while (next_head == serial_tx_buffer_tail) {
-    // TODO: Restructure st_prep_buffer() calls to be executed here during a long print.
-    if (sys_rt_exec_state & EXEC_RESET) { return; } // Only check for abort to avoid an endless loop.
+  if (next_head == serial_tx_buffer_tail) {
+    // NOTE: Non-critical output waits for room before writing. See report_wait_tx_line().
+    uint16_t stall_ticks = timer_get_ticks();
+    while (next_head == serial_tx_buffer_tail) {
+      // TODO: Restructure st_prep_buffer() calls to be executed here during a long print.
+      if (sys_rt_exec_state & EXEC_RESET) { break; } // Only check for abort to avoid an endless loop.
+    }
+    serial_tx_stall_ticks += (uint16_t)(timer_get_ticks()-stall_ticks);
+    if (next_head == serial_tx_buffer_tail) { return; } // Aborted.
   }
 
   // Store data and advance head
@@ -108,6 +279,25 @@ ISR(SERIAL_UDRE)
 {
   uint8_t tail = serial_tx_buffer_tail; // Temporary serial_tx_buffer_tail (to optimize for volatile)
 
+  #ifdef ENABLE_XONXOFF
+    // Send a pending flow control character ahead of the buffer.
+    if (serial_rx_flow >= SERIAL_FLOW_SEND_XOFF) {
+      if (serial_rx_flow == SERIAL_FLOW_SEND_XOFF) {
+        UDR0 = XOFF_CHAR;
+        serial_rx_flow = SERIAL_FLOW_OFF;
+      } else {
+        UDR0 = XON_CHAR;
+        serial_rx_flow = SERIAL_FLOW_ON;
+      }
+      if (tail == serial_tx_buffer_head) { UCSR0B &= ~(1 << UDRIE0); }
+      return;
+    }
+    if (tail == serial_tx_buffer_head) { // Enabled for a flow control character, which was cancelled.
+      UCSR0B &= ~(1 << UDRIE0);
+      return;
+    }
+  #endif
+
   // Send a byte from the buffer
   UDR0 = serial_tx_buffer[tail];
 
@@ -122,6 +312,41 @@ ISR(SERIAL_UDRE)
 }
 
 
+#ifdef SERIAL_RX_FLOW_CONTROL
+  // Stops the host from sending. Called by RX ISR only.
+  static inline void serial_rx_flow_stop()
+  {
+    #ifdef ENABLE_XONXOFF
+      serial_rx_flow = SERIAL_FLOW_SEND_XOFF;
+      UCSR0B |= (1 << UDRIE0);
+    #else
+      SERIAL_RTS_PORT |= (1<<SERIAL_RTS_BIT);
+      serial_rx_flow = SERIAL_FLOW_OFF;
+    #endif
+  }
+
+
+  // Lets a stopped host send again. Called by main program.
+  static void serial_rx_flow_resume()
+  {
+    uint8_t sreg = SREG;
+    cli();
+    if (serial_rx_flow == SERIAL_FLOW_OFF) {
+      #ifdef ENABLE_XONXOFF
+        serial_rx_flow = SERIAL_FLOW_SEND_XON;
+        UCSR0B |= (1 << UDRIE0);
+      #else
+        SERIAL_RTS_PORT &= ~(1<<SERIAL_RTS_BIT);
+        serial_rx_flow = SERIAL_FLOW_ON;
+      #endif
+    } else if (serial_rx_flow == SERIAL_FLOW_SEND_XOFF) {
+      serial_rx_flow = SERIAL_FLOW_ON; // XOFF not sent yet. Cancel it.
+    }
+    SREG = sreg;
+  }
+#endif
+
+
 // Fetches the first byte in the serial read buffer. Called by main program.
 uint8_t serial_read()
 {
@@ -135,15 +360,116 @@ uint8_t serial_read()
     if (tail == RX_RING_BUFFER) { tail = 0; }
     serial_rx_buffer_tail = tail;
 
+    #ifdef SERIAL_RX_FLOW_CONTROL
+      if ((serial_rx_flow != SERIAL_FLOW_ON) && (serial_get_rx_buffer_count() <= SERIAL_RX_FLOW_LOW)) {
+        serial_rx_flow_resume();
+      }
+    #endif
+
     return data;
   }
 }
 
 
+// Writes one byte to the RX serial buffer, unless it is full. Returns false, if full. Called by RX
+// ISR only.
+static inline uint8_t serial_rx_buffer_store(uint8_t data)
+{
+  uint8_t tail = serial_rx_buffer_tail; // Copy to limit multiple calls to volatile
+  uint8_t next_head = serial_rx_buffer_head + 1;
+  if (next_head == RX_RING_BUFFER) { next_head = 0; }
+
+  // Write data to buffer unless it is full.
+  if (next_head != tail) {
+    serial_rx_buffer[serial_rx_buffer_head] = data;
+    serial_rx_buffer_head = next_head;
+
+    #ifdef SERIAL_RX_FLOW_CONTROL
+      // Stop the host at the high watermark. Also replaces a pending XON.
+      if ((serial_rx_flow == SERIAL_FLOW_ON) || (serial_rx_flow == SERIAL_FLOW_SEND_XON)) {
+        uint8_t count;
+        if (next_head >= tail) { count = next_head-tail; }
+        else { count = RX_RING_BUFFER - (tail-next_head); }
+        if (count >= SERIAL_RX_FLOW_HIGH) { serial_rx_flow_stop(); }
+      }
+    #endif
+    return(true);
+  }
+  return(false);
+}
+
+
+#ifdef ENABLE_BINARY_FRAMING
+  // Writes one binary frame byte to the RX serial buffer. Once a byte doesn't fit, the rest of the
+  // frame and any data after it are dropped and counted, until the protocol has read the stored part
+  // of the frame. See serial_rx_frame_is_short(). Called by RX ISR only.
+  static void serial_rx_frame_store(uint8_t data)
+  {
+    if (!serial_rx_dropping) {
+      if (serial_rx_buffer_store(data)) {
+        if (!serial_rx_frame_stored) { serial_rx_frame_count++; } // Frame start
+        serial_rx_frame_stored++;
+        return;
+      }
+      serial_rx_dropping = true;
+      if (serial_rx_frame_stored) { // Frame start stored. Flag the frame for the protocol.
+        serial_rx_short_frame = serial_rx_frame_count;
+        serial_rx_short_frame_length = serial_rx_frame_stored;
+      }
+    }
+    if (serial_rx_error_count < 0xFFFF) { serial_rx_error_count++; }
+  }
+
+
+  void serial_rx_frame_begin() { serial_rx_frame_read_count++; }
+
+
+  uint8_t serial_rx_frame_is_short(uint16_t n)
+  {
+    uint8_t is_short = false;
+    uint8_t sreg = SREG;
+    cli();
+    if (serial_rx_short_frame_length && (serial_rx_short_frame == serial_rx_frame_read_count) &&
+        (n >= serial_rx_short_frame_length)) {
+      serial_rx_short_frame_length = 0; // The RX ISR resyncs at the next frame or line.
+      is_short = true;
+    }
+    SREG = sreg;
+    return(is_short);
+  }
+#endif
+
+
 ISR(SERIAL_RX)
 {
+  // NOTE: Error flags are only valid until UDR0 is read. Check them first.
+  if (UCSR0A & ((1<<FE0)|(1<<DOR0))) {
+    if (serial_rx_error_count < 0xFFFF) { serial_rx_error_count++; }
+  }
   uint8_t data = UDR0;
-  uint8_t next_head;
+
+  #ifdef ENABLE_BINARY_FRAMING
+    // Pass binary frame bytes directly into the buffer. Realtime command characters are not picked
+    // off inside of a frame, since they may be part of the frame's float data.
+    if (serial_rx_frame_remaining) {
+      if (serial_rx_frame_remaining == SERIAL_FRAME_LENGTH_PENDING) {
+        serial_rx_frame_remaining = data+2; // Payload length plus two CRC bytes.
+      } else {
+        serial_rx_frame_remaining--;
+      }
+      serial_rx_frame_store(data);
+      return;
+    }
+    // After a short frame, resync at the next frame or at the end of the next line, once the
+    // protocol has read the short frame. Realtime commands are still picked off.
+    if (serial_rx_dropping && !serial_rx_short_frame_length) {
+      if ((data == '\n') || (data == '\r')) {
+        serial_rx_dropping = false;
+        return;
+      }
+      if (data == CMD_BINARY_FRAME) { serial_rx_dropping = false; }
+    }
+  #endif
 
   // Pick off realtime command characters directly from the serial stream. These characters are
   // not passed into the main buffer, but these set system state flag bits for realtime execution.
@@ -182,17 +508,23 @@ ISR(SERIAL_RX)
           case CMD_SPINDLE_OVR_STOP: system_set_exec_accessory_override_flag(EXEC_SPINDLE_OVR_STOP); break;
           case CMD_COOLANT_FLOOD_OVR_TOGGLE: system_set_exec_accessory_override_flag(EXEC_COOLANT_FLOOD_OVR_TOGGLE); break;
           case CMD_COOLANT_MIST_OVR_TOGGLE: system_set_exec_accessory_override_flag(EXEC_COOLANT_MIST_OVR_TOGGLE); break;
+          #ifdef ENABLE_BINARY_FRAMING
+            case CMD_BINARY_FRAME: // Start of frame. Passed to the buffer for the protocol to decode.
+              serial_rx_frame_remaining = SERIAL_FRAME_LENGTH_PENDING;
+              serial_rx_frame_stored = 0;
+              serial_rx_frame_store(data);
+              break;
+          #endif
         }
         // Throw away any unfound extended-ASCII character by not passing it to the serial buffer.
       } else { // Write character to buffer
-        next_head = serial_rx_buffer_head + 1;
-        if (next_head == RX_RING_BUFFER) { next_head = 0; }
-
-        // Write data to buffer unless it is full.
-        if (next_head != serial_rx_buffer_tail) {
-          serial_rx_buffer[serial_rx_buffer_head] = data;
-          serial_rx_buffer_head = next_head;
-        }
+        #ifdef ENABLE_BINARY_FRAMING
+          if (serial_rx_dropping) {
+            if (serial_rx_error_count < 0xFFFF) { serial_rx_error_count++; }
+            return;
+          }
+        #endif
+        serial_rx_buffer_store(data);
       }
   }
 }
@@ -200,5 +532,19 @@ ISR(SERIAL_RX)
 
 void serial_reset_read_buffer()
 {
-  serial_rx_buffer_tail = serial_rx_buffer_head;
+  #ifdef ENABLE_BINARY_FRAMING
+    // Drop the rest of a frame being received. Its start is gone.
+    uint8_t sreg = SREG;
+    cli();
+    serial_rx_buffer_tail = serial_rx_buffer_head;
+    serial_rx_dropping = (serial_rx_frame_remaining != 0);
+    serial_rx_short_frame_length = 0;
+    serial_rx_frame_read_count = serial_rx_frame_count;
+    SREG = sreg;
+  #else
+    serial_rx_buffer_tail = serial_rx_buffer_head;
+  #endif
+  #ifdef SERIAL_RX_FLOW_CONTROL
+    serial_rx_flow_resume();
+  #endif
 }
@@ -32,9 +32,50 @@
 
 #define SERIAL_NO_DATA 0xff
 
+#if defined(ENABLE_XONXOFF) || defined(ENABLE_RTS_FLOW_CONTROL)
+  #define SERIAL_RX_FLOW_CONTROL
+
+  // RX buffer flow control watermarks in bytes. The host is stopped once the RX buffer holds
+  // SERIAL_RX_FLOW_HIGH bytes and resumed once it has been read down to SERIAL_RX_FLOW_LOW. The
+  // room above the high watermark takes what the host and its USB-serial chip send before stopping.
+  #ifndef SERIAL_RX_FLOW_HIGH
+    #define SERIAL_RX_FLOW_HIGH (RX_BUFFER_SIZE-64)
+  #endif
+  #ifndef SERIAL_RX_FLOW_LOW
+    #define SERIAL_RX_FLOW_LOW (RX_BUFFER_SIZE/2)
+  #endif
+
+  #define XON_CHAR 0x11
+  #define XOFF_CHAR 0x13
+
+  // Flow control states
+  #define SERIAL_FLOW_ON 0
+  #define SERIAL_FLOW_OFF 1
+  #define SERIAL_FLOW_SEND_XOFF 2 // XON/XOFF only. Pending flow control character.
+  #define SERIAL_FLOW_SEND_XON 3
+#endif
+
+// Time in milliseconds the host has to confirm a new baud rate with `$B`, before reverting.
+#ifndef SERIAL_BAUD_CONFIRM_TIMEOUT
+  #define SERIAL_BAUD_CONFIRM_TIMEOUT 2000
+#endif
+
 
 void serial_init();
 
+// Sets the serial baud rate. The U2X double speed mode is used for 57600 baud and up.
+void serial_set_baud_rate(uint32_t baud_rate);
+
+// Returns true, if the baud rate is one of the rates supported by the `$B=` command.
+uint8_t serial_check_baud_rate(uint32_t baud_rate);
+
+// Returns the number of receive framing errors and data overruns since the last reset. Binary
+// frame bytes dropped on a full RX buffer are counted too.
+uint16_t serial_get_rx_error_count();
+
+// Resets the receive framing error and data overrun count.
+void serial_reset_rx_error_count();
+
 // Writes one byte to the TX serial buffer. Called by main program.
 void serial_write(uint8_t data);
 
@@ -51,8 +92,48 @@ uint8_t serial_get_rx_buffer_available();
 // NOTE: Deprecated. Not used unless classic status reports are enabled in config.h.
 uint8_t serial_get_rx_buffer_count();
 
+#ifdef ENABLE_BINARY_FRAMING
+  // Counts a binary frame as being read. Called by the protocol upon reading CMD_BINARY_FRAME.
+  void serial_rx_frame_begin();
+
+  // Returns true once, if the RX ISR dropped the rest of the frame being read on a full buffer and n,
+  // the frame bytes read including CMD_BINARY_FRAME, are all the frame bytes in the buffer.
+  uint8_t serial_rx_frame_is_short(uint16_t n);
+#endif
+
 // Returns the number of bytes used in the TX serial buffer.
 // NOTE: Not used except for debugging and ensuring no TX bottlenecks.
 uint8_t serial_get_tx_buffer_count();
 
+// Returns the number of bytes available in the TX serial buffer.
+uint8_t serial_get_tx_buffer_available();
+
+#ifdef ENABLE_TELEMETRY_PORT
+  #ifndef TELEMETRY_TX_BUFFER_SIZE
+    #define TELEMETRY_TX_BUFFER_SIZE 127
+  #endif
+
+  // Initializes the transmit-only telemetry port. See ENABLE_TELEMETRY_PORT in config.h.
+  void telemetry_init();
+
+  // Starts a telemetry frame of n bytes. Returns false and counts the frame as dropped, if the
+  // telemetry TX buffer can't take the whole frame, or if the main program is writing a frame and
+  // this is called from an interrupt. Each true return must be followed by n telemetry_write()
+  // calls and a telemetry_end_frame() call.
+  uint8_t telemetry_begin_frame(uint8_t n);
+
+  // Writes one byte of a started frame to the telemetry TX buffer. Never waits.
+  void telemetry_write(uint8_t data);
+
+  // Ends a telemetry frame and starts transmitting it.
+  void telemetry_end_frame();
+
+  // Returns the number of telemetry frames dropped on a full TX buffer since power up.
+  uint16_t telemetry_get_drop_count();
+#endif
+
+// Returns the total Timer2 ticks the main program has spent blocked in serial_write() on a full
+// TX buffer since power up.
+uint32_t serial_get_tx_stall_ticks();
+
 #endif
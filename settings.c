@@ -22,6 +22,7 @@
 #include "grbl.h"
 
 settings_t settings;
+settings_derived_t settings_derived;
 
 const __flash settings_t defaults = {\
     .pulse_microseconds = DEFAULT_STEP_PULSE_MICROSECONDS,
@@ -29,7 +30,9 @@ const __flash settings_t defaults = {\
     .step_invert_mask = DEFAULT_STEPPING_INVERT_MASK,
     .dir_invert_mask = DEFAULT_DIRECTION_INVERT_MASK,
     .status_report_mask = DEFAULT_STATUS_REPORT_MASK,
+    .status_report_interval = DEFAULT_STATUS_REPORT_INTERVAL,
     .junction_deviation = DEFAULT_JUNCTION_DEVIATION,
+    .rapid_junction_deviation = DEFAULT_RAPID_JUNCTION_DEVIATION,
     .arc_tolerance = DEFAULT_ARC_TOLERANCE,
     .rpm_max = DEFAULT_SPINDLE_RPM_MAX,
     .rpm_min = DEFAULT_SPINDLE_RPM_MIN,
@@ -38,6 +41,13 @@ const __flash settings_t defaults = {\
     .homing_seek_rate = DEFAULT_HOMING_SEEK_RATE,
     .homing_debounce_delay = DEFAULT_HOMING_DEBOUNCE_DELAY,
     .homing_pulloff = DEFAULT_HOMING_PULLOFF,
+    .thc_kp = DEFAULT_THC_KP,
+    .thc_ki = DEFAULT_THC_KI,
+    .thc_kd = DEFAULT_THC_KD,
+    .thc_max_velocity = DEFAULT_THC_MAX_VELOCITY,
+    .thc_acceleration = DEFAULT_THC_ACCELERATION,
+    .adc_filter = DEFAULT_ADC_FILTER,
+    .baud_rate = BAUD_RATE,
     .flags = (DEFAULT_REPORT_INCHES << BIT_REPORT_INCHES) | \
              (DEFAULT_LASER_MODE << BIT_LASER_MODE) | \
              (DEFAULT_INVERT_ST_ENABLE << BIT_INVERT_ST_ENABLE) | \
@@ -57,7 +67,10 @@ const __flash settings_t defaults = {\
     .acceleration[Z_AXIS] = DEFAULT_Z_ACCELERATION,
     .max_travel[X_AXIS] = (-DEFAULT_X_MAX_TRAVEL),
     .max_travel[Y_AXIS] = (-DEFAULT_Y_MAX_TRAVEL),
-    .max_travel[Z_AXIS] = (-DEFAULT_Z_MAX_TRAVEL)};
+    .max_travel[Z_AXIS] = (-DEFAULT_Z_MAX_TRAVEL),
+    .jerk[X_AXIS] = DEFAULT_X_JERK,
+    .jerk[Y_AXIS] = DEFAULT_Y_JERK,
+    .jerk[Z_AXIS] = DEFAULT_Z_JERK};
 
 
 // Method to store startup lines into EEPROM
@@ -100,11 +113,21 @@ void write_global_settings()
 }
 
 
+// Method to store a confirmed serial baud rate into EEPROM
+// NOTE: This function can only be called in IDLE state.
+void settings_store_baud_rate(uint32_t baud_rate)
+{
+  settings.baud_rate = baud_rate;
+  write_global_settings();
+}
+
+
 // Method to restore EEPROM-saved Grbl global settings back to defaults.
 void settings_restore(uint8_t restore_flag) {
   if (restore_flag & SETTINGS_RESTORE_DEFAULTS) {
     settings = defaults;
     write_global_settings();
+    settings_compute_derived();
   }
 
   if (restore_flag & SETTINGS_RESTORE_PARAMETERS) {
@@ -215,6 +238,7 @@ uint8_t settings_store_global_setting(uint8_t parameter, float value) {
             break;
           case 2: settings.acceleration[parameter] = value*60*60; break; // Convert to mm/min^2 for grbl internal use.
           case 3: settings.max_travel[parameter] = -value; break;  // Store as negative for grbl internal use.
+          case 4: settings.jerk[parameter] = value*60*60*60; break; // Convert to mm/min^3 for grbl internal use.
         }
         break; // Exit while-loop after setting has been configured and proceed to the EEPROM write call.
       } else {
@@ -253,7 +277,13 @@ uint8_t settings_store_global_setting(uint8_t parameter, float value) {
         else { settings.flags &= ~BITFLAG_INVERT_PROBE_PIN; }
         probe_configure_invert_mask(false);
         break;
-      case 10: settings.status_report_mask = int_value; break;
+      case 10:
+        #ifdef ENABLE_XONXOFF
+          // Binary status frames can hold the XON/XOFF characters, which the host would eat.
+          if (int_value & BITFLAG_RT_STATUS_BINARY) { return(STATUS_SETTING_DISABLED); }
+        #endif
+        settings.status_report_mask = int_value;
+        break;
       case 11: settings.junction_deviation = value; break;
       case 12: settings.arc_tolerance = value; break;
       case 13:
@@ -261,6 +291,12 @@ uint8_t settings_store_global_setting(uint8_t parameter, float value) {
         else { settings.flags &= ~BITFLAG_REPORT_INCHES; }
         system_flag_wco_change(); // Make sure WCO is immediately updated.
         break;
+      case 14:
+        if (int_value && (int_value < REPORT_AUTO_MIN_INTERVAL)) { int_value = REPORT_AUTO_MIN_INTERVAL; }
+        settings.status_report_interval = int_value;
+        timer_set_report_interval(int_value);
+        break;
+      case 15: settings.rapid_junction_deviation = value; break;
       case 20:
         if (int_value) {
           if (bit_isfalse(settings.flags, BITFLAG_HOMING_ENABLE)) { return(STATUS_SOFT_LIMIT_ERROR); }
@@ -290,15 +326,74 @@ uint8_t settings_store_global_setting(uint8_t parameter, float value) {
         if (int_value) { settings.flags |= BITFLAG_LASER_MODE; }
         else { settings.flags &= ~BITFLAG_LASER_MODE; }
         break;
+      case 40: settings.thc_kp = value; break;
+      case 41: settings.thc_ki = value; break;
+      case 42: settings.thc_kd = value; break;
+      case 43: settings.thc_max_velocity = value; break;
+      case 44: settings.thc_acceleration = value; break;
+      case 45:
+        if (int_value > ADC_FILTER_MEDIAN) { return(STATUS_INVALID_STATEMENT); }
+        settings.adc_filter = int_value;
+        break;
       default:
         return(STATUS_INVALID_STATEMENT);
     }
   }
   write_global_settings();
+  if (settings_compute_derived()) { report_feedback_message(MESSAGE_THC_GAIN_LIMITED); }
   return(STATUS_OK);
 }
 
 
+// Converts a THC gain to its integer per-update term. Rounds, and limits a non-zero gain to 1 to
+// THC_GAIN_MAX, so that a small gain doesn't turn into zero and silently select the band controller.
+// Sets *is_limited, if limited.
+static int32_t settings_thc_gain(float gain, uint8_t *is_limited)
+{
+  if (gain <= 0.0) { return(0); }
+  if (gain < 1.0) { *is_limited = true; return(1); }
+  if (gain > THC_GAIN_MAX) { *is_limited = true; return(THC_GAIN_MAX); }
+  return(lround(gain));
+}
+
+
+// Rebuilds the derived settings cache. Called after the global settings are read, restored, or changed.
+// Returns true, if a THC gain had to be limited.
+uint8_t settings_compute_derived()
+{
+  uint8_t idx;
+  for (idx=0; idx<N_AXIS; idx++) {
+    settings_derived.mm_per_step[idx] = 1.0/settings.steps_per_mm[idx];
+  }
+
+  // THC controller. Converts mm/min of Z velocity to Z steps per Timer2 tick, and the gains to
+  // per-update terms of the fine ADC error, so thc_update() runs in integer math.
+  float rate_per_mm_min = settings.steps_per_mm[Z_AXIS]*(TIMER_TICK_US/(60.0*1000000.0))*THC_RATE_ONE;
+  float gain_per_count = rate_per_mm_min/bit(ADC_FINE_SHIFT);
+  float update_sec = (THC_UPDATE_TICKS*TIMER_TICK_US)/1000000.0;
+  uint8_t is_limited = false;
+  int32_t kp = settings_thc_gain(settings.thc_kp*gain_per_count, &is_limited);
+  int32_t ki = settings_thc_gain(settings.thc_ki*gain_per_count*(update_sec*THC_INTEGRAL_SCALE), &is_limited);
+  int32_t kd = settings_thc_gain(settings.thc_kd*gain_per_count/update_sec, &is_limited);
+  // The THC velocity and acceleration never exceed the Z axis limits ($112, $122).
+  float max_velocity = min(settings.thc_max_velocity, settings.max_rate[Z_AXIS]);
+  float acceleration = min(settings.thc_acceleration, settings.acceleration[Z_AXIS]/(60*60));
+  int32_t max_rate = min(max_velocity*rate_per_mm_min, THC_RATE_ONE);
+  int32_t rate_step = max(acceleration*60.0*update_sec*rate_per_mm_min, 1);
+
+  // Write them as one update, so thc_update() never mixes old and new values.
+  uint8_t sreg = SREG;
+  cli();
+  settings_derived.thc_kp = kp;
+  settings_derived.thc_ki = ki;
+  settings_derived.thc_kd = kd;
+  settings_derived.thc_max_rate = max_rate;
+  settings_derived.thc_rate_step = rate_step;
+  SREG = sreg;
+  return(is_limited);
+}
+
+
 // Initialize the config subsystem
 void settings_init() {
   if(!read_global_settings()) {
@@ -306,6 +401,7 @@ void settings_init() {
     settings_restore(SETTINGS_RESTORE_ALL); // Force restore all EEPROM data.
     report_grbl_settings();
   }
+  settings_compute_derived();
 }
 
 
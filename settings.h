@@ -30,7 +30,7 @@
 
 // Version of the EEPROM data. Will be used to migrate existing data from older versions of Grbl
 // when firmware is upgraded. Always stored in byte 0 of eeprom
-#define SETTINGS_VERSION 10  // NOTE: Check settings_reset() when moving to next version.
+#define SETTINGS_VERSION 16  // NOTE: Check settings_reset() when moving to next version.
 
 // Define bit flag masks for the boolean settings in settings.flag.
 #define BIT_REPORT_INCHES      0
@@ -54,6 +54,7 @@
 // Define status reporting boolean enable bit flags in settings.status_report_mask
 #define BITFLAG_RT_STATUS_POSITION_TYPE     bit(0)
 #define BITFLAG_RT_STATUS_BUFFER_STATE      bit(1)
+#define BITFLAG_RT_STATUS_BINARY            bit(2) // Compact binary status frame. See report.h.
 
 // Define settings restore bitflags.
 #define SETTINGS_RESTORE_DEFAULTS bit(0)
@@ -79,7 +80,7 @@
 // #define SETTING_INDEX_G92    N_COORDINATE_SYSTEM+2  // Coordinate offset (G92.2,G92.3 not supported)
 
 // Define Grbl axis settings numbering scheme. Starts at START_VAL, every INCREMENT, over N_SETTINGS.
-#define AXIS_N_SETTINGS          4
+#define AXIS_N_SETTINGS          5
 #define AXIS_SETTINGS_START_VAL  100 // NOTE: Reserving settings values >= 100 for axis settings. Up to 255.
 #define AXIS_SETTINGS_INCREMENT  10  // Must be greater than the number of axis settings
 
@@ -90,6 +91,7 @@ typedef struct {
   float max_rate[N_AXIS];
   float acceleration[N_AXIS];
   float max_travel[N_AXIS];
+  float jerk[N_AXIS]; // Used only by ENABLE_S_CURVE_ACCELERATION. Stored in mm/min^3.
 
   // Remaining Grbl settings
   uint8_t pulse_microseconds;
@@ -97,7 +99,9 @@ typedef struct {
   uint8_t dir_invert_mask;
   uint8_t stepper_idle_lock_time; // If max value 255, steppers do not disable.
   uint8_t status_report_mask; // Mask to indicate desired report data.
+  uint8_t status_report_interval; // Auto status report interval in msec. Zero disables.
   float junction_deviation;
+  float rapid_junction_deviation; // Junction deviation of motions with the torch off.
   float arc_tolerance;
   float rpm_max;
   float rpm_min;
@@ -108,9 +112,34 @@ typedef struct {
   float homing_seek_rate;
   uint16_t homing_debounce_delay;
   float homing_pulloff;
+
+  // THC controller. A zero proportional gain selects the hysteresis band controller.
+  float thc_kp; // Z velocity in mm/min per ADC count of arc voltage error.
+  float thc_ki; // mm/min per ADC count per second.
+  float thc_kd; // mm/min per ADC count per second of error change.
+  float thc_max_velocity; // mm/min
+  float thc_acceleration; // mm/sec^2
+  uint8_t adc_filter; // Arc voltage filter. See ADC_FILTER_* in adc.h.
+
+  uint32_t baud_rate; // Serial baud rate. Only altered by the `$B=` handshake.
 } settings_t;
 extern settings_t settings;
 
+// Values derived from the global settings for the motion hot paths, so they multiply instead of divide.
+// Not stored in EEPROM. Rebuilt by settings_compute_derived() whenever the global settings change.
+typedef struct {
+  float mm_per_step[N_AXIS]; // Inverse of steps_per_mm.
+
+  // THC controller gains and limits in Z steps per Timer2 tick, scaled by THC_RATE_ONE. The gains are
+  // per fine ADC count. See thc.c.
+  int32_t thc_kp;
+  int32_t thc_ki; // Also scaled by THC_INTEGRAL_SCALE.
+  int32_t thc_kd;
+  int32_t thc_max_rate;
+  int32_t thc_rate_step; // Most velocity change per thc_update() call.
+} settings_derived_t;
+extern settings_derived_t settings_derived;
+
 // Initialize the configuration subsystem (load settings from EEPROM)
 void settings_init();
 
@@ -120,6 +149,10 @@ void settings_restore(uint8_t restore_flag);
 // A helper method to set new settings from command line
 uint8_t settings_store_global_setting(uint8_t parameter, float value);
 
+// Rebuilds the derived settings cache from the global settings. Returns true, if a THC gain
+// ($40-$42) had to be limited.
+uint8_t settings_compute_derived();
+
 // Stores the protocol line variable as a startup line in EEPROM
 void settings_store_startup_line(uint8_t n, char *line);
 
@@ -129,6 +162,9 @@ uint8_t settings_read_startup_line(uint8_t n, char *line);
 // Stores build info user-defined string
 void settings_store_build_info(char *line);
 
+// Stores a confirmed serial baud rate
+void settings_store_baud_rate(uint32_t baud_rate);
+
 // Reads build info user-defined string
 uint8_t settings_read_build_info(char *line);
 
@@ -211,7 +211,12 @@ void spindle_set_state(uint8_t state, float rpm)
 // if an abort or check-mode is active.
 void spindle_sync(uint8_t state, float rpm)
 {
-  if (sys.state == STATE_CHECK_MODE) { return; }
+  if (sys.state == STATE_CHECK_MODE) {
+    #ifdef ENABLE_RUN_TIME_ESTIMATOR
+      estimator_sync();
+    #endif
+    return;
+  }
   protocol_buffer_synchronize(); // Empty planner buffer to ensure spindle is set when programmed.
   spindle_set_state(state,rpm);
 }
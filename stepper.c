@@ -25,6 +25,8 @@
 // Some useful constants.
 #define DT_SEGMENT (1.0/(ACCELERATION_TICKS_PER_SECOND*60.0)) // min/segment
 #define REQ_MM_INCREMENT_SCALAR 1.25
+#define ARC_REQ_MM_INCREMENT_SCALAR 3.0 // Covers any chord direction over three axes and chord shortening.
+#define THC_Z_MAX_PENDING_STEPS 1 // Most THC Z correction steps queued ahead of the stepper ISR.
 #define RAMP_ACCEL 0
 #define RAMP_CRUISE 1
 #define RAMP_DECEL 2
@@ -63,6 +65,7 @@
   uint32_t step_event_count;
   uint8_t direction_bits[N_AXIS];
   uint8_t is_pwm_rate_adjusted; // Tracks motions that require constant laser power/rate
+  uint8_t thc_flags; // Copied from the planner block. Read by the THC.
   } st_block_t;
 #else
   typedef struct {
@@ -70,6 +73,7 @@
     uint32_t step_event_count;
     uint8_t direction_bits;
     uint8_t is_pwm_rate_adjusted; // Tracks motions that require constant laser power/rate
+    uint8_t thc_flags; // Copied from the planner block. Read by the THC.
   } st_block_t;
 #endif // Ramps Board
 
@@ -143,6 +147,20 @@ static uint8_t segment_next_head;
 // Used to avoid ISR nesting of the "Stepper Driver Interrupt". Should never occur though.
 static volatile uint8_t busy;
 
+// THC Z correction steps. Requested by the Timer2 ISR and delivered by the Stepper Driver Interrupt,
+// which times the pulse like any other step. At most one step is pending, so the Timer2 tick paces
+// the Z steps and the THC rate limit holds. thc_z_requested is only written by the Timer2 ISR, and
+// thc_z_delivered by the Stepper Driver Interrupt or by st_go_idle() once that interrupt is disabled,
+// so neither ISR has to block the other. The difference is the signed number of steps still pending.
+static volatile uint8_t thc_z_requested;
+static volatile uint8_t thc_z_delivered;
+static volatile bool thc_z_blocked; // Executing block moves Z. Set at each segment load for the Timer2 ISR.
+
+// Copy of sys_position[Z_AXIS] for the THC telemetry frame. The Stepper Driver Interrupt updates
+// sys_position with interrupts enabled, so other interrupts could read it half written. The copy is
+// written and read with interrupts disabled. See st_get_z_position().
+static volatile int32_t st_z_position;
+
 // Pointers for the step segment being prepped from the planner buffer. Accessed only by the
 // main program. Pointers may be planning segments or planner blocks ahead of what being executed.
 static plan_block_t *pl_block;     // Pointer to the planner block being prepped
@@ -175,6 +193,29 @@ typedef struct {
   float accelerate_until; // Acceleration ramp end measured from end of block (mm)
   float decelerate_after; // Deceleration ramp start measured from end of block (mm)
 
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    uint8_t scurve_active;    // Flag set when the S-curve data below belongs to the current ramp
+    float scurve_time;        // Elapsed time in the current ramp (min)
+    float scurve_duration;    // Total time of the current ramp (min)
+    float scurve_jerk_time;   // Duration of the rising and the falling acceleration phases (min)
+    float scurve_accel;       // Signed peak acceleration of the ramp (mm/min^2)
+    float scurve_jerk;        // Signed jerk of the rising acceleration phase (mm/min^3)
+    float scurve_start_speed; // Speed at the start of the ramp (mm/min)
+    float scurve_end_speed;   // Speed at the end of the ramp (mm/min)
+    float scurve_start_mm;    // Ramp start measured from end of block (mm)
+    float scurve_distance;    // Total ramp distance (mm)
+  #endif
+
+  #ifdef ENABLE_PLANNER_ARCS
+    plan_arc_t *arc;            // Arc of the prepped arc block
+    int32_t arc_steps[N_AXIS];  // Arc position at the end of the last prepped chord (steps)
+    uint8_t arc_block_unused;   // Flags the stepper block loaded with the arc block, until its first chord
+    float arc_chord_mm;         // Longest chord within the arc tolerance (mm)
+    float arc_dt_max;           // Segment time limit keeping the chords within the arc tolerance (min)
+    float arc_end_mm;           // Distance from the block end of the last computed arc point (mm)
+    int32_t arc_end_steps[N_AXIS]; // Last computed arc point (steps)
+  #endif
+
   float inv_rate;    // Used by PWM laser mode to speed up segment calculations.
   uint16_t current_spindle_pwm; 
 } st_prep_t;
@@ -266,6 +307,12 @@ void st_wake_up()
     st.step_pulse_time = -(((settings.pulse_microseconds-2)*TICKS_PER_MICROSECOND) >> 3);
   #endif
 
+  // Publish the position set while idle, e.g. by homing, before the Stepper Driver Interrupt runs.
+  uint8_t sreg = SREG;
+  cli();
+  st_z_position = sys_position[Z_AXIS];
+  SREG = sreg;
+
   // Enable Stepper Driver Interrupt
   TIMSK1 |= (1<<OCIE1A);
 }
@@ -278,6 +325,8 @@ void st_go_idle()
   TIMSK1 &= ~(1<<OCIE1A); // Disable Timer1 interrupt
   TCCR1B = (TCCR1B & ~((1<<CS12) | (1<<CS11))) | (1<<CS10); // Reset clock to no prescaling.
   busy = false;
+  thc_z_delivered = thc_z_requested; // Drop THC corrections left over from the stopped motion.
+  thcWorking = false; // The THC only runs with the motion of an enabled block.
 
   // Set stepper driver idle state, disabled or enabled, depending on settings and circumstances.
   bool pin_state = false; // Keep enabled.
@@ -422,6 +471,10 @@ ISR(TIMER1_COMPA_vect)
         // Initialize Bresenham line and distance counters
         st.counter_x = st.counter_y = st.counter_z = (st.exec_block->step_event_count >> 1);
       }
+      // Engage or release the THC as the block runs. Set with every segment, so it also resumes
+      // after a feed hold.
+      thcWorking = bit_istrue(st.exec_block->thc_flags,PL_THC_FLAG_ENABLE);
+      thc_z_blocked = (st.exec_block->steps[Z_AXIS] != 0);
       #ifdef DEFAULTS_RAMPS_BOARD
         for (i = 0; i < N_AXIS; i++)
           st.dir_outbits[i] = st.exec_block->direction_bits[i] ^ dir_port_invert_mask[i];
@@ -441,6 +494,9 @@ ISR(TIMER1_COMPA_vect)
 
     } else {
       // Segment buffer empty. Shutdown.
+      #ifdef DEBUG
+        if (!(sys.step_control & STEP_CONTROL_END_MOTION)) { sys_debug_starve_count++; }
+      #endif
       st_go_idle();
       // Ensure pwm is set properly upon completion of rate-controlled motion.
       if (st.exec_block->is_pwm_rate_adjusted) { spindle_set_speed(SPINDLE_PWM_OFF_VALUE); }
@@ -524,6 +580,36 @@ ISR(TIMER1_COMPA_vect)
     }
   #endif // Ramps Board
 
+  // Deliver a pending THC Z correction step. The direction is set here and output at the start of
+  // the next tick, just before this step pulse. A block moving Z itself drops the correction instead
+  // of holding it back until its Z motion ends.
+  if (thc_z_blocked) {
+    thc_z_delivered = thc_z_requested;
+  } else {
+    int8_t thc_z_pending = (int8_t)(thc_z_requested - thc_z_delivered);
+    if (thc_z_pending > 0) {
+      #ifdef DEFAULTS_RAMPS_BOARD
+        st.step_outbits[Z_AXIS] |= (1<<STEP_BIT(Z_AXIS));
+        st.dir_outbits[Z_AXIS] = dir_port_invert_mask[Z_AXIS];
+      #else
+        st.step_outbits |= (1<<Z_STEP_BIT);
+        st.dir_outbits = (st.dir_outbits & ~(1<<Z_DIRECTION_BIT)) | (dir_port_invert_mask & (1<<Z_DIRECTION_BIT));
+      #endif // Ramps Board
+      thc_z_delivered++;
+      sys_position[Z_AXIS]++;
+    } else if (thc_z_pending < 0) {
+      #ifdef DEFAULTS_RAMPS_BOARD
+        st.step_outbits[Z_AXIS] |= (1<<STEP_BIT(Z_AXIS));
+        st.dir_outbits[Z_AXIS] = (1<<DIRECTION_BIT(Z_AXIS)) ^ dir_port_invert_mask[Z_AXIS];
+      #else
+        st.step_outbits |= (1<<Z_STEP_BIT);
+        st.dir_outbits = (st.dir_outbits & ~(1<<Z_DIRECTION_BIT)) | ((1<<Z_DIRECTION_BIT) ^ (dir_port_invert_mask & (1<<Z_DIRECTION_BIT)));
+      #endif // Ramps Board
+      thc_z_delivered--;
+      sys_position[Z_AXIS]--;
+    }
+  }
+
   // During a homing cycle, lock out and prevent desired axes from moving.
   #ifdef DEFAULTS_RAMPS_BOARD
     for (i = 0; i < N_AXIS; i++)
@@ -543,6 +629,16 @@ ISR(TIMER1_COMPA_vect)
   #else
     st.step_outbits ^= step_port_invert_mask;  // Apply step port invert mask
   #endif // Ramps Board
+  #ifdef DEBUG
+    // Timer1 counts up from the compare match that fired this interrupt, so this covers the entry
+    // latency caused by other interrupts as well as the time spent in here. Scaled from Timer1 ticks
+    // to CPU cycles by the prescaler (1, 8 or 64) of the running segment.
+    uint32_t isr_cycles = (uint32_t)TCNT1 << (3*((TCCR1B & 0x07)-1));
+    if (isr_cycles > 0xFFFF) { isr_cycles = 0xFFFF; }
+    if (isr_cycles > sys_debug_step_isr_max) { sys_debug_step_isr_max = isr_cycles; }
+  #endif
+  cli(); // Until the return from interrupt, which enables them again.
+  st_z_position = sys_position[Z_AXIS];
   busy = false;
 }
 
@@ -702,7 +798,7 @@ void st_update_plan_block_parameters()
 {
   if (pl_block != NULL) { // Ignore if at start of a new block.
     prep.recalculate_flag |= PREP_FLAG_RECALCULATE;
-    pl_block->entry_speed_sqr = prep.current_speed*prep.current_speed; // Update entry speed.
+    pl_block->entry_speed_sqr = plan_speed_sqr_from_float(prep.current_speed*prep.current_speed); // Update entry speed.
     pl_block = NULL; // Flag st_prep_segment() to load and check active velocity profile.
   }
 }
@@ -747,6 +843,9 @@ static uint8_t st_next_block_index(uint8_t block_index)
       prep.step_per_mm = prep.last_step_per_mm;
       prep.recalculate_flag = (PREP_FLAG_HOLD_PARTIAL_BLOCK | PREP_FLAG_RECALCULATE);
       prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR/prep.step_per_mm; // Recompute this value.
+      #ifdef ENABLE_PLANNER_ARCS
+        if (plan_get_current_block()->is_arc) { prep.req_mm_increment = ARC_REQ_MM_INCREMENT_SCALAR/prep.step_per_mm; }
+      #endif
     } else {
       prep.recalculate_flag = false;
     }
@@ -755,6 +854,238 @@ static uint8_t st_next_block_index(uint8_t block_index)
 #endif
 
 
+#ifdef ENABLE_S_CURVE_ACCELERATION
+/* Computes the velocity profile of the prepped block with jerk-limited ramps, from entry_speed up to
+   at most nominal_speed and down to the exit speed. Same profile types as the constant acceleration
+   profile, but with the ramp distances of plan_scurve_ramp_distance(). The planner plans the block
+   speeds with the same ramps, so they always fit the block.
+*/
+static void st_scurve_profile(float entry_speed, float nominal_speed)
+{
+  float accel_mm = plan_scurve_ramp_distance(pl_block, entry_speed, nominal_speed);
+  float decel_mm = plan_scurve_ramp_distance(pl_block, prep.exit_speed, nominal_speed);
+  if (accel_mm+decel_mm <= pl_block->millimeters) { // Trapezoid type
+    prep.maximum_speed = nominal_speed;
+    prep.decelerate_after = decel_mm;
+    if (entry_speed >= nominal_speed) { prep.ramp_type = RAMP_CRUISE; } // Cruise-deceleration or cruise-only type.
+    else { prep.accelerate_until -= accel_mm; } // Full-trapezoid or acceleration-cruise types
+    return;
+  }
+  float peak_speed = plan_scurve_peak_speed(pl_block, entry_speed, prep.exit_speed, nominal_speed);
+  if (peak_speed > max(entry_speed, prep.exit_speed)) { // Triangle type
+    // The acceleration ramp gets the bisection remainder, so both ramps fit.
+    prep.decelerate_after = plan_scurve_ramp_distance(pl_block, prep.exit_speed, peak_speed);
+    prep.accelerate_until = prep.decelerate_after;
+    prep.maximum_speed = peak_speed;
+  } else if (entry_speed > prep.exit_speed) { // Deceleration-only type
+    prep.ramp_type = RAMP_DECEL;
+  } else { // Acceleration-only type
+    prep.accelerate_until = 0.0;
+    prep.maximum_speed = prep.exit_speed;
+  }
+}
+
+
+// Returns the speed a jerk-limited deceleration from entry_speed reaches at the end of the prepped
+// block, which is too short to stop in. Used by feed holds and override decelerations, which aren't
+// planned. Found by bisection.
+static float st_scurve_exit_speed(float entry_speed)
+{
+  float low = 0.0;
+  float high = entry_speed;
+  uint8_t idx;
+  for (idx=0; idx<PLAN_SCURVE_PEAK_ITERATIONS; idx++) {
+    float speed = 0.5*(low+high);
+    if (plan_scurve_ramp_distance(pl_block, speed, entry_speed) > pl_block->millimeters) { low = speed; }
+    else { high = speed; }
+  }
+  return(high);
+}
+
+
+/* Computes a jerk-limited ramp from the current speed to end_speed, which starts start_mm and
+   ends end_mm from the end of the block. The ramp runs at the mean of its start and end speeds, so
+   its duration is T = 2*distance/(start_speed+end_speed). The acceleration rises linearly with the
+   block jerk to a peak, holds, and falls back to zero, which gives the peak acceleration as the
+   smaller root of accel^2/jerk - accel*T + delta_speed = 0. The block profile gives every ramp at
+   least the distance of plan_scurve_ramp_distance(), which keeps the peak within the block
+   acceleration. Only a ramp shortened by an override change may be too short for the jerk. It
+   then becomes a triangle at a higher jerk, as the speed change must complete within T.
+*/
+static void st_scurve_begin(float start_mm, float end_mm, float end_speed)
+{
+  prep.scurve_active = true;
+  prep.scurve_time = 0.0;
+  prep.scurve_duration = 0.0;
+  prep.scurve_start_speed = prep.current_speed;
+  prep.scurve_end_speed = end_speed;
+  prep.scurve_start_mm = start_mm;
+  prep.scurve_distance = start_mm-end_mm;
+
+  float speed_sum = prep.current_speed+end_speed;
+  if ((prep.scurve_distance <= 0.0) || (speed_sum <= 0.0)) { return; } // Empty ramp. Ends at once.
+  float duration = 2.0*prep.scurve_distance/speed_sum;
+  float delta_speed = fabs(end_speed-prep.current_speed);
+  float accel, jerk;
+  if (pl_block->jerk*duration*duration > 4.0*delta_speed) { // Trapezoidal acceleration
+    accel = 2.0*delta_speed/(duration+sqrt(duration*duration-4.0*delta_speed/pl_block->jerk));
+    jerk = pl_block->jerk;
+    prep.scurve_jerk_time = accel/jerk;
+  } else { // Triangular acceleration
+    accel = 2.0*delta_speed/duration;
+    prep.scurve_jerk_time = 0.5*duration;
+    jerk = accel/prep.scurve_jerk_time;
+  }
+  #ifdef DEBUG
+    if (delta_speed > 0.0) { // Ramp peaks relative to the block limits
+      if (accel/pl_block->acceleration > sys_debug_scurve_accel_max) { sys_debug_scurve_accel_max = accel/pl_block->acceleration; }
+      if (jerk/pl_block->jerk > sys_debug_scurve_jerk_max) { sys_debug_scurve_jerk_max = jerk/pl_block->jerk; }
+    }
+  #endif
+  if (end_speed < prep.current_speed) { accel = -accel; jerk = -jerk; }
+  prep.scurve_duration = duration;
+  prep.scurve_accel = accel;
+  prep.scurve_jerk = jerk;
+}
+
+
+// Returns the distance traveled from the start of the S-curve ramp at the elapsed ramp time and
+// updates the current speed. Only valid while the elapsed time is less than the ramp duration.
+static float st_scurve_distance()
+{
+  float t = prep.scurve_time;
+  float t_jerk = prep.scurve_jerk_time;
+  float v0 = prep.scurve_start_speed;
+  if (t < t_jerk) { // Rising acceleration
+    prep.current_speed = v0 + 0.5*prep.scurve_jerk*t*t;
+    return(t*(v0 + prep.scurve_jerk*t*t/6.0));
+  }
+  float t_end = prep.scurve_duration - t;
+  if (t_end < t_jerk) { // Falling acceleration. Mirrored from the end of the ramp.
+    prep.current_speed = prep.scurve_end_speed - 0.5*prep.scurve_jerk*t_end*t_end;
+    return(prep.scurve_distance - t_end*(prep.scurve_end_speed - prep.scurve_jerk*t_end*t_end/6.0));
+  }
+  // Constant acceleration
+  float v_jerk = v0 + 0.5*prep.scurve_accel*t_jerk;
+  t -= t_jerk;
+  prep.current_speed = v_jerk + prep.scurve_accel*t;
+  return(t_jerk*(v0 + prep.scurve_accel*t_jerk/6.0) + t*(v_jerk + 0.5*prep.scurve_accel*t));
+}
+#endif
+
+
+#ifdef ENABLE_PLANNER_ARCS
+// Sets up the chord tracing of a newly loaded arc block. The stepper block loaded with the block
+// holds the first chord.
+static void st_arc_begin()
+{
+  prep.arc = plan_get_current_arc();
+  memcpy(prep.arc_steps, prep.arc->start_steps, sizeof(prep.arc_steps));
+  prep.arc_end_mm = -1.0; // No arc point computed
+  prep.arc_block_unused = true;
+
+  // Longest chord, which deviates no more than the arc tolerance from the arc.
+  float radius = hypot(prep.arc->radius_vec[0], prep.arc->radius_vec[1]);
+  if (radius > settings.arc_tolerance) {
+    prep.arc_chord_mm = 2*sqrt(settings.arc_tolerance*(2*radius - settings.arc_tolerance));
+  } else { prep.arc_chord_mm = 2*radius; }
+
+  // Minimum segment distance. Moves at least one step on the lowest resolution axis along any chord
+  // direction, including chords shortened by the arc curvature.
+  prep.step_per_mm = min(settings.steps_per_mm[X_AXIS], min(settings.steps_per_mm[Y_AXIS], settings.steps_per_mm[Z_AXIS]));
+  prep.req_mm_increment = ARC_REQ_MM_INCREMENT_SCALAR/prep.step_per_mm;
+}
+
+
+// Computes the arc point mm_remaining from the end of the block into prep.arc_end_steps, unless
+// it is already there. Returns true, if the chord from the last prepped arc position to the point
+// has steps.
+static uint8_t st_arc_compute_point(float mm_remaining)
+{
+  plan_arc_t *arc = prep.arc;
+  uint8_t idx;
+  if (mm_remaining != prep.arc_end_mm) {
+    prep.arc_end_mm = mm_remaining;
+    if (mm_remaining == 0.0) {
+      for (idx=0; idx<N_AXIS; idx++) { prep.arc_end_steps[idx] = arc->target_steps[idx]; }
+    } else {
+      float fraction = 1.0 - mm_remaining/arc->millimeters;
+      float angle = fraction*arc->angular_travel;
+      float cos_a = cos(angle);
+      float sin_a = sin(angle);
+      prep.arc_end_steps[arc->axis_0] = lround((arc->center[0] + arc->radius_vec[0]*cos_a - arc->radius_vec[1]*sin_a)*settings.steps_per_mm[arc->axis_0]);
+      prep.arc_end_steps[arc->axis_1] = lround((arc->center[1] + arc->radius_vec[0]*sin_a + arc->radius_vec[1]*cos_a)*settings.steps_per_mm[arc->axis_1]);
+      prep.arc_end_steps[arc->axis_linear] = lround((arc->linear_start + fraction*arc->linear_travel)*settings.steps_per_mm[arc->axis_linear]);
+    }
+  }
+  for (idx=0; idx<N_AXIS; idx++) {
+    if (prep.arc_end_steps[idx] != prep.arc_steps[idx]) { return(true); }
+  }
+  return(false);
+}
+
+
+// Loads the chord from the last prepped arc position to the arc point mm_remaining from the end of
+// the block into the stepper block of the prepped segment. Every chord gets its own stepper block,
+// so the stepper ISR restarts the Bresenham counters with each segment. The last chord ends exactly
+// at the planner target position. Returns the chord step event count. Chords without steps are
+// not loaded.
+static uint16_t st_prep_arc_chord(segment_t *prep_segment, float mm_remaining)
+{
+  int32_t delta_steps[N_AXIS];
+  uint8_t idx;
+  st_arc_compute_point(mm_remaining);
+  for (idx=0; idx<N_AXIS; idx++) {
+    delta_steps[idx] = prep.arc_end_steps[idx] - prep.arc_steps[idx];
+    prep.arc_steps[idx] = prep.arc_end_steps[idx];
+  }
+  #ifdef COREXY
+    int32_t delta_x = delta_steps[X_AXIS];
+    delta_steps[A_MOTOR] = delta_x + delta_steps[Y_AXIS];
+    delta_steps[B_MOTOR] = delta_x - delta_steps[Y_AXIS];
+  #endif
+
+  uint32_t step_event_count = 0;
+  for (idx=0; idx<N_AXIS; idx++) { step_event_count = max(step_event_count, labs(delta_steps[idx])); }
+  if (step_event_count == 0) { return(0); }
+
+  // Take the next stepper block, unless the block loaded with the arc block is still unused.
+  if (prep.arc_block_unused) { prep.arc_block_unused = false; }
+  else {
+    st_block_t *last_block = st_prep_block;
+    prep.st_block_index = st_next_block_index(prep.st_block_index);
+    st_prep_block = &st_block_buffer[prep.st_block_index];
+    st_prep_block->is_pwm_rate_adjusted = last_block->is_pwm_rate_adjusted;
+    st_prep_block->thc_flags = last_block->thc_flags;
+  }
+  prep_segment->st_block_index = prep.st_block_index;
+
+  #ifndef DEFAULTS_RAMPS_BOARD
+    st_prep_block->direction_bits = 0;
+  #endif
+  for (idx=0; idx<N_AXIS; idx++) {
+    #ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+      st_prep_block->steps[idx] = (uint32_t)labs(delta_steps[idx]) << 1;
+    #else
+      st_prep_block->steps[idx] = (uint32_t)labs(delta_steps[idx]) << MAX_AMASS_LEVEL;
+    #endif
+    #ifdef DEFAULTS_RAMPS_BOARD
+      if (delta_steps[idx] < 0) { st_prep_block->direction_bits[idx] = get_direction_pin_mask(idx); }
+      else { st_prep_block->direction_bits[idx] = 0; }
+    #else
+      if (delta_steps[idx] < 0) { st_prep_block->direction_bits |= get_direction_pin_mask(idx); }
+    #endif // Ramps Board
+  }
+  #ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
+    st_prep_block->step_event_count = step_event_count << 1;
+  #else
+    st_prep_block->step_event_count = step_event_count << MAX_AMASS_LEVEL;
+  #endif
+  return(step_event_count);
+}
+#endif
+
+
 /* Prepares step segment buffer. Continuously called from main program.
 
    The segment buffer is an intermediary buffer interface between the execution of steps
@@ -803,40 +1134,50 @@ void st_prep_buffer()
         // segment buffer finishes the prepped block, but the stepper ISR is still executing it.
         st_prep_block = &st_block_buffer[prep.st_block_index];
         uint8_t idx;
-        #ifdef DEFAULTS_RAMPS_BOARD
-          for (idx=0; idx<N_AXIS; idx++) {
-            st_prep_block->direction_bits[idx] = pl_block->direction_bits[idx];
-          }
-        #else
+        uint32_t step_event_count = 0; // Not stored in the packed planner block. Maximum axis steps.
+        for (idx=0; idx<N_AXIS; idx++) {
+          step_event_count = max(step_event_count, pl_block->steps[idx]);
+          #ifdef DEFAULTS_RAMPS_BOARD
+            // Expand the planner axis direction bitmask into the per-axis direction port masks.
+            if (pl_block->direction_bits & bit(idx)) { st_prep_block->direction_bits[idx] = get_direction_pin_mask(idx); }
+            else { st_prep_block->direction_bits[idx] = 0; }
+          #endif // Ramps Board
+        }
+        #ifndef DEFAULTS_RAMPS_BOARD
           st_prep_block->direction_bits = pl_block->direction_bits;
         #endif // Ramps Board
 
         #ifndef ADAPTIVE_MULTI_AXIS_STEP_SMOOTHING
-          for (idx=0; idx<N_AXIS; idx++) { st_prep_block->steps[idx] = (pl_block->steps[idx] << 1); }
-          st_prep_block->step_event_count = (pl_block->step_event_count << 1);
+          for (idx=0; idx<N_AXIS; idx++) { st_prep_block->steps[idx] = ((uint32_t)pl_block->steps[idx] << 1); }
+          st_prep_block->step_event_count = (step_event_count << 1);
         #else
           // With AMASS enabled, simply bit-shift multiply all Bresenham data by the max AMASS
           // level, such that we never divide beyond the original data anywhere in the algorithm.
           // If the original data is divided, we can lose a step from integer roundoff.
-          for (idx=0; idx<N_AXIS; idx++) { st_prep_block->steps[idx] = pl_block->steps[idx] << MAX_AMASS_LEVEL; }
-          st_prep_block->step_event_count = pl_block->step_event_count << MAX_AMASS_LEVEL;
+          for (idx=0; idx<N_AXIS; idx++) { st_prep_block->steps[idx] = (uint32_t)pl_block->steps[idx] << MAX_AMASS_LEVEL; }
+          st_prep_block->step_event_count = step_event_count << MAX_AMASS_LEVEL;
         #endif
 
         // Initialize segment buffer data for generating the segments.
-        prep.steps_remaining = (float)pl_block->step_event_count;
+        prep.steps_remaining = (float)step_event_count;
         prep.step_per_mm = prep.steps_remaining/pl_block->millimeters;
         prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR/prep.step_per_mm;
         prep.dt_remainder = 0.0; // Reset for new segment block
+        #ifdef ENABLE_PLANNER_ARCS
+          if (pl_block->is_arc) { st_arc_begin(); } // Arc blocks have no steps. Traced by chords.
+        #endif
 
         if ((sys.step_control & STEP_CONTROL_EXECUTE_HOLD) || (prep.recalculate_flag & PREP_FLAG_DECEL_OVERRIDE)) {
           // New block loaded mid-hold. Override planner block entry speed to enforce deceleration.
           prep.current_speed = prep.exit_speed;
-          pl_block->entry_speed_sqr = prep.exit_speed*prep.exit_speed;
+          pl_block->entry_speed_sqr = plan_speed_sqr_from_float(prep.exit_speed*prep.exit_speed);
           prep.recalculate_flag &= ~(PREP_FLAG_DECEL_OVERRIDE);
         } else {
-          prep.current_speed = sqrt(pl_block->entry_speed_sqr);
+          prep.current_speed = sqrt(plan_speed_sqr_to_float(pl_block->entry_speed_sqr));
         }
         
+        st_prep_block->thc_flags = pl_block->thc_flags;
+
         // Setup laser mode variables. PWM rate adjusted motions will always complete a motion with the
         // spindle off. 
         st_prep_block->is_pwm_rate_adjusted = false;
@@ -856,16 +1197,28 @@ void st_prep_buffer()
 			 hold, override the planner velocities and decelerate to the target exit speed.
 			*/
 			prep.mm_complete = 0.0; // Default velocity profile complete at 0.0mm from end of block.
+      #ifdef ENABLE_S_CURVE_ACCELERATION
+        prep.scurve_active = false; // Start a new S-curve ramp from the current speed.
+      #endif
 			float inv_2_accel = 0.5/pl_block->acceleration;
+			float entry_speed_sqr = plan_speed_sqr_to_float(pl_block->entry_speed_sqr);
 			if (sys.step_control & STEP_CONTROL_EXECUTE_HOLD) { // [Forced Deceleration to Zero Velocity]
 				// Compute velocity profile parameters for a feed hold in-progress. This profile overrides
 				// the planner block profile, enforcing a deceleration to zero speed.
 				prep.ramp_type = RAMP_DECEL;
 				// Compute decelerate distance relative to end of block.
-				float decel_dist = pl_block->millimeters - inv_2_accel*pl_block->entry_speed_sqr;
+        #ifdef ENABLE_S_CURVE_ACCELERATION
+          float decel_dist = pl_block->millimeters - plan_scurve_ramp_distance(pl_block, 0.0, sqrt(entry_speed_sqr));
+        #else
+				  float decel_dist = pl_block->millimeters - inv_2_accel*entry_speed_sqr;
+        #endif
 				if (decel_dist < 0.0) {
 					// Deceleration through entire planner block. End of feed hold is not in this block.
-					prep.exit_speed = sqrt(pl_block->entry_speed_sqr-2*pl_block->acceleration*pl_block->millimeters);
+          #ifdef ENABLE_S_CURVE_ACCELERATION
+            prep.exit_speed = st_scurve_exit_speed(sqrt(entry_speed_sqr));
+          #else
+					  prep.exit_speed = sqrt(entry_speed_sqr-2*pl_block->acceleration*pl_block->millimeters);
+          #endif
 				} else {
 					prep.mm_complete = decel_dist; // End of feed hold.
 					prep.exit_speed = 0.0;
@@ -886,18 +1239,24 @@ void st_prep_buffer()
 
         nominal_speed = plan_compute_profile_nominal_speed(pl_block);
 				float nominal_speed_sqr = nominal_speed*nominal_speed;
-				float intersect_distance =
-								0.5*(pl_block->millimeters+inv_2_accel*(pl_block->entry_speed_sqr-exit_speed_sqr));
+        #ifndef ENABLE_S_CURVE_ACCELERATION
+				  float intersect_distance =
+								  0.5*(pl_block->millimeters+inv_2_accel*(entry_speed_sqr-exit_speed_sqr));
+        #endif
 
-        if (pl_block->entry_speed_sqr > nominal_speed_sqr) { // Only occurs during override reductions.
-          prep.accelerate_until = pl_block->millimeters - inv_2_accel*(pl_block->entry_speed_sqr-nominal_speed_sqr);
+        if (entry_speed_sqr > nominal_speed_sqr) { // Only occurs during override reductions.
+          prep.accelerate_until = pl_block->millimeters - inv_2_accel*(entry_speed_sqr-nominal_speed_sqr);
           if (prep.accelerate_until <= 0.0) { // Deceleration-only.
             prep.ramp_type = RAMP_DECEL;
             // prep.decelerate_after = pl_block->millimeters;
             // prep.maximum_speed = prep.current_speed;
 
             // Compute override block exit speed since it doesn't match the planner exit speed.
-            prep.exit_speed = sqrt(pl_block->entry_speed_sqr - 2*pl_block->acceleration*pl_block->millimeters);
+            #ifdef ENABLE_S_CURVE_ACCELERATION
+              prep.exit_speed = st_scurve_exit_speed(sqrt(entry_speed_sqr));
+            #else
+              prep.exit_speed = sqrt(entry_speed_sqr - 2*pl_block->acceleration*pl_block->millimeters);
+            #endif
             prep.recalculate_flag |= PREP_FLAG_DECEL_OVERRIDE; // Flag to load next block as deceleration override.
 
             // TODO: Determine correct handling of parameters in deceleration-only.
@@ -906,22 +1265,33 @@ void st_prep_buffer()
 
           } else {
             // Decelerate to cruise or cruise-decelerate types. Guaranteed to intersect updated plan.
-            prep.decelerate_after = inv_2_accel*(nominal_speed_sqr-exit_speed_sqr);
+            #ifdef ENABLE_S_CURVE_ACCELERATION
+              // The longer jerk-limited ramp may not fit after the override deceleration. It then
+              // starts right after it, and is shortened. See st_scurve_begin().
+              prep.decelerate_after = plan_scurve_ramp_distance(pl_block, prep.exit_speed, nominal_speed);
+              if (prep.decelerate_after > prep.accelerate_until) { prep.decelerate_after = prep.accelerate_until; }
+            #else
+              prep.decelerate_after = inv_2_accel*(nominal_speed_sqr-exit_speed_sqr);
+            #endif
             prep.maximum_speed = nominal_speed;
             prep.ramp_type = RAMP_DECEL_OVERRIDE;
           }
+        #ifdef ENABLE_S_CURVE_ACCELERATION
+        } else { // Jerk-limited ramps of any type.
+          st_scurve_profile(sqrt(entry_speed_sqr), nominal_speed);
+        #else
 				} else if (intersect_distance > 0.0) {
 					if (intersect_distance < pl_block->millimeters) { // Either trapezoid or triangle types
 						// NOTE: For acceleration-cruise and cruise-only types, following calculation will be 0.0.
 						prep.decelerate_after = inv_2_accel*(nominal_speed_sqr-exit_speed_sqr);
 						if (prep.decelerate_after < intersect_distance) { // Trapezoid type
 							prep.maximum_speed = nominal_speed;
-							if (pl_block->entry_speed_sqr == nominal_speed_sqr) {
+							if (entry_speed_sqr == nominal_speed_sqr) {
 								// Cruise-deceleration or cruise-only type.
 								prep.ramp_type = RAMP_CRUISE;
 							} else {
 								// Full-trapezoid or acceleration-cruise types
-								prep.accelerate_until -= inv_2_accel*(nominal_speed_sqr-pl_block->entry_speed_sqr);
+								prep.accelerate_until -= inv_2_accel*(nominal_speed_sqr-entry_speed_sqr);
 							}
 						} else { // Triangle type
 							prep.accelerate_until = intersect_distance;
@@ -937,8 +1307,19 @@ void st_prep_buffer()
 					prep.accelerate_until = 0.0;
 					// prep.decelerate_after = 0.0;
 					prep.maximum_speed = prep.exit_speed;
+        #endif
 				}
 			}
+
+      #ifdef ENABLE_PLANNER_ARCS
+        if (pl_block->is_arc) {
+          // Limit the segment time, so that no segment at the fastest speed of the profile is longer
+          // than a chord within the arc tolerance. Limited to four times the normal segment rate.
+          prep.arc_dt_max = prep.arc_chord_mm/max(prep.current_speed, plan_compute_profile_nominal_speed(pl_block));
+          if (prep.arc_dt_max > DT_SEGMENT) { prep.arc_dt_max = DT_SEGMENT; }
+          else if (prep.arc_dt_max < 0.25*DT_SEGMENT) { prep.arc_dt_max = 0.25*DT_SEGMENT; }
+        }
+      #endif
       
       bit_true(sys.step_control, STEP_CONTROL_UPDATE_SPINDLE_PWM); // Force update whenever updating block.
     }
@@ -964,6 +1345,9 @@ void st_prep_buffer()
       such as from a feed hold.
     */
     float dt_max = DT_SEGMENT; // Maximum segment time
+    #ifdef ENABLE_PLANNER_ARCS
+      if (pl_block->is_arc) { dt_max = prep.arc_dt_max; }
+    #endif
     float dt = 0.0; // Initialize segment time
     float time_var = dt_max; // Time worker variable
     float mm_var; // mm-Distance worker variable
@@ -989,18 +1373,32 @@ void st_prep_buffer()
           break;
         case RAMP_ACCEL:
           // NOTE: Acceleration ramp only computes during first do-while loop.
-          speed_var = pl_block->acceleration*time_var;
-          mm_remaining -= time_var*(prep.current_speed + 0.5*speed_var);
-          if (mm_remaining < prep.accelerate_until) { // End of acceleration ramp.
-            // Acceleration-cruise, acceleration-deceleration ramp junction, or end of block.
-            mm_remaining = prep.accelerate_until; // NOTE: 0.0 at EOB
-            time_var = 2.0*(pl_block->millimeters-mm_remaining)/(prep.current_speed+prep.maximum_speed);
-            if (mm_remaining == prep.decelerate_after) { prep.ramp_type = RAMP_DECEL; }
-            else { prep.ramp_type = RAMP_CRUISE; }
-            prep.current_speed = prep.maximum_speed;
-          } else { // Acceleration only.
-            prep.current_speed += speed_var;
-          }
+          #ifdef ENABLE_S_CURVE_ACCELERATION
+            if (!prep.scurve_active) { st_scurve_begin(mm_remaining,prep.accelerate_until,prep.maximum_speed); }
+            prep.scurve_time += time_var;
+            if (prep.scurve_time < prep.scurve_duration) {
+              mm_var = prep.scurve_start_mm - st_scurve_distance();
+              if (mm_var > prep.accelerate_until) { // Acceleration only.
+                mm_remaining = mm_var;
+                break;
+              }
+            } else { time_var -= prep.scurve_time-prep.scurve_duration; } // Time left in ramp.
+            prep.scurve_active = false;
+          #else
+            speed_var = pl_block->acceleration*time_var;
+            mm_remaining -= time_var*(prep.current_speed + 0.5*speed_var);
+            if (mm_remaining >= prep.accelerate_until) { // Acceleration only.
+              prep.current_speed += speed_var;
+              break;
+            }
+            time_var = 2.0*(pl_block->millimeters-prep.accelerate_until)/(prep.current_speed+prep.maximum_speed);
+          #endif
+          // End of acceleration ramp.
+          // Acceleration-cruise, acceleration-deceleration ramp junction, or end of block.
+          mm_remaining = prep.accelerate_until; // NOTE: 0.0 at EOB
+          if (mm_remaining == prep.decelerate_after) { prep.ramp_type = RAMP_DECEL; }
+          else { prep.ramp_type = RAMP_CRUISE; }
+          prep.current_speed = prep.maximum_speed;
           break;
         case RAMP_CRUISE:
           // NOTE: mm_var used to retain the last mm_remaining for incomplete segment time_var calculations.
@@ -1017,19 +1415,33 @@ void st_prep_buffer()
           }
           break;
         default: // case RAMP_DECEL:
-          // NOTE: mm_var used as a misc worker variable to prevent errors when near zero speed.
-          speed_var = pl_block->acceleration*time_var; // Used as delta speed (mm/min)
-          if (prep.current_speed > speed_var) { // Check if at or below zero speed.
-            // Compute distance from end of segment to end of block.
-            mm_var = mm_remaining - time_var*(prep.current_speed - 0.5*speed_var); // (mm)
-            if (mm_var > prep.mm_complete) { // Typical case. In deceleration ramp.
-              mm_remaining = mm_var;
-              prep.current_speed -= speed_var;
-              break; // Segment complete. Exit switch-case statement. Continue do-while loop.
+          #ifdef ENABLE_S_CURVE_ACCELERATION
+            if (!prep.scurve_active) { st_scurve_begin(mm_remaining,prep.mm_complete,prep.exit_speed); }
+            prep.scurve_time += time_var;
+            if (prep.scurve_time < prep.scurve_duration) {
+              // NOTE: Checked against mm_complete to keep round-off from passing the end of the ramp.
+              mm_var = prep.scurve_start_mm - st_scurve_distance();
+              if (mm_var > prep.mm_complete) { // Typical case. In deceleration ramp.
+                mm_remaining = mm_var;
+                break; // Segment complete. Exit switch-case statement. Continue do-while loop.
+              }
+            } else { time_var -= prep.scurve_time-prep.scurve_duration; } // Time left in ramp.
+            prep.scurve_active = false;
+          #else
+            // NOTE: mm_var used as a misc worker variable to prevent errors when near zero speed.
+            speed_var = pl_block->acceleration*time_var; // Used as delta speed (mm/min)
+            if (prep.current_speed > speed_var) { // Check if at or below zero speed.
+              // Compute distance from end of segment to end of block.
+              mm_var = mm_remaining - time_var*(prep.current_speed - 0.5*speed_var); // (mm)
+              if (mm_var > prep.mm_complete) { // Typical case. In deceleration ramp.
+                mm_remaining = mm_var;
+                prep.current_speed -= speed_var;
+                break; // Segment complete. Exit switch-case statement. Continue do-while loop.
+              }
             }
-          }
+            time_var = 2.0*(mm_remaining-prep.mm_complete)/(prep.current_speed+prep.exit_speed);
+          #endif
           // Otherwise, at end of block or end of forced-deceleration.
-          time_var = 2.0*(mm_remaining-prep.mm_complete)/(prep.current_speed+prep.exit_speed);
           mm_remaining = prep.mm_complete;
           prep.current_speed = prep.exit_speed;
       }
@@ -1041,6 +1453,13 @@ void st_prep_buffer()
           // through distance calculations until minimum_mm or mm_complete.
           dt_max += DT_SEGMENT;
           time_var = dt_max - dt;
+        #ifdef ENABLE_PLANNER_ARCS
+          } else if (pl_block->is_arc && !st_arc_compute_point(mm_remaining)) {
+            // Chord without steps. Rounding can leave short chords on the same step position, when
+            // they run along an axis of the plane. Extend the segment until the chord has a step.
+            dt_max += prep.arc_dt_max;
+            time_var = dt_max - dt;
+        #endif
         } else {
           break; // **Complete** Exit loop. Segment execution time maxed.
         }
@@ -1083,6 +1502,14 @@ void st_prep_buffer()
     float n_steps_remaining = ceil(step_dist_remaining); // Round-up current steps remaining
     float last_n_steps_remaining = ceil(prep.steps_remaining); // Round-up last steps remaining
     prep_segment->n_step = last_n_steps_remaining-n_steps_remaining; // Compute number of steps to execute.
+    #ifdef ENABLE_PLANNER_ARCS
+      if (pl_block->is_arc) {
+        // Arc chords end on whole steps, so there are no partial steps to carry to the next segment.
+        prep_segment->n_step = st_prep_arc_chord(prep_segment, mm_remaining);
+        step_dist_remaining = n_steps_remaining = 0.0;
+        last_n_steps_remaining = prep_segment->n_step;
+      }
+    #endif
 
     // Bail if we are at the end of a feed hold and don't have a step to execute.
     if (prep_segment->n_step == 0) {
@@ -1095,6 +1522,20 @@ void st_prep_buffer()
         #endif
         return; // Segment not generated, but current step data still retained.
       }
+      #ifdef ENABLE_PLANNER_ARCS
+        if (pl_block->is_arc && (mm_remaining == 0.0)) {
+          // Arc end within a step of the last chord. Nothing left to execute.
+          pl_block = NULL;
+          plan_discard_current_block();
+          continue;
+        }
+        if (pl_block->is_arc) {
+          // Never queue a segment without steps. Its step rate has no steps to divide by. The
+          // segment loop extends mid-arc chords to a step, so only skip the stepless distance here.
+          pl_block->millimeters = mm_remaining;
+          continue;
+        }
+      #endif
     }
 
     // Compute segment step rate. Since steps are integers and mm distances traveled are not,
@@ -1145,6 +1586,9 @@ void st_prep_buffer()
     // Segment complete! Increment segment buffer indices, so stepper ISR can immediately execute it.
     segment_buffer_head = segment_next_head;
     if ( ++segment_next_head == SEGMENT_BUFFER_SIZE ) { segment_next_head = 0; }
+    #ifdef DEBUG
+      sys_debug_segment_count++;
+    #endif
 
     // Update the appropriate planner and segment data.
     pl_block->millimeters = mm_remaining;
@@ -1189,3 +1633,38 @@ float st_get_realtime_rate()
   }
   return 0.0f;
 }
+
+
+// Returns the THC flags of the executing planner block. Zero when not in a cycle.
+uint8_t st_get_thc_flags()
+{
+  if ((sys.state & STATE_CYCLE) && (st.exec_block != NULL)) { return(st.exec_block->thc_flags); }
+  return(0);
+}
+
+
+// Returns the Z machine position in steps, as of the last Stepper Driver Interrupt. Safe to call from
+// an interrupt, unlike a read of sys_position.
+int32_t st_get_z_position()
+{
+  uint8_t sreg = SREG;
+  cli();
+  int32_t position = st_z_position;
+  SREG = sreg;
+  return(position);
+}
+
+
+// Queues a THC Z correction step for the Stepper Driver Interrupt. Called by the Timer2 ISR. Requests
+// beyond THC_Z_MAX_PENDING_STEPS are dropped, so a slow step rate can't build up a backlog. Requests
+// during a block moving Z are dropped too, as the stepper ISR won't deliver them.
+void st_thc_request_z_step(bool up)
+{
+  if (thc_z_blocked) { return; }
+  int8_t thc_z_pending = (int8_t)(thc_z_requested - thc_z_delivered);
+  if (up) {
+    if (thc_z_pending < THC_Z_MAX_PENDING_STEPS) { thc_z_requested++; }
+  } else {
+    if (thc_z_pending > -THC_Z_MAX_PENDING_STEPS) { thc_z_requested--; }
+  }
+}
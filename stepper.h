@@ -56,4 +56,13 @@ void st_update_plan_block_parameters();
 // Called by realtime status reporting if realtime rate reporting is enabled in config.h.
 float st_get_realtime_rate();
 
+// Called by the THC to check the run conditions of the executing block. See PL_THC_FLAG_* in planner.h.
+uint8_t st_get_thc_flags();
+
+// Returns the Z machine position in steps for the THC telemetry frame. See stepper.c.
+int32_t st_get_z_position();
+
+// Called by the Timer2 ISR to queue a THC Z correction step for the stepper ISR to output.
+void st_thc_request_z_step(bool up);
+
 #endif
@@ -114,6 +114,53 @@ void system_execute_startup(char *line)
 }
 
 
+// Switches the serial port to a new baud rate and waits for the host to confirm the link by sending
+// `$B` at the new rate. The rate is stored, if the line arrives in time without receive errors.
+// Otherwise, the old rate is restored. See BAUD_RATE in config.h for the handshake sequence.
+static uint8_t system_negotiate_baud_rate(uint32_t baud_rate)
+{
+  report_baud_rate(baud_rate); // Acknowledge at the old rate.
+
+  // Let the acknowledgement fully leave the transmitter before switching.
+  while (serial_get_tx_buffer_count()) {
+    if (sys_rt_exec_state & EXEC_RESET) { return(STATUS_OK); }
+  }
+  delay_ms(2); // Shift register and last character at the slowest supported rate.
+
+  serial_set_baud_rate(baud_rate);
+  serial_reset_read_buffer();
+  serial_reset_rx_error_count();
+
+  // Wait for the `$B` confirmation line. Anything else is a failed link.
+  uint16_t timeout = SERIAL_BAUD_CONFIRM_TIMEOUT;
+  uint8_t idx = 0;
+  uint8_t c;
+  while (timeout) {
+    if (sys_rt_exec_state & EXEC_RESET) { break; }
+    c = serial_read();
+    if (c == SERIAL_NO_DATA) {
+      delay_ms(1);
+      timeout--;
+    } else if ((c == '\n') || (c == '\r')) {
+      if (idx == 2) { break; }
+      idx = 0; // Ignore empty lines.
+    } else if ((idx == 0 && c == '$') || (idx == 1 && c == 'B')) {
+      idx++;
+    } else {
+      timeout = 0; // Unexpected character. Link is not clean.
+    }
+  }
+
+  if (timeout && (idx == 2) && (serial_get_rx_error_count() == 0)) {
+    settings_store_baud_rate(baud_rate);
+    return(STATUS_OK);
+  }
+  serial_set_baud_rate(settings.baud_rate); // Revert.
+  serial_reset_read_buffer();
+  return(STATUS_BAUD_RATE_NOT_CONFIRMED);
+}
+
+
 // Directs and executes one line of formatted input from protocol_process. While mostly
 // incoming streaming g-code blocks, this also executes Grbl internal commands, such as
 // settings, initiating the homing cycle, and toggling switch states. This differs from
@@ -151,11 +198,18 @@ uint8_t system_execute_line(char *line)
           // is idle and ready, regardless of alarm locks. This is mainly to keep things
           // simple and consistent.
           if ( sys.state == STATE_CHECK_MODE ) {
+            #ifdef ENABLE_RUN_TIME_ESTIMATOR
+              estimator_sync();
+              report_run_time_estimate();
+            #endif
             mc_reset();
             report_feedback_message(MESSAGE_DISABLED);
           } else {
             if (sys.state) { return(STATUS_IDLE_ERROR); } // Requires no alarm mode.
             sys.state = STATE_CHECK_MODE;
+            #ifdef ENABLE_RUN_TIME_ESTIMATOR
+              estimator_reset();
+            #endif
             report_feedback_message(MESSAGE_ENABLED);
           }
           break;
@@ -170,6 +224,21 @@ uint8_t system_execute_line(char *line)
           break;
       }
       break;
+    #ifdef ENABLE_SD_CARD
+      case 'F' : // SD card job commands. Allowed during the job. See ENABLE_SD_CARD in config.h.
+        switch (line[++char_counter]) {
+          case 0 : return(sd_job_list());
+          case '=' : return(sd_job_start(&line[++char_counter]));
+        }
+        if (line[char_counter+1] != 0) { return(STATUS_INVALID_STATEMENT); }
+        switch (line[char_counter]) {
+          case 'P' : return(sd_job_pause());
+          case 'R' : return(sd_job_resume());
+          case 'S' : report_sd_job_status(); break;
+          default : return(STATUS_INVALID_STATEMENT);
+        }
+        break;
+    #endif
     default :
       // Block any system command that requires the state as IDLE/ALARM. (i.e. EEPROM, homing)
       if (line[1] != 'T') //THC can and should be controlled during program run...
@@ -239,7 +308,18 @@ uint8_t system_execute_line(char *line)
             //print_uint32_base10((uint16_t)analogSetVal);
             //printPgmString(PSTR("\r\n"));
           }
+          else if (line[2] == '-') { thc_debug(line); } // Print THC status and analog inputs
         break;
+        case 'B' : // Print or negotiate serial baud rate [IDLE/ALARM]
+          if ( line[++char_counter] == 0 ) {
+            report_baud_rate(settings.baud_rate);
+          } else {
+            if(line[char_counter++] != '=') { return(STATUS_INVALID_STATEMENT); }
+            if(!read_float(line, &char_counter, &value)) { return(STATUS_BAD_NUMBER_FORMAT); }
+            if((line[char_counter] != 0) || !serial_check_baud_rate((uint32_t)value)) { return(STATUS_INVALID_STATEMENT); }
+            return(system_negotiate_baud_rate((uint32_t)value));
+          }
+          break;
         case 'R' : // Restore defaults [IDLE/ALARM]
           if ((line[2] != 'S') || (line[3] != 'T') || (line[4] != '=') || (line[6] != 0)) { return(STATUS_INVALID_STATEMENT); }
           switch (line[5]) {
@@ -317,14 +397,14 @@ float system_convert_axis_steps_to_mpos(int32_t *steps, uint8_t idx)
   float pos;
   #ifdef COREXY
     if (idx==X_AXIS) {
-      pos = (float)system_convert_corexy_to_x_axis_steps(steps) / settings.steps_per_mm[idx];
+      pos = (float)system_convert_corexy_to_x_axis_steps(steps)*settings_derived.mm_per_step[idx];
     } else if (idx==Y_AXIS) {
-      pos = (float)system_convert_corexy_to_y_axis_steps(steps) / settings.steps_per_mm[idx];
+      pos = (float)system_convert_corexy_to_y_axis_steps(steps)*settings_derived.mm_per_step[idx];
     } else {
-      pos = steps[idx]/settings.steps_per_mm[idx];
+      pos = steps[idx]*settings_derived.mm_per_step[idx];
     }
   #else
-    pos = steps[idx]/settings.steps_per_mm[idx];
+    pos = steps[idx]*settings_derived.mm_per_step[idx];
   #endif
   return(pos);
 }
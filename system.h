@@ -154,6 +154,20 @@ extern volatile uint8_t sys_rt_exec_accessory_override; // Global realtime execu
 #ifdef DEBUG
   #define EXEC_DEBUG_REPORT  bit(0)
   extern volatile uint8_t sys_rt_exec_debug;
+  extern uint16_t sys_debug_line_latency;     // Timer2 ticks from end of last line received to executed.
+  extern uint16_t sys_debug_line_latency_max; // Maximum line latency since reset.
+  extern uint32_t sys_debug_plan_count;       // Line motions passed to the planner since power-up.
+  extern uint32_t sys_debug_plan_ticks;       // Timer2 ticks spent in plan_buffer_line() since power-up.
+  extern uint32_t sys_debug_segment_count;    // Step segments prepped since power-up.
+  extern uint32_t sys_debug_prep_ticks;       // Timer2 ticks spent in main loop st_prep_buffer() calls.
+  extern volatile uint16_t sys_debug_starve_count; // Segment buffer ran empty outside a feed hold. Includes motion ends.
+  extern uint32_t sys_debug_replan_blocks;    // Blocks touched by planner_recalculate() passes since power-up.
+  extern uint16_t sys_debug_replan_max;       // Most blocks touched by a single planner_recalculate() call.
+  extern volatile uint16_t sys_debug_step_isr_max; // Longest stepper ISR in CPU cycles from its compare match.
+  #ifdef ENABLE_S_CURVE_ACCELERATION
+    extern float sys_debug_scurve_accel_max;  // Highest S-curve ramp peak acceleration, relative to the block acceleration.
+    extern float sys_debug_scurve_jerk_max;   // Highest S-curve ramp jerk, relative to the block jerk.
+  #endif
 #endif
 
 // Initialize the serial protocol
@@ -3,6 +3,11 @@
  * */
 #include "grbl.h"
 
+static volatile int32_t thc_rate; // Z velocity in steps per Timer2 tick, scaled by THC_RATE_ONE. Positive rises.
+static int32_t thc_integral;      // Integral term, scaled by THC_RATE_ONE*THC_INTEGRAL_SCALE.
+static int16_t thc_last_error;    // Arc voltage error of the last update, for the derivative term.
+static int32_t thc_step_acc;      // Fractional Z steps not yet queued.
+
 //THC Initialize
 void thc_initialize()
 {
@@ -12,28 +17,111 @@ void thc_initialize()
   thcWorking = false;
 }
 
-// THC Control
+// Sets the Z correction velocity. thc_step_tick() reads it in the Timer2 ISR, so it is written as one
+// update.
+static void thc_set_rate(int32_t rate)
+{
+  uint8_t sreg = SREG;
+  cli();
+  thc_rate = rate;
+  SREG = sreg;
+}
+
+// Stops the torch correction and resets the controller.
+static void thc_stop()
+{
+  thc_set_rate(0);
+  thc_integral = 0;
+  jog_z_up = false;
+  jog_z_down = false;
+}
+
+// THC Control. Run by the main program every THC_UPDATE_TICKS Timer2 ticks. See protocol_exec_rt_system().
 void thc_update()
 {
+  // Skip if THC is't on. Publish the latest arc voltage sample for the reports, without filtering.
+  if (!thcWorking)
+  {
+    adc_update_filter(ADC_FILTER_RAW);
+    thc_stop();
+    return;
+  }
 
-  // Skip if THC is't on
-  if (thcWorking)
-  {
-    if ((analogVal > (analogSetVal - hysteresis)) && (analogVal < (analogSetVal + hysteresis))) //We are within our ok range
-    {
-      jog_z_up = false;
-      jog_z_down = false;
-    }
-    else //We are not in range and need to deterimine direction needed to put us in range
-    {
-      if (analogVal > analogSetVal) //Torch is too high
-      {
-        jog_z_down = true;
-      }
-      else //Torch is too low
-      {
-        jog_z_up = true;
-      }
-    }
+  // Publish the arc voltage for the controllers and the reports. Stop the torch without new arc
+  // voltage samples, until the ADC delivers again.
+  if (!adc_update_filter(settings.adc_filter))
+  {
+    thc_stop();
+    return;
+  }
+
+  // Arc voltage error in fine ADC counts. Positive when the torch is too low.
+  int16_t error = ((int16_t)analogSetVal << ADC_FINE_SHIFT) - (int16_t)analogValFine;
+  int32_t target_rate = 0;
+  int32_t rate = thc_rate; // Only written here
+
+  // Hold the torch height through corner slowdowns. The arc voltage rises as the cut slows down,
+  // which would dive the torch into the plate.
+  if (st_get_thc_flags() & PL_THC_FLAG_CORNER_SLOWDOWN)
+  {
+    if (!settings_derived.thc_kp) { rate = 0; }
+  }
+  else if (!settings_derived.thc_kp) // Hysteresis band controller. Full THC velocity outside the band.
+  {
+    if (analogVal >= (analogSetVal + hysteresis)) { rate = -settings_derived.thc_max_rate; } //Torch is too high
+    else if (analogVal <= (analogSetVal - hysteresis)) { rate = settings_derived.thc_max_rate; } //Torch is too low
+    else { rate = 0; } //We are within our ok range
+  }
+  else // PID controller. The integral is clamped to the rate limit to keep it from winding up.
+  {
+    int32_t integral_max = settings_derived.thc_max_rate*THC_INTEGRAL_SCALE;
+    thc_integral += settings_derived.thc_ki*error;
+    if (thc_integral > integral_max) { thc_integral = integral_max; }
+    else if (thc_integral < -integral_max) { thc_integral = -integral_max; }
+
+    target_rate = settings_derived.thc_kp*error + thc_integral/THC_INTEGRAL_SCALE
+                  + settings_derived.thc_kd*(error - thc_last_error);
+    if (target_rate > settings_derived.thc_max_rate) { target_rate = settings_derived.thc_max_rate; }
+    else if (target_rate < -settings_derived.thc_max_rate) { target_rate = -settings_derived.thc_max_rate; }
+  }
+  thc_last_error = error;
+
+  // Ramp the PID velocity at the THC acceleration. Also ramps it down to a stop on a corner hold.
+  if (settings_derived.thc_kp)
+  {
+    if (target_rate > rate + settings_derived.thc_rate_step) { rate += settings_derived.thc_rate_step; }
+    else if (target_rate < rate - settings_derived.thc_rate_step) { rate -= settings_derived.thc_rate_step; }
+    else { rate = target_rate; }
+  }
+  thc_set_rate(rate);
+
+  // Correction direction for the THC reports
+  jog_z_up = (rate > 0);
+  jog_z_down = (rate < 0);
+}
+
+// Returns the Z correction velocity in steps per Timer2 tick, scaled by THC_RATE_ONE. Positive rises.
+int32_t thc_get_rate()
+{
+  uint8_t sreg = SREG;
+  cli();
+  int32_t rate = thc_rate;
+  SREG = sreg;
+  return(rate);
+}
+
+// Queue Z correction steps at the THC velocity. At most one step per tick.
+void thc_step_tick()
+{
+  thc_step_acc += thc_rate;
+  if (thc_step_acc >= THC_RATE_ONE)
+  {
+    thc_step_acc -= THC_RATE_ONE;
+    st_thc_request_z_step(true);
+  }
+  else if (thc_step_acc <= -THC_RATE_ONE)
+  {
+    thc_step_acc += THC_RATE_ONE;
+    st_thc_request_z_step(false);
   }
 }
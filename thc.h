@@ -5,12 +5,20 @@
 #ifndef thc_h
 #define thc_h
 
-            bool thcWorking;                   // THC working state
+            volatile bool thcWorking;          // THC working state. Set by the stepper ISR from the executing block.
             volatile bool jog_z_up;		        // Torch must be rised
             volatile bool jog_z_down;	        // Torch must be move down
             volatile uint16_t hysteresis;       // Allowable voltage deviation
             volatile uint16_t analogSetVal;     // Voltage to stabilize in thc
 
             void thc_initialize();              //THC Initialize
-            void thc_update();                  // THC Control
+            void thc_update();                  // THC Control. Run by the main program when Timer2 requests it.
+            void thc_step_tick();               // Queue Z correction steps. Called every Timer2 tick in a cycle.
+            int32_t thc_get_rate();             // Z correction velocity, scaled by THC_RATE_ONE. Positive rises.
+
+            // Z velocity unit: one Z step per Timer2 tick. Also the fastest correction rate.
+            #define THC_RATE_ONE 65536L
+            #define THC_INTEGRAL_SCALE 256L     // Extra resolution of the integral term
+            #define THC_GAIN_MAX 0x1FFFFL       // Keeps the PID terms of a 12-bit fine ADC error within int32
+            #define THC_UPDATE_TICKS 8          // Timer2 ticks per thc_update() call
 #endif
\ No newline at end of file
@@ -4,12 +4,20 @@
 #include "grbl.h"
 
 void thc_debug(char *line){
+    report_wait_tx_line();
     printPgmString(PSTR("THC control response\n"));
          if(line[2] == '-'){
            printPgmString(PSTR("Status Report\n"));
              printPgmString(PSTR("Reference Voltage  = "));
             print_uint32_base10((uint16_t)analogSetVal);
             printPgmString(PSTR("\r\n"));
+            printPgmString(PSTR("Analog Inputs      = "));
+            for (uint8_t i = 0; i < ADC_SCAN_N_CHANNELS; i++)
+            {
+              if (i) serial_write(',');
+              print_uint32_base10(adc_get_scan_value(i));
+            }
+            printPgmString(PSTR("\r\n"));
           }
          if (line[2] == '=')
           {
@@ -29,6 +37,7 @@ void thc_debug(char *line){
 }
 
 void report_thc(){
+  report_wait_tx_line();
   printPgmString(PSTR("$133="));
    print_uint32_base10((uint16_t)analogSetVal);
    printPgmString(PSTR("\r\n"));
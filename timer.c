@@ -15,60 +15,72 @@ void timer_setup(){
   TCCR2B = 0x05;        //Timer2 Control Reg B: Timer Prescaler set to 128
 }
 
-// Z Axis step
-void step_z(){
-            //Step
-            PORTL |= (1 << STEP_BIT_2);     // set pin Z step high
-            _delay_us(10);
-            PORTL &= ~(1 << STEP_BIT_2);    // set pin Z step low
+// Atomic read of the free running Timer2 tick count. Used for interval measurements.
+uint16_t timer_get_ticks(){
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t ticks = timer_ticks;
+  SREG = sreg;
+  return ticks;
 }
-void set_z_dir_low(){
-            PORTL &= ~(1 << DIRECTION_BIT_2);    // set pin Z dir low
-            _delay_us(10);
-}
-void set_z_dir_high(){
-            PORTL |= (1 << DIRECTION_BIT_2);     // set Z dir high
-            _delay_us(10);
+// Auto status report interval in Timer2 ticks. Zero disables.
+static volatile uint16_t report_interval_ticks = 0;
+static uint16_t report_ticks = 0;
+#ifdef ENABLE_TELEMETRY_PORT
+  static uint16_t telemetry_thc_ticks = 0;
+  static uint16_t telemetry_status_ticks = 0;
+#endif
+void timer_set_report_interval(uint8_t ms){
+  uint16_t ticks = ((uint32_t)ms*1000)/TIMER_TICK_US;
+  uint8_t sreg = SREG;
+  cli();
+  report_interval_ticks = ticks;
+  report_ticks = 0;
+  SREG = sreg;
 }
 
 //Fires every 1/8 of a ms, 125uS
 ISR(TIMER2_OVF_vect){
   
-    if(jog_z_up){
-            // Check direction in setting dir mask
-            if (settings.dir_invert_mask & (1 << 2)){
-             set_z_dir_high();
-            }
-            else{ 
-              set_z_dir_low();
-            }
-            
-            step_z(); //Step
-            sys_position[Z_AXIS]++; // Update position
-
-    }else if (jog_z_down){
-
-            if (settings.dir_invert_mask & (1 << 2)){
-              set_z_dir_low();
-            }
-            else
-            {
-              set_z_dir_high();
-            }
-
-            step_z(); //Step
-            sys_position[Z_AXIS]--;// Update position
-    }
+  // Queue THC Z corrections. The stepper ISR outputs them with the normal step pulse timing, so
+  // they only run during a cycle, when that interrupt is active.
+  if (sys.state & STATE_CYCLE){
+    thc_step_tick();
+  }
   
 
-  // Timing critical
-  if (millis_timer > 7) //8 cycles is one millisecond
+  // Once a millisecond, have the main program evaluate what the THC should be doing. The ADC filter
+  // and the controller take too long for this interrupt. See protocol_exec_rt_system().
+  if (millis_timer >= THC_UPDATE_TICKS)
   {
-    thc_update(); //Once a millisecond, evaluate what the THC should be doing
+    thc_update_pending = true;
     millis_timer = 0;
   }
  
+  // Auto status report. Skip the cycle when the TX buffer can't take a full report, so the
+  // main loop never waits on a slow host.
+  if (report_interval_ticks){
+    if (++report_ticks >= report_interval_ticks){
+      report_ticks = 0;
+      if ((TX_BUFFER_SIZE - serial_get_tx_buffer_count()) >= REPORT_AUTO_MIN_TX_AVAILABLE){
+        system_set_exec_state_flag(EXEC_STATUS_REPORT);
+      }
+    }
+  }
+  #ifdef ENABLE_TELEMETRY_PORT
+    // Telemetry port frames. Both are left to the main program. The THC frame follows the next THC
+    // update, so the arc voltage sample and the torch correction are logged as the THC saw them.
+    if (thcWorking && (++telemetry_thc_ticks >= TELEMETRY_THC_TICKS)){
+      telemetry_thc_ticks = 0;
+      telemetry_thc_pending = true;
+    }
+    if (++telemetry_status_ticks >= TELEMETRY_STATUS_TICKS){
+      telemetry_status_ticks = 0;
+      telemetry_status_pending = true;
+    }
+  #endif
   TCNT2 = 223;           // Reset Timer to 130 out of 255
   TIFR2 = 0x00;          // Timer2 INT Flag Reg: Clear Timer Overflow Flag
   millis_timer++;        // 1ms counter update 
+  timer_ticks++;         // Free running tick count
 }
@@ -2,6 +2,21 @@
 #define timer_h
 
     volatile unsigned long millis_timer;    // Count Timer Interruptions (1ms)
+    volatile uint16_t timer_ticks;          // Free running count of Timer2 interruptions. Wraps.
     void timer_setup();                     // Setup Timer2 to fire every 1ms
+    uint16_t timer_get_ticks();             // Atomic read of timer_ticks
+    void timer_set_report_interval(uint8_t ms); // Set auto status report interval. Zero disables.
+    volatile bool thc_update_pending;       // Set by Timer2 every THC_UPDATE_TICKS ticks. See thc_update().
+    #ifdef ENABLE_TELEMETRY_PORT
+      volatile bool telemetry_thc_pending;    // Set by Timer2 when a telemetry THC frame is due.
+      volatile bool telemetry_status_pending; // Set by Timer2 when a telemetry status frame is due.
+    #endif
+
+    // Timer2 interruption period: reload count 223 of 256 with prescaler 128
+    #define TIMER_TICK_US ((256-223)*128/(F_CPU/1000000))
+
+    // Telemetry frame intervals in Timer2 ticks
+    #define TELEMETRY_THC_TICKS ((TELEMETRY_THC_INTERVAL*1000UL)/TIMER_TICK_US)
+    #define TELEMETRY_STATUS_TICKS ((TELEMETRY_STATUS_INTERVAL*1000UL)/TIMER_TICK_US)
     
 #endif